@@ -0,0 +1,526 @@
+/*******************************  COPYRIGHT  ********************************/
+/**
+ *  Author? "Gregory N. Leonhardt"
+ *  License? "CC BY-NC 2.0"
+ *           "https://creativecommons.org/licenses/by-nc/2.0/"
+ *
+ ****************************************************************************/
+
+/******************************** JAVADOC ***********************************/
+/**
+ *  This file contains public function that makeup the external
+ *  library components of the 'archive' library.
+ *
+ *  @note
+ *      An archive (and everything opened on top of it) belongs to one
+ *      thread.  Different archives can be read by different threads at the
+ *      same time.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ *  Compiler directives
+ ****************************************************************************/
+
+#define ALLOC_ARCHIVE           ( "ALLOCATE STORAGE FOR ARCHIVE" )
+
+/****************************************************************************
+ * System Function API
+ ****************************************************************************/
+
+                                //*******************************************
+#include <stdint.h>             //  Alternative storage types
+#include <stdbool.h>            //  TRUE, FALSE, etc.
+#include <stdio.h>              //  Standard I/O definitions
+                                //*******************************************
+#include <string.h>             //  Functions for managing strings
+#include <strings.h>            //  strcasecmp( )
+#include <fcntl.h>              //  open( )
+#include <unistd.h>             //  close( )
+                                //*******************************************
+
+/****************************************************************************
+ * Application APIs
+ ****************************************************************************/
+
+                                //*******************************************
+#include "global.h"             //  Global stuff for this application
+#include "libtools_api.h"       //  My Tools Library
+                                //*******************************************
+#include "archive_api.h"        //  API for all archive_*           PUBLIC
+#include "archive_lib.h"        //  API for all ARCHIVE__*          PRIVATE
+                                //*******************************************
+
+/****************************************************************************
+ * Private API Enumerations
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Private API Definitions
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Private API Structures
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Private API Storage Allocation
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Public API Functions
+ ****************************************************************************/
+
+/****************************************************************************/
+/**
+ *  Identify an archive from its first few bytes.
+ *
+ *  @param  data_p              The first bytes of the file
+ *  @param  data_l              Number of bytes
+ *
+ *  @return type                ARCHIVE_TYPE_NONE when it is not an archive
+ *                              that can be read
+ *
+ *  @note
+ *
+ ****************************************************************************/
+
+enum    archive_type_e
+archive_type(
+    unsigned char           *   data_p,
+    int                         data_l
+    )
+{
+    /**
+     *  @param  type            What kind of archive this is                */
+    enum    archive_type_e      type;
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+    //  Assume it isn't one
+    type = ARCHIVE_TYPE_NONE;
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    if (    ( data_l >= 4 )
+         && ( memcmp( data_p, "PK\x03\x04", 4 ) == 0 ) )
+    {
+        type = ARCHIVE_TYPE_ZIP;
+    }
+    else if (    ( data_l >= 2 )
+              && ( memcmp( data_p, "\x1F\x8B", 2 ) == 0 ) )
+    {
+        type = ARCHIVE_TYPE_GZIP;
+    }
+    else if (    ( data_l >= 4 )
+              && ( memcmp( data_p, "BZh", 3 ) == 0 )
+              && ( data_p[ 3 ] >= '1' ) && ( data_p[ 3 ] <= '9' ) )
+    {
+        type = ARCHIVE_TYPE_BZIP2;
+    }
+    else if (    ( data_l >= 6 )
+              && ( memcmp( data_p, "\xFD" "7zXZ\x00", 6 ) == 0 ) )
+    {
+        type = ARCHIVE_TYPE_XZ;
+    }
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+    return( type );
+}
+
+/****************************************************************************/
+/**
+ *  Open an archive file.
+ *
+ *  @param  file_name_p         Full path & name of the file
+ *
+ *  @return archive_p           Pointer to the archive; NULL when the file
+ *                              can't be read or isn't an archive that can
+ *                              be read.
+ *
+ *  @note
+ *
+ ****************************************************************************/
+
+struct  archive_t       *
+archive_open(
+    char                    *   file_name_p
+    )
+{
+    /**
+     *  @param  archive_p       Pointer to the archive                      */
+    struct  archive_t       *   archive_p;
+    /**
+     *  @param  file_fd         File descriptor                             */
+    int                         file_fd;
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+    //  Open the file
+    file_fd = open( file_name_p, O_RDONLY );
+
+    if ( file_fd < 0 )
+    {
+        return( NULL );
+    }
+
+    //  Allocate the archive
+    archive_p = mem_malloc( sizeof( struct archive_t ) );
+    memset( archive_p, 0x00, sizeof( struct archive_t ) );
+    archive_p->file_fd = file_fd;
+    strncpy( archive_p->name, file_name_p, sizeof( archive_p->name ) - 1 );
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    //  What is it ?
+    ARCHIVE__fill( archive_p );
+    archive_p->type = archive_type( archive_p->in_buf, archive_p->in_l );
+
+    //  Can it be read ?
+    if ( archive_p->type == ARCHIVE_TYPE_NONE )
+    {
+        //  NO:     Forget it
+        archive_close( archive_p );
+        archive_p = NULL;
+    }
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+    return( archive_p );
+}
+
+/****************************************************************************/
+/**
+ *  Open an archive that is a member of another archive.
+ *
+ *  @param  parent_p            The archive it is in
+ *  @param  member_name_p       Name of the member
+ *  @param  data_p              Bytes already read from the member
+ *  @param  data_l              Number of bytes already read
+ *
+ *  @return archive_p           Pointer to the archive; NULL when the member
+ *                              isn't an archive that can be read.
+ *
+ *  @note
+ *      The caller has usually read the first block of the member to find
+ *      out what it is; those bytes are read again from here.  Close the
+ *      inner archive before moving the parent to its next member.
+ *
+ ****************************************************************************/
+
+struct  archive_t       *
+archive_open_member(
+    struct  archive_t       *   parent_p,
+    char                    *   member_name_p,
+    unsigned char           *   data_p,
+    int                         data_l
+    )
+{
+    /**
+     *  @param  archive_p       Pointer to the archive                      */
+    struct  archive_t       *   archive_p;
+    /**
+     *  @param  type            What kind of archive this is                */
+    enum    archive_type_e      type;
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+    //  Can it be read ?
+    type = archive_type( data_p, data_l );
+
+    if ( type == ARCHIVE_TYPE_NONE )
+    {
+        //  NO:     Don't bother
+        return( NULL );
+    }
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    //  Allocate the archive
+    archive_p = mem_malloc( sizeof( struct archive_t ) );
+    memset( archive_p, 0x00, sizeof( struct archive_t ) );
+    archive_p->type     = type;
+    archive_p->file_fd  = -1;
+    archive_p->parent_p = parent_p;
+    strncpy( archive_p->name, member_name_p, sizeof( archive_p->name ) - 1 );
+
+    //  Keep the bytes that were already read
+    archive_p->pre_p = mem_malloc( data_l );
+    archive_p->pre_l = data_l;
+    memcpy( archive_p->pre_p, data_p, data_l );
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+    return( archive_p );
+}
+
+/****************************************************************************/
+/**
+ *  Move to the next member of an archive.
+ *
+ *  @param  archive_p           Pointer to the archive
+ *  @param  member_name_p       Where to put the member name
+ *  @param  member_name_l       Size of the member name buffer
+ *
+ *  @return next_rc             TRUE when a member is ready to be read
+ *                              FALSE when there are no more members
+ *
+ *  @note
+ *      A GZIP, BZIP2 or XZ file has one member; its name is the name of
+ *      the archive without the '.gz', '.bz2' or '.xz'.  Whatever is left
+ *      of the previous member is skipped.
+ *
+ ****************************************************************************/
+
+int
+archive_next(
+    struct  archive_t       *   archive_p,
+    char                    *   member_name_p,
+    int                         member_name_l
+    )
+{
+    /**
+     *  @param  next_rc         Return code                                 */
+    int                         next_rc;
+    /**
+     *  @param  base_p          The name without the directory              */
+    char                    *   base_p;
+    /**
+     *  @param  dot_p           Start of the file name suffix               */
+    char                    *   dot_p;
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+    //  Has something gone wrong ?
+    if ( archive_p->member_error == true )
+    {
+        //  YES:    There is nothing more to read
+        return( false );
+    }
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    //  Is this a ZIP file ?
+    if ( archive_p->type == ARCHIVE_TYPE_ZIP )
+    {
+        //  YES:    Find the next local header
+        next_rc = ARCHIVE__zip_next( archive_p, member_name_p, member_name_l );
+    }
+    else
+    if ( archive_p->member_count != 0 )
+    {
+        //  Single member formats only have one
+        next_rc = false;
+    }
+    else
+    {
+        //  Start the decompressor
+        switch( archive_p->type )
+        {
+            case    ARCHIVE_TYPE_GZIP:
+            {
+                inflateInit2( &archive_p->gz_stream, MAX_WBITS + 16 );
+            }   break;
+
+            case    ARCHIVE_TYPE_BZIP2:
+            {
+                BZ2_bzDecompressInit( &archive_p->bz2_stream, 0, 0 );
+            }   break;
+
+            default:
+            {
+                archive_p->xz_stream = (lzma_stream)LZMA_STREAM_INIT;
+                lzma_stream_decoder( &archive_p->xz_stream, UINT64_MAX,
+                                     LZMA_CONCATENATED );
+            }   break;
+        }
+        archive_p->stream_init = true;
+        archive_p->member_open = true;
+
+        //  The member name is the archive name without the suffix
+        base_p = strrchr( archive_p->name, '/' );
+        base_p = ( base_p != NULL ) ? base_p + 1 : archive_p->name;
+        snprintf( member_name_p, member_name_l, "%s", base_p );
+
+        dot_p = strrchr( member_name_p, '.' );
+        if (    ( dot_p != NULL )
+             && (    ( strcasecmp( dot_p, ".gz"  ) == 0 )
+                  || ( strcasecmp( dot_p, ".bz2" ) == 0 )
+                  || ( strcasecmp( dot_p, ".xz"  ) == 0 ) ) )
+        {
+            dot_p[ 0 ] = '\0';
+        }
+
+        next_rc = true;
+    }
+
+    //  Count it
+    if ( next_rc == true )
+    {
+        archive_p->member_count += 1;
+    }
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+    return( next_rc );
+}
+
+/****************************************************************************/
+/**
+ *  Read from the current member of an archive.
+ *
+ *  @param  archive_p           Pointer to the archive
+ *  @param  data_p              Where to put the data
+ *  @param  data_l              Size of the data buffer
+ *
+ *  @return read_l              Number of bytes read; 0 at the end of the
+ *                              member; -1 when the archive is damaged.
+ *
+ *  @note
+ *
+ ****************************************************************************/
+
+ssize_t
+archive_read(
+    struct  archive_t       *   archive_p,
+    void                    *   data_p,
+    size_t                      data_l
+    )
+{
+    /**
+     *  @param  read_l          Number of bytes read                        */
+    ssize_t                     read_l;
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+    //  Is there anything left to read ?
+    if (    ( archive_p->member_open == false )
+         || ( archive_p->member_end  == true  )
+         || ( data_l                 == 0     ) )
+    {
+        //  NO:     End of the member
+        return( 0 );
+    }
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    //  Is it a stored ZIP member ?
+    if (    ( archive_p->type       == ARCHIVE_TYPE_ZIP   )
+         && ( archive_p->zip_method == ZIP_METHOD_STORED ) )
+    {
+        //  YES:    Copy it
+        read_l = ARCHIVE__stored( archive_p, data_p, data_l );
+    }
+    else
+    {
+        //  NO:     Decompress it
+        read_l = ARCHIVE__inflate( archive_p, data_p, data_l );
+    }
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+    return( read_l );
+}
+
+/****************************************************************************/
+/**
+ *  Close an archive.
+ *
+ *  @param  archive_p           Pointer to the archive
+ *
+ *  @return void                No information is returned
+ *
+ *  @note
+ *      Closing an archive that was opened inside another one leaves the
+ *      parent where it is; archive_next( ) on the parent skips the rest.
+ *
+ ****************************************************************************/
+
+void
+archive_close(
+    struct  archive_t       *   archive_p
+    )
+{
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    //  Release the decompressor
+    ARCHIVE__end( archive_p );
+
+    //  Close the file
+    if ( archive_p->file_fd >= 0 )
+    {
+        close( archive_p->file_fd );
+    }
+
+    //  Release the bytes read before the open
+    if ( archive_p->pre_p != NULL )
+    {
+        mem_free( archive_p->pre_p );
+    }
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  Release the archive
+    mem_free( archive_p );
+
+    //  DONE!
+}
+/****************************************************************************/
@@ -0,0 +1,833 @@
+/*******************************  COPYRIGHT  ********************************/
+/**
+ *  Author? "Gregory N. Leonhardt"
+ *  License? "CC BY-NC 2.0"
+ *           "https://creativecommons.org/licenses/by-nc/2.0/"
+ *
+ ****************************************************************************/
+
+/******************************** JAVADOC ***********************************/
+/**
+ *  This file contains private functions that makeup the internal
+ *  library components of the 'archive' library.
+ *
+ *  @note
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ *  Compiler directives
+ ****************************************************************************/
+
+
+/****************************************************************************
+ * System Function API
+ ****************************************************************************/
+
+                                //*******************************************
+#include <stdint.h>             //  Alternative storage types
+#include <stdbool.h>            //  TRUE, FALSE, etc.
+#include <stdio.h>              //  Standard I/O definitions
+                                //*******************************************
+#include <string.h>             //  Functions for managing strings
+#include <unistd.h>             //  read( )
+                                //*******************************************
+
+/****************************************************************************
+ * Application APIs
+ ****************************************************************************/
+
+                                //*******************************************
+#include "global.h"             //  Global stuff for this application
+#include "libtools_api.h"       //  My Tools Library
+                                //*******************************************
+#include "archive_api.h"        //  API for all archive_*           PUBLIC
+#include "archive_lib.h"        //  API for all ARCHIVE__*          PRIVATE
+                                //*******************************************
+
+/****************************************************************************
+ * Enumerations local to this file
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Definitions local to this file
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+#define LE16( p )               (   (uint32_t)(p)[ 0 ]                      \
+                                  | (uint32_t)(p)[ 1 ] <<  8 )
+#define LE32( p )               (   (uint32_t)(p)[ 0 ]                      \
+                                  | (uint32_t)(p)[ 1 ] <<  8                \
+                                  | (uint32_t)(p)[ 2 ] << 16                \
+                                  | (uint32_t)(p)[ 3 ] << 24 )
+#define LE64( p )               (   (uint64_t)LE32( p )                     \
+                                  | (uint64_t)LE32( (p) + 4 ) << 32 )
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Structures local to this file
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Storage Allocation local to this file
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * LIB Functions
+ ****************************************************************************/
+
+/****************************************************************************/
+/**
+ *  Read more compressed input.
+ *
+ *  @param  archive_p           Pointer to the archive
+ *
+ *  @return fill_rc             TRUE when more input was added to the buffer
+ *                              FALSE at the end of the input
+ *
+ *  @note
+ *      Input comes from the bytes that were read before the archive was
+ *      opened, then from the file or the parent archive member.
+ *
+ ****************************************************************************/
+
+int
+ARCHIVE__fill(
+    struct  archive_t       *   archive_p
+    )
+{
+    /**
+     *  @param  space_l         Room left in the buffer                     */
+    size_t                      space_l;
+    /**
+     *  @param  read_l          Number of bytes read                        */
+    ssize_t                     read_l;
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+    //  Is there any more input ?
+    if ( archive_p->in_eof == true )
+    {
+        //  NO:     Nothing to add
+        return( false );
+    }
+
+    //  Move the unused input to the front of the buffer
+    if ( archive_p->in_ndx != 0 )
+    {
+        memmove( archive_p->in_buf,
+                 &archive_p->in_buf[ archive_p->in_ndx ],
+                 archive_p->in_l - archive_p->in_ndx );
+        archive_p->in_l  -= archive_p->in_ndx;
+        archive_p->in_ndx = 0;
+    }
+    space_l = sizeof( archive_p->in_buf ) - archive_p->in_l;
+
+    //  Is the buffer full ?
+    if ( space_l == 0 )
+    {
+        //  YES:    Nothing to add but there is input
+        return( true );
+    }
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    //  Is there anything left from before the open ?
+    if ( archive_p->pre_ndx < archive_p->pre_l )
+    {
+        //  YES:    Use it first
+        read_l = archive_p->pre_l - archive_p->pre_ndx;
+        if ( read_l > (ssize_t)space_l )
+        {
+            read_l = space_l;
+        }
+        memcpy( &archive_p->in_buf[ archive_p->in_l ],
+                &archive_p->pre_p[ archive_p->pre_ndx ], read_l );
+        archive_p->pre_ndx += read_l;
+    }
+    else
+    if ( archive_p->file_fd >= 0 )
+    {
+        //  Read the file
+        read_l = read( archive_p->file_fd,
+                       &archive_p->in_buf[ archive_p->in_l ], space_l );
+    }
+    else
+    {
+        //  Read the parent archive member
+        read_l = archive_read( archive_p->parent_p,
+                               &archive_p->in_buf[ archive_p->in_l ], space_l );
+    }
+
+    //  Was anything read ?
+    if ( read_l <= 0 )
+    {
+        //  NO:     That is all there is
+        archive_p->in_eof = true;
+        return( false );
+    }
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  Add it to the buffer
+    archive_p->in_l += read_l;
+
+    //  DONE!
+    return( true );
+}
+
+/****************************************************************************/
+/**
+ *  Take an exact number of bytes from the compressed input.
+ *
+ *  @param  archive_p           Pointer to the archive
+ *  @param  data_p              Where to put the bytes ( NULL = skip them )
+ *  @param  data_l              Number of bytes
+ *
+ *  @return get_rc              TRUE when all of the bytes were there
+ *
+ *  @note
+ *
+ ****************************************************************************/
+
+int
+ARCHIVE__get(
+    struct  archive_t       *   archive_p,
+    unsigned char           *   data_p,
+    size_t                      data_l
+    )
+{
+    /**
+     *  @param  copy_l          Number of bytes taken from the buffer       */
+    size_t                      copy_l;
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    while ( data_l > 0 )
+    {
+        //  Is the buffer empty ?
+        if (    ( archive_p->in_ndx == archive_p->in_l )
+             && ( ARCHIVE__fill( archive_p ) == false ) )
+        {
+            //  YES:    and there is no more input
+            return( false );
+        }
+
+        //  Take what is there
+        copy_l = archive_p->in_l - archive_p->in_ndx;
+        if ( copy_l > data_l )
+        {
+            copy_l = data_l;
+        }
+
+        if ( data_p != NULL )
+        {
+            memcpy( data_p, &archive_p->in_buf[ archive_p->in_ndx ], copy_l );
+            data_p += copy_l;
+        }
+
+        archive_p->in_ndx += copy_l;
+        data_l            -= copy_l;
+    }
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+    return( true );
+}
+
+/****************************************************************************/
+/**
+ *  Move to the next member of a ZIP file.
+ *
+ *  @param  archive_p           Pointer to the archive
+ *  @param  member_name_p       Where to put the member name
+ *  @param  member_name_l       Size of the member name buffer
+ *
+ *  @return next_rc             TRUE when a member is ready to be read
+ *
+ *  @note
+ *      The local headers are read in order, so the central directory at
+ *      the end of the file is never needed (and the file doesn't have to
+ *      be seekable).  Encrypted members and members that are neither
+ *      stored nor deflated are skipped.  When such a member has its sizes
+ *      after the data there is no way to find the next member, so that
+ *      is where the archive ends.
+ *      A member with a ZIP64 extra field has 64 bit sizes, both in that
+ *      field and in the data descriptor after its data.
+ *
+ ****************************************************************************/
+
+int
+ARCHIVE__zip_next(
+    struct  archive_t       *   archive_p,
+    char                    *   member_name_p,
+    int                         member_name_l
+    )
+{
+    /**
+     *  @param  header          Local file header ( less the signature )    */
+    unsigned char               header[ ZIP_HEADER_L ];
+    /**
+     *  @param  signature       Record signature                            */
+    unsigned char               signature[ 4 ];
+    /**
+     *  @param  drain           Unread data from the previous member        */
+    unsigned char               drain[ 4096 ];
+    /**
+     *  @param  packed_l        Compressed size                             */
+    size_t                      packed_l;
+    /**
+     *  @param  name_l          File name length                            */
+    size_t                      name_l;
+    /**
+     *  @param  extra_l         Extra field length                          */
+    size_t                      extra_l;
+    /**
+     *  @param  copy_l          Part of the file name that fits             */
+    size_t                      copy_l;
+    /**
+     *  @param  field           One extra field record ( id, size, data )   */
+    unsigned char               field[ 16 ];
+    /**
+     *  @param  field_l         Extra field record data length              */
+    size_t                      field_l;
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+    //  Is a member still open ?
+    if ( archive_p->member_open == true )
+    {
+        //  YES:    Read past the rest of it
+        while ( archive_read( archive_p, drain, sizeof( drain ) ) > 0 )
+        {
+        }
+
+        //  Did it end cleanly ?
+        if ( archive_p->member_error == true )
+        {
+            //  NO:     The next header can't be found
+            return( false );
+        }
+
+        //  Do the sizes follow the data ?
+        if ( ( archive_p->zip_flags & ZIP_FLAG_DESCRIPTOR ) != 0 )
+        {
+            //  YES:    Skip them ( the signature is optional ).  A CRC
+            //          and two sizes that are 8 bytes each for ZIP64.
+            if ( ARCHIVE__get( archive_p, signature, 4 ) == false )
+            {
+                return( false );
+            }
+            ARCHIVE__get( archive_p, NULL,
+                          ( ( memcmp( signature, "PK\x07\x08", 4 ) == 0 ) ? 4 : 0 )
+                        + ( ( archive_p->zip64 == true ) ? 16 : 8 ) );
+        }
+
+        archive_p->member_open = false;
+    }
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    //  Until a member that can be read is found
+    while ( true )
+    {
+        //  Is there another local file header ?
+        if (    ( ARCHIVE__get( archive_p, signature, 4 ) == false )
+             || ( memcmp( signature, "PK\x03\x04", 4 )    != 0     )
+             || ( ARCHIVE__get( archive_p, header, sizeof( header ) ) == false ) )
+        {
+            //  NO:     The central directory (or the end of the file)
+            return( false );
+        }
+
+        //  Pick out the fields
+        archive_p->zip_flags  = LE16( &header[  2 ] );
+        archive_p->zip_method = LE16( &header[  4 ] );
+        packed_l              = LE32( &header[ 14 ] );
+        name_l                = LE16( &header[ 22 ] );
+        extra_l               = LE16( &header[ 24 ] );
+
+        //  The file name (cut to fit)
+        copy_l = name_l;
+        if ( copy_l > (size_t)( member_name_l - 1 ) )
+        {
+            copy_l = member_name_l - 1;
+        }
+        if (    ( ARCHIVE__get( archive_p, (unsigned char *)member_name_p, copy_l ) == false )
+             || ( ARCHIVE__get( archive_p, NULL, name_l - copy_l )                  == false ) )
+        {
+            return( false );
+        }
+        member_name_p[ copy_l ] = '\0';
+
+        //  Look through the extra field for ZIP64 sizes
+        archive_p->zip64 = false;
+        while ( extra_l >= 4 )
+        {
+            //  Record id and size
+            if ( ARCHIVE__get( archive_p, field, 4 ) == false )
+            {
+                return( false );
+            }
+            field_l  = LE16( &field[ 2 ] );
+            extra_l -= 4;
+            if ( field_l > extra_l )
+            {
+                field_l = extra_l;
+            }
+            extra_l -= field_l;
+
+            //  Is it the ZIP64 record ?
+            if ( LE16( &field[ 0 ] ) == ZIP_EXTRA_ZIP64 )
+            {
+                //  YES:    The local header has both sizes, uncompressed first
+                archive_p->zip64 = true;
+
+                if ( field_l >= 16 )
+                {
+                    if ( ARCHIVE__get( archive_p, field, 16 ) == false )
+                    {
+                        return( false );
+                    }
+                    field_l -= 16;
+
+                    if ( packed_l == 0xFFFFFFFF )
+                    {
+                        packed_l = LE64( &field[ 8 ] );
+                    }
+                }
+            }
+
+            //  Skip the rest of the record
+            if ( ARCHIVE__get( archive_p, NULL, field_l ) == false )
+            {
+                return( false );
+            }
+        }
+
+        //  Skip anything left over
+        if ( ARCHIVE__get( archive_p, NULL, extra_l ) == false )
+        {
+            return( false );
+        }
+
+        //  Can this member be read ?
+        if (    ( ( archive_p->zip_flags & ZIP_FLAG_ENCRYPTED ) == 0 )
+             && (    ( archive_p->zip_method == ZIP_METHOD_DEFLATED )
+                  || (    ( archive_p->zip_method == ZIP_METHOD_STORED )
+                       && ( ( archive_p->zip_flags & ZIP_FLAG_DESCRIPTOR ) == 0 )
+                       && ( packed_l != 0xFFFFFFFF ) ) ) )
+        {
+            //  YES:    Done looking
+            break;
+        }
+
+        //  NO:     Log it
+        log_write( MID_WARNING, "archive",
+                   "Unable to read member '%s' of '%s' (method %d, flags %04X)\n",
+                   member_name_p, archive_p->name,
+                   archive_p->zip_method, archive_p->zip_flags );
+
+        //  Can it be skipped ?
+        if (    ( ( archive_p->zip_flags & ZIP_FLAG_DESCRIPTOR ) != 0 )
+             || ( ARCHIVE__get( archive_p, NULL, packed_l ) == false ) )
+        {
+            //  NO:     The rest of the archive is lost
+            return( false );
+        }
+    }
+
+    //  Get ready to read the member
+    archive_p->zip_remaining = packed_l;
+    archive_p->member_open   = true;
+    archive_p->member_end    = false;
+
+    //  Is the member compressed ?
+    if ( archive_p->zip_method == ZIP_METHOD_DEFLATED )
+    {
+        //  YES:    Raw deflate ( no header or trailer )
+        if ( archive_p->stream_init == false )
+        {
+            inflateInit2( &archive_p->gz_stream, -MAX_WBITS );
+            archive_p->stream_init = true;
+        }
+        else
+        {
+            inflateReset( &archive_p->gz_stream );
+        }
+    }
+    else
+    if ( packed_l == 0 )
+    {
+        //  Stored and empty
+        archive_p->member_end = true;
+    }
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+    return( true );
+}
+
+/****************************************************************************/
+/**
+ *  Read from a ZIP member that is stored (not compressed).
+ *
+ *  @param  archive_p           Pointer to the archive
+ *  @param  data_p              Where to put the data
+ *  @param  data_l              Size of the data buffer
+ *
+ *  @return read_l              Number of bytes read; -1 when the archive
+ *                              is cut short
+ *
+ *  @note
+ *
+ ****************************************************************************/
+
+ssize_t
+ARCHIVE__stored(
+    struct  archive_t       *   archive_p,
+    unsigned char           *   data_p,
+    size_t                      data_l
+    )
+{
+    /**
+     *  @param  copy_l          Number of bytes taken from the buffer       */
+    size_t                      copy_l;
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+    //  Is the buffer empty ?
+    if (    ( archive_p->in_ndx == archive_p->in_l )
+         && ( ARCHIVE__fill( archive_p ) == false ) )
+    {
+        //  YES:    and there is no more input
+        log_write( MID_WARNING, "archive",
+                   "Archive '%s' is cut short\n", archive_p->name );
+        archive_p->member_error = true;
+        archive_p->member_end   = true;
+        return( -1 );
+    }
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    //  Take what is there (but no more than the member holds)
+    copy_l = archive_p->in_l - archive_p->in_ndx;
+    if ( copy_l > data_l )
+    {
+        copy_l = data_l;
+    }
+    if ( copy_l > archive_p->zip_remaining )
+    {
+        copy_l = archive_p->zip_remaining;
+    }
+
+    memcpy( data_p, &archive_p->in_buf[ archive_p->in_ndx ], copy_l );
+    archive_p->in_ndx        += copy_l;
+    archive_p->zip_remaining -= copy_l;
+
+    //  Is that the end of the member ?
+    if ( archive_p->zip_remaining == 0 )
+    {
+        //  YES:    Remember it
+        archive_p->member_end = true;
+    }
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+    return( copy_l );
+}
+
+/****************************************************************************/
+/**
+ *  Read from a compressed member.
+ *
+ *  @param  archive_p           Pointer to the archive
+ *  @param  data_p              Where to put the data
+ *  @param  data_l              Size of the data buffer
+ *
+ *  @return read_l              Number of bytes read; 0 at the end of the
+ *                              member; -1 when the data is damaged or cut
+ *                              short
+ *
+ *  @note
+ *      Concatenated GZIP and BZIP2 streams (pigz, pbzip2) are read as one
+ *      member, XZ does the same thing by itself.
+ *
+ ****************************************************************************/
+
+ssize_t
+ARCHIVE__inflate(
+    struct  archive_t       *   archive_p,
+    unsigned char           *   data_p,
+    size_t                      data_l
+    )
+{
+    /**
+     *  @param  read_l          Number of bytes read                        */
+    size_t                      read_l;
+    /**
+     *  @param  in_l            Compressed bytes available                  */
+    size_t                      in_l;
+    /**
+     *  @param  left_l          Compressed bytes not used                   */
+    size_t                      left_l;
+    /**
+     *  @param  out_l           Output space not used                       */
+    size_t                      out_l;
+    /**
+     *  @param  stream_end      TRUE at the end of a compressed stream      */
+    int                         stream_end;
+    /**
+     *  @param  stream_error    TRUE when the data is damaged               */
+    int                         stream_error;
+    /**
+     *  @param  z_rc            zlib return code                            */
+    int                         z_rc;
+    /**
+     *  @param  xz_rc           liblzma return code                         */
+    lzma_ret                    xz_rc;
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+    //  Nothing read yet
+    read_l = 0;
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    while (    ( read_l                == 0     )
+            && ( archive_p->member_end == false ) )
+    {
+        //  Is the input buffer empty ?
+        if ( archive_p->in_ndx == archive_p->in_l )
+        {
+            //  YES:    Get some more
+            ARCHIVE__fill( archive_p );
+        }
+        in_l         = archive_p->in_l - archive_p->in_ndx;
+        stream_end   = false;
+        stream_error = false;
+
+        switch( archive_p->type )
+        {
+            case    ARCHIVE_TYPE_ZIP:
+            case    ARCHIVE_TYPE_GZIP:
+            {
+                archive_p->gz_stream.next_in   = &archive_p->in_buf[ archive_p->in_ndx ];
+                archive_p->gz_stream.avail_in  = in_l;
+                archive_p->gz_stream.next_out  = data_p;
+                archive_p->gz_stream.avail_out = data_l;
+
+                z_rc = inflate( &archive_p->gz_stream, Z_NO_FLUSH );
+
+                left_l       = archive_p->gz_stream.avail_in;
+                out_l        = archive_p->gz_stream.avail_out;
+                stream_end   = ( z_rc == Z_STREAM_END );
+                stream_error = ( ( z_rc != Z_OK ) && ( z_rc != Z_STREAM_END )
+                                                  && ( z_rc != Z_BUF_ERROR ) );
+            }   break;
+
+            case    ARCHIVE_TYPE_BZIP2:
+            {
+                archive_p->bz2_stream.next_in   = (char *)&archive_p->in_buf[ archive_p->in_ndx ];
+                archive_p->bz2_stream.avail_in  = in_l;
+                archive_p->bz2_stream.next_out  = (char *)data_p;
+                archive_p->bz2_stream.avail_out = data_l;
+
+                z_rc = BZ2_bzDecompress( &archive_p->bz2_stream );
+
+                left_l       = archive_p->bz2_stream.avail_in;
+                out_l        = archive_p->bz2_stream.avail_out;
+                stream_end   = ( z_rc == BZ_STREAM_END );
+                stream_error = ( ( z_rc != BZ_OK ) && ( z_rc != BZ_STREAM_END ) );
+            }   break;
+
+            default:
+            {
+                archive_p->xz_stream.next_in   = &archive_p->in_buf[ archive_p->in_ndx ];
+                archive_p->xz_stream.avail_in  = in_l;
+                archive_p->xz_stream.next_out  = data_p;
+                archive_p->xz_stream.avail_out = data_l;
+
+                xz_rc = lzma_code( &archive_p->xz_stream,
+                                   ( archive_p->in_eof == true ) ? LZMA_FINISH : LZMA_RUN );
+
+                left_l       = archive_p->xz_stream.avail_in;
+                out_l        = archive_p->xz_stream.avail_out;
+                stream_end   = ( xz_rc == LZMA_STREAM_END );
+                stream_error = ( ( xz_rc != LZMA_OK ) && ( xz_rc != LZMA_STREAM_END )
+                                                      && ( xz_rc != LZMA_BUF_ERROR ) );
+            }   break;
+        }
+
+        //  Account for what was used and what was made
+        archive_p->in_ndx += ( in_l - left_l );
+        read_l             = data_l - out_l;
+
+        //  Is this the end of a compressed stream ?
+        if ( stream_end == true )
+        {
+            //  YES:    Make sure the next few bytes are in the buffer
+            if (    ( archive_p->type                     != ARCHIVE_TYPE_ZIP )
+                 && ( archive_p->in_l - archive_p->in_ndx <  4                ) )
+            {
+                ARCHIVE__fill( archive_p );
+            }
+
+            //  Is another GZIP or BZIP2 stream glued on ?
+            if (    ( archive_p->type != ARCHIVE_TYPE_ZIP )
+                 && ( archive_p->type != ARCHIVE_TYPE_XZ  )
+                 && ( archive_type( &archive_p->in_buf[ archive_p->in_ndx ],
+                                    archive_p->in_l - archive_p->in_ndx )
+                      == archive_p->type ) )
+            {
+                //  YES:    Start it
+                if ( archive_p->type == ARCHIVE_TYPE_GZIP )
+                {
+                    inflateReset( &archive_p->gz_stream );
+                }
+                else
+                {
+                    BZ2_bzDecompressEnd( &archive_p->bz2_stream );
+                    BZ2_bzDecompressInit( &archive_p->bz2_stream, 0, 0 );
+                }
+            }
+            else
+            {
+                //  NO:     That's the end of the member
+                archive_p->member_end = true;
+            }
+        }
+
+        //  Is the data damaged or cut short ?
+        else
+        if (    ( stream_error == true )
+             || (    ( read_l            == 0    )
+                  && ( archive_p->in_eof == true )
+                  && ( archive_p->in_ndx == archive_p->in_l ) ) )
+        {
+            //  YES:    Give up on it
+            log_write( MID_WARNING, "archive",
+                       "Archive '%s' is damaged or cut short\n",
+                       archive_p->name );
+            archive_p->member_error = true;
+            archive_p->member_end   = true;
+
+            if ( read_l == 0 )
+            {
+                return( -1 );
+            }
+        }
+    }
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+    return( read_l );
+}
+
+/****************************************************************************/
+/**
+ *  Release the decompressor.
+ *
+ *  @param  archive_p           Pointer to the archive
+ *
+ *  @return void                No information is returned
+ *
+ *  @note
+ *
+ ****************************************************************************/
+
+void
+ARCHIVE__end(
+    struct  archive_t       *   archive_p
+    )
+{
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+    //  Was the decompressor ever started ?
+    if ( archive_p->stream_init == false )
+    {
+        //  NO:     Nothing to release
+        return;
+    }
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    switch( archive_p->type )
+    {
+        case    ARCHIVE_TYPE_ZIP:
+        case    ARCHIVE_TYPE_GZIP:
+        {
+            inflateEnd( &archive_p->gz_stream );
+        }   break;
+
+        case    ARCHIVE_TYPE_BZIP2:
+        {
+            BZ2_bzDecompressEnd( &archive_p->bz2_stream );
+        }   break;
+
+        default:
+        {
+            lzma_end( &archive_p->xz_stream );
+        }   break;
+    }
+
+    archive_p->stream_init = false;
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+}
+/****************************************************************************/
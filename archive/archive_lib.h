@@ -0,0 +1,207 @@
+/*******************************  COPYRIGHT  ********************************/
+/**
+ *  Author? "Gregory N. Leonhardt"
+ *  License? "CC BY-NC 2.0"
+ *           "https://creativecommons.org/licenses/by-nc/2.0/"
+ *
+ ****************************************************************************/
+
+#ifndef ARCHIVE_LIB_H
+#define ARCHIVE_LIB_H
+
+/******************************** JAVADOC ***********************************/
+/**
+ *  This file contains private definitions (etc.) that apply to internal
+ *  library components of the 'archive' library.
+ *
+ *  @note
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ *  Compiler directives
+ ****************************************************************************/
+
+#ifdef ALLOC_ARCHIVE
+   #define ARCHIVE_EXT
+#else
+   #define ARCHIVE_EXT      extern
+#endif
+
+/****************************************************************************
+ * System APIs
+ ****************************************************************************/
+
+                                //*******************************************
+#include <stdio.h>              //  FILENAME_MAX
+#include <zlib.h>               //  inflate( )
+#include <bzlib.h>              //  BZ2_bzDecompress( )
+#include <lzma.h>               //  lzma_code( )
+                                //*******************************************
+
+/****************************************************************************
+ * Application APIs
+ ****************************************************************************/
+
+                                //*******************************************
+                                //*******************************************
+
+/****************************************************************************
+ * Library Private Definitions
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+#define ARCHIVE_BUF_L           ( 64 * 1024 )
+//----------------------------------------------------------------------------
+#define ZIP_FLAG_ENCRYPTED      ( 0x0001 )  //  Member is encrypted
+#define ZIP_FLAG_DESCRIPTOR     ( 0x0008 )  //  Sizes follow the data
+//----------------------------------------------------------------------------
+#define ZIP_METHOD_STORED       (    0 )
+#define ZIP_METHOD_DEFLATED     (    8 )
+//----------------------------------------------------------------------------
+#define ZIP_HEADER_L            (   26 )    //  Local header less signature
+#define ZIP_EXTRA_ZIP64         ( 0x0001 )  //  Extra field with 64 bit sizes
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Library Private Enumerations
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Library Private Structures
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+/**
+ *  @param  archive_t           An open archive                             */
+struct  archive_t
+{
+    /**
+     *  @param  type            What kind of archive this is                */
+    enum    archive_type_e      type;
+    /**
+     *  @param  name            Archive name ( for single member formats )  */
+    char                        name[ FILENAME_MAX ];
+    /**
+     *  @param  file_fd         Input file ( -1 = read from parent_p )      */
+    int                         file_fd;
+    /**
+     *  @param  parent_p        Archive member this archive is inside of    */
+    struct  archive_t       *   parent_p;
+    /**
+     *  @param  pre_p           Bytes read from the parent before the open  */
+    unsigned char           *   pre_p;
+    /**
+     *  @param  pre_l           Number of bytes in pre_p                    */
+    int                         pre_l;
+    /**
+     *  @param  pre_ndx         Next byte to take from pre_p                */
+    int                         pre_ndx;
+    /**
+     *  @param  in_buf          Compressed input                            */
+    unsigned char               in_buf[ ARCHIVE_BUF_L ];
+    /**
+     *  @param  in_ndx          Next unused byte in in_buf                  */
+    size_t                      in_ndx;
+    /**
+     *  @param  in_l            Number of bytes in in_buf                   */
+    size_t                      in_l;
+    /**
+     *  @param  in_eof          TRUE when the input is used up              */
+    int                         in_eof;
+    /**
+     *  @param  member_count    Number of members opened                    */
+    int                         member_count;
+    /**
+     *  @param  member_open     TRUE while a member is being read           */
+    int                         member_open;
+    /**
+     *  @param  member_end      TRUE at the end of the member               */
+    int                         member_end;
+    /**
+     *  @param  member_error    TRUE when the archive can't be read further */
+    int                         member_error;
+    /**
+     *  @param  zip_flags       ZIP general purpose flags                   */
+    int                         zip_flags;
+    /**
+     *  @param  zip_method      ZIP compression method                      */
+    int                         zip_method;
+    /**
+     *  @param  zip64           TRUE when the member has 64 bit sizes       */
+    int                         zip64;
+    /**
+     *  @param  zip_remaining   Stored bytes not read yet                   */
+    size_t                      zip_remaining;
+    /**
+     *  @param  stream_init     TRUE once the decompressor was initialized  */
+    int                         stream_init;
+    /**
+     *  @param  gz_stream       ZIP and GZIP decompressor                   */
+    z_stream                    gz_stream;
+    /**
+     *  @param  bz2_stream      BZIP2 decompressor                          */
+    bz_stream                   bz2_stream;
+    /**
+     *  @param  xz_stream       XZ decompressor                             */
+    lzma_stream                 xz_stream;
+};
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Library Private Storage Allocation
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Library Private Prototypes
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+int
+ARCHIVE__fill(
+    struct  archive_t       *   archive_p
+    );
+//----------------------------------------------------------------------------
+int
+ARCHIVE__get(
+    struct  archive_t       *   archive_p,
+    unsigned char           *   data_p,
+    size_t                      data_l
+    );
+//----------------------------------------------------------------------------
+int
+ARCHIVE__zip_next(
+    struct  archive_t       *   archive_p,
+    char                    *   member_name_p,
+    int                         member_name_l
+    );
+//----------------------------------------------------------------------------
+ssize_t
+ARCHIVE__stored(
+    struct  archive_t       *   archive_p,
+    unsigned char           *   data_p,
+    size_t                      data_l
+    );
+//----------------------------------------------------------------------------
+ssize_t
+ARCHIVE__inflate(
+    struct  archive_t       *   archive_p,
+    unsigned char           *   data_p,
+    size_t                      data_l
+    );
+//----------------------------------------------------------------------------
+void
+ARCHIVE__end(
+    struct  archive_t       *   archive_p
+    );
+//----------------------------------------------------------------------------
+
+/****************************************************************************/
+
+#endif                      //    ARCHIVE_LIB_H
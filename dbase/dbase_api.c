@@ -35,6 +35,7 @@
 #include <stdlib.h>             //  ANSI standard library.
 #include <string.h>             //  Functions for managing strings
 #include <unistd.h>             //  Access to the POSIX operating system API
+#include <pthread.h>            //  POSIX threads
 #include <mysql/mysql.h>        //  MySQL API
                                 //*******************************************
 
@@ -82,6 +83,11 @@
  * @param con               MySQL connector                                 */
 MYSQL                       *   con;
 //----------------------------------------------------------------------------
+/**
+ * @param dbase_mutex       Serializes access to the single MySQL connector */
+static
+pthread_mutex_t                 dbase_mutex = PTHREAD_MUTEX_INITIALIZER;
+//----------------------------------------------------------------------------
 
 /****************************************************************************
  * Public API Functions
@@ -170,6 +176,9 @@ dbase_insert(
     //  1)  Name
     //  2)  Ingredients
     //  3)  Directions
+    //  The MySQL connector is shared by every ENCODE thread
+    pthread_mutex_lock( &dbase_mutex );
+
     if (    ( rcb_p->recipe_p->name_p != NULL )
          && ( list_query_count( rcb_p->recipe_p->ingredient_p ) > 0 )
          && ( list_query_count( rcb_p->recipe_p->directions_p ) > 0 ) )
@@ -356,6 +365,9 @@ dbase_insert(
         }
     }
 
+    //  Release the MySQL connector
+    pthread_mutex_unlock( &dbase_mutex );
+
     /************************************************************************
      *  Function Exit
      ************************************************************************/
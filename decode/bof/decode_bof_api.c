@@ -41,6 +41,7 @@
                                 //*******************************************
 #include "tcb_api.h"            //  API for all tcb_*               PUBLIC
 #include "rcb_api.h"            //  API for all rcb_*               PUBLIC
+#include "import_api.h"         //  API for all import_*            PUBLIC
 #include "recipe_api.h"         //  API for all recipe_*            PUBLIC
                                 //*******************************************
 #include "decode_api.h"         //  API for all decode_*            PUBLIC
@@ -73,6 +74,15 @@
  ****************************************************************************/
 
 //----------------------------------------------------------------------------
+/**
+ *  @param  bof_format          Big-Oven
+ *      start   "-= Exported from BigOven =-"
+ *      end     "** This recipe can be pasted...", "** Easy recipe...", "-+-"  */
+struct  decode_format_t         bof_format =
+{
+    RECIPE_FORMAT_BOF,  "BOF",  bof_is_start,   bof_is_end,     decode_bof,
+    "-",    "*-",   { "exported from bigoven" }
+};
 //----------------------------------------------------------------------------
 
 /****************************************************************************
@@ -471,7 +481,7 @@ decode_bof(
         }
 
         //  Free the buffer
-        mem_free( list_data_p );
+        import_line_free( rcb_p, list_data_p );
     }
 
     /************************************************************************
@@ -72,6 +72,7 @@
 //----------------------------------------------------------------------------
 #define RECIPE_ID_L             ( 17 )
 #define MMF_INGRED_L            ( 30 )
+#define DT_PATTERNS             ( 14 )
 //----------------------------------------------------------------------------
 
 /****************************************************************************
@@ -86,6 +87,93 @@
  ****************************************************************************/
 
 //----------------------------------------------------------------------------
+//  Formats that can be named but not (yet) found or decoded.
+//  @ToDo: 3 cp2, erd, grf, gf2, mx2, nyc decode
+static
+struct  decode_format_t         cp2_format = { RECIPE_FORMAT_CP2, "CP2" };
+static
+struct  decode_format_t         erd_format = { RECIPE_FORMAT_ERD, "ERD" };
+static
+struct  decode_format_t         grf_format = { RECIPE_FORMAT_GRF, "GRF" };
+static
+struct  decode_format_t         gf2_format = { RECIPE_FORMAT_GF2, "GF2" };
+//  An MX2 recipe may contain an embedded MXP recipe, so an mxp_is_start( )
+//  must not end one.
+static
+struct  decode_format_t         mx2_format = { RECIPE_FORMAT_MX2, "MX2" };
+static
+struct  decode_format_t         nyc_format = { RECIPE_FORMAT_NYC, "NYC" };
+static
+struct  decode_format_t         txt_format = { RECIPE_FORMAT_TXT, "TXT" };
+/**
+ *  @param  format_table        Every format by format number.  A format is
+ *                              added by adding its decode_format_t here.   */
+static
+struct  decode_format_t     *   format_table[ DECODE_FORMAT_MAX ] =
+{
+    [ RECIPE_FORMAT_BOF ]   =   &bof_format,    //  Big Oven Format
+    [ RECIPE_FORMAT_CP2 ]   =   &cp2_format,    //  Cooken Pro 2.0
+    [ RECIPE_FORMAT_ERD ]   =   &erd_format,    //  Easy Recipe Deluxe
+    [ RECIPE_FORMAT_GRF ]   =   &grf_format,    //  Generic Format #1     [[[[[
+    [ RECIPE_FORMAT_GF2 ]   =   &gf2_format,    //  Generic Format #2     @@@@@
+    [ RECIPE_FORMAT_MMF ]   =   &mmf_format,    //  MealMaster
+    [ RECIPE_FORMAT_MXP ]   =   &mxp_format,    //  MasterCook eXport
+    [ RECIPE_FORMAT_MX2 ]   =   &mx2_format,    //  MasterCook XML
+    [ RECIPE_FORMAT_NYC ]   =   &nyc_format,    //  Now You're Cooking!
+    [ RECIPE_FORMAT_RXF ]   =   &rxf_format,    //  Recipe eXchange Format
+    [ RECIPE_FORMAT_TXT ]   =   &txt_format,    //  Unformatted text data
+};
+//----------------------------------------------------------------------------
+/**
+ *  @param  dt_pattern_table    Every date / time format in the order they
+ *                              are tried.  The rules are for the fields:
+ *                              YY MM DD HH MM SS DOW AP                    */
+static
+struct  decode_dt_pattern_t     dt_pattern_table[ DT_PATTERNS ] =
+{
+    //  YY MM DD HH MM SS                                   #01
+    { "#01", "YMDhms",
+        { DT_OVER_70, DT_VALID, DT_VALID, DT_VALID, DT_VALID, DT_VALID, DT_NONE, DT_NONE } },
+    //  MM DD YY HH MM SS (AP)                              #04
+    { "#04", "MDYhmsA",
+        { DT_VALID, DT_VALID, DT_VALID, DT_VALID, DT_VALID, DT_VALID, DT_NONE, DT_ANY } },
+    //  MM DD YY HH MM   (AP)                               #02
+    { "#02", "MDYhmA",
+        { DT_VALID, DT_VALID, DT_VALID, DT_VALID, DT_VALID, DT_NONE, DT_NONE, DT_ANY } },
+    //  MM DD YY                                            #03
+    { "#03", "MDYhmA",
+        { DT_VALID, DT_VALID, DT_VALID, DT_NONE, DT_NONE, DT_NONE, DT_NONE, DT_BLANK } },
+    //  DD MON YY HH MM (SS)                                #05
+    { "#05", "DNYhms",
+        { DT_VALID, DT_VALID, DT_VALID, DT_VALID, DT_VALID, DT_ANY, DT_NONE, DT_NONE } },
+    //  DOW     DD MON YY HH MM SS AP                       #06
+    { "#06", "WDNYhmsA",
+        { DT_VALID, DT_VALID, DT_VALID, DT_VALID, DT_VALID, DT_VALID, DT_VALID, DT_VALID } },
+    //  DOW     DD MON YY HH MM    AP                       #07
+    { "#07", "WDNYhmA",
+        { DT_VALID, DT_VALID, DT_VALID, DT_VALID, DT_VALID, DT_NONE, DT_VALID, DT_VALID } },
+    //  DOW     DD MON YY HH MM( SS)                        #08
+    { "#08", "WDNYhms",
+        { DT_VALID, DT_VALID, DT_VALID, DT_VALID, DT_VALID, DT_ANY, DT_VALID, DT_NONE } },
+    //  DOW MON DD     YY HH MMam                           @09
+    { "@09", "WNDYhmA",
+        { DT_VALID, DT_VALID, DT_VALID, DT_VALID, DT_VALID, DT_NONE, DT_VALID, DT_VALID } },
+    //  DOW MON DD     YY HH MM SSap                        @10
+    { "@10", "WNDYhmsA",
+        { DT_VALID, DT_VALID, DT_VALID, DT_VALID, DT_VALID, DT_VALID, DT_VALID, DT_VALID } },
+    //  DOW MON DD     YY HH MM                             @11
+    { "@11", "WNDYhms",
+        { DT_VALID, DT_VALID, DT_VALID, DT_VALID, DT_VALID, DT_NONE, DT_VALID, DT_NONE } },
+    //  DOW MON DD        HH MM SS YY                       @12
+    { "@12", "WNDhmsY",
+        { DT_VALID, DT_VALID, DT_VALID, DT_VALID, DT_VALID, DT_VALID, DT_VALID, DT_NONE } },
+    //  DOW MON DD     YY                                   #13
+    { "#13", "WNDYh",
+        { DT_VALID, DT_VALID, DT_VALID, DT_NONE_OR_OVER, DT_NONE, DT_NONE, DT_VALID, DT_NONE } },
+    //      MON DD     YY HH MM    AP                       @14
+    { "@14", "NDYhmA",
+        { DT_VALID, DT_VALID, DT_VALID, DT_VALID, DT_VALID, DT_NONE, DT_NONE, DT_VALID } }
+};
 //----------------------------------------------------------------------------
 
 /****************************************************************************
@@ -116,20 +204,9 @@
  *      Returns:    YYYY-MM-DD HH:MM:SS
  *
  *  @note
- *      Formats:                                            SEQUENCE-ID
- *          YY MM DD HH MM SS                                   #01
- *          MM DD YY HH MM   (AP)                               #02
- *          MM DD YY                                            #03
- *          MM DD YY HH MM SS                                   #04
- *          DD MON YY HH MM (SS)                                #05
- *          DOW     DD MON YY HH MM SS AP                       #06
- *          DOW     DD MON YY HH MM    AP                       #07
- *          DOW     DD MON YY HH MM( SS)                        #08
- *          DOW MON DD     YY HH MMam                           #09
- *          DOW MON DD     YY HH MM                             #10
- *          DOW MON DD        HH MM SS YY                       #11
- *          DOW MON DD     YY                                   #12
- *              MON DD     YY HH MM    AP                       #13
+ *      The formats are listed (in the order they are tried) in
+ *      dt_pattern_table[ ].  The string is broken into tokens once and the
+ *      tokens are matched against each pattern until one fits.
  *
  *  @note
  *      The following formats have been discovered but as there is no
@@ -147,9 +224,6 @@ decode_fmt_datetime(
     char                    *   src_datetime_p
     )
 {
-    /**
-     *  @param  tmp_date_p      Pointer to the temp date string             */
-    char                    *   tmp_datetime_p;
     /**
      *  @param  fmt_date_p      Pointer to the formatted date string        */
     char                    *   fmt_datetime_p;
@@ -157,24 +231,20 @@ decode_fmt_datetime(
      *  @param  decoded         TRUE Dtae & Time have been decoded          */
     int                         decoded;
     /**
-     *  @param                  Date & Time values                          */
-    int                         dt_dow;
-    int                         dt_year;
-    int                         dt_month;
-    int                         dt_day;
-    int                         dt_hour;
-    int                         dt_minute;
-    int                         dt_second;
-    int                         dt_ap;
+     *  @param  token           The date / time tokens                      */
+    struct  decode_dt_token_t   token[ DECODE_DT_TOKENS ];
     /**
-     *  @param  dow             Day-Of-Week                                 */
-    char                        dow[ 10 ];
+     *  @param  token_count     Number of tokens                            */
+    int                         token_count;
     /**
-     *  @param  month           Month abbreviation                          */
-    char                        month[ 10 ];
+     *  @param  text_ndx        The token last used for each text field     */
+    int                         text_ndx[ DT_FIELDS ];
     /**
-     *  @param  ap              AM or PM                                    */
-    char                        ap[ 50 ];
+     *  @param  field           Date & Time values                          */
+    int                         field[ DT_FIELDS ];
+    /**
+     *  @param  ndx             Index into the pattern table                */
+    int                         ndx;
 
     /************************************************************************
      *  Function Initialization
@@ -185,664 +255,60 @@ decode_fmt_datetime(
 
     //  Assume there isn't a valid date string present
     fmt_datetime_p = NULL;
-    dt_dow = dt_year = dt_month = dt_day = dt_hour = dt_minute = dt_second = dt_ap     = -1;
-
-    //  Clear the text buffers
-    memset( dow,   '\0', sizeof( dow   ) );
-    memset( month, '\0', sizeof( month ) );
-    memset( ap,    '\0', sizeof( ap    ) );
-
-    /************************************************************************
-     *  Copy the Date/Time string and remove punctuation characters
-     ************************************************************************/
-
-    //  Allocate a temporary data buffer
-    tmp_datetime_p = mem_malloc( strlen( src_datetime_p ) + 1 );
-
-    //  Copy the source Date/Time into the temporary buffer
-    memcpy( tmp_datetime_p, src_datetime_p, strlen( src_datetime_p ) );
-
-    //  ":"
-    fmt_datetime_p = tmp_datetime_p;
-    do
-    {
-        //  Scan for a 'Colon' ':' character
-        fmt_datetime_p = strchr( fmt_datetime_p, ':' );
-        if ( fmt_datetime_p != NULL ) fmt_datetime_p[ 0 ] = ' ';
-    }   while( fmt_datetime_p != NULL );
-
-    //  "/"
-    fmt_datetime_p = tmp_datetime_p;
-    do
-    {
-        //  Scan for a 'Slash' '/' character
-        fmt_datetime_p = strchr( fmt_datetime_p, '/' );
-        if ( fmt_datetime_p != NULL ) fmt_datetime_p[ 0 ] = ' ';
-    }   while( fmt_datetime_p != NULL );
-
-    //  "-"
-    fmt_datetime_p = tmp_datetime_p;
-    do
-    {
-        //  Scan for a 'Minus' '-' character
-        fmt_datetime_p = strchr( fmt_datetime_p, '-' );
-        if ( fmt_datetime_p != NULL ) fmt_datetime_p[ 0 ] = ' ';
-    }   while( fmt_datetime_p != NULL );
-
-    //  ","
-    fmt_datetime_p = tmp_datetime_p;
-    do
-    {
-        //  Scan for a 'Comma' ',' character
-        fmt_datetime_p = strchr( fmt_datetime_p, ',' );
-        if ( fmt_datetime_p != NULL ) fmt_datetime_p[ 0 ] = ' ';
-    }   while( fmt_datetime_p != NULL );
-
-    //  "("
-    fmt_datetime_p = tmp_datetime_p;
-    do
-    {
-        //  Scan for a 'Left Parenthesis' '(' character
-        fmt_datetime_p = strchr( fmt_datetime_p, '(' );
-        if ( fmt_datetime_p != NULL ) fmt_datetime_p[ 0 ] = ' ';
-    }   while( fmt_datetime_p != NULL );
 
-    //  ")"
-    fmt_datetime_p = tmp_datetime_p;
-    do
+    //  There isn't any text yet
+    for ( ndx = 0; ndx < DT_FIELDS; ndx += 1 )
     {
-        //  Scan for a 'Right Parenthesis' ')' character
-        fmt_datetime_p = strchr( fmt_datetime_p, ')' );
-        if ( fmt_datetime_p != NULL ) fmt_datetime_p[ 0 ] = ' ';
-    }   while( fmt_datetime_p != NULL );
-
+        text_ndx[ ndx ] = -1;
+    }
 
     /************************************************************************
      *  Decode the Date / Time string
      ************************************************************************/
 
     //  Is the source date string long enough to contain a valid date ?
-    if ( strlen( tmp_datetime_p ) >= 5 )
+    if ( strlen( src_datetime_p ) >= 5 )
     {
         //  YES:    Allocate storage for the formatted date.
         fmt_datetime_p = mem_malloc( 20 );
 
-        //--------------------------------------------------------------------
-        //  Source format   YYYY MM DD HH MM SS                            #01
-        //--------------------------------------------------------------------
+        //  Break it into tokens
+        token_count = DECODE__dt_tokenize( src_datetime_p, token );
 
-        //  Do we have a successful decode yet ?
-        if ( decoded == false )
+        //  Try each pattern until one of them fits
+        for ( ndx = 0;
+              ( ndx < DT_PATTERNS ) && ( decoded == false );
+              ndx += 1 )
         {
-            //  Parse the date / time string
-            sscanf( tmp_datetime_p, "%d %d %d %d %d %d",
-                    &dt_year  , &dt_month , &dt_day   ,
-                    &dt_hour  , &dt_minute, &dt_second );
-
-            //  Verify a successful decode
-            if (    ( dt_year   >  70 )
-                 && ( dt_month  >=  1 ) && ( dt_month  <= 12 )
-                 && ( dt_day    >=  1 ) && ( dt_day    <= 31 )
-                 && ( dt_hour   >=  0 ) && ( dt_hour   <= 23 )
-                 && ( dt_minute >=  0 ) && ( dt_minute <= 59 )
-                 && ( dt_second >=  0 ) && ( dt_second <= 59 )
-                 && ( dt_dow    == -1 )
-                 && ( dt_ap     == -1 ) )
-            {
-                //  YES:    Good decode
-                decoded = true;
-            }
-            else
-            {
-                //  NO:     Bad decode
-                dt_dow = dt_year = dt_month = dt_day = dt_hour = \
-                       dt_minute = dt_second = dt_ap     = -1;
-            }
+            decoded = DECODE__dt_match( &dt_pattern_table[ ndx ],
+                                        token, token_count, text_ndx, field );
         }
 
-        //--------------------------------------------------------------------
-        //  Source format   MM DD YY HH MM SS (AP)                         #04
-        //--------------------------------------------------------------------
-
-        //  Do we have a successful decode yet ?
-        if ( decoded == false )
-        {
-            //  Parse the date / time string
-            sscanf( tmp_datetime_p, "%d %d %d %d %d %d %s",
-                    &dt_month , &dt_day   , &dt_year  ,
-                    &dt_hour  , &dt_minute, &dt_second, ap );
-
-            //  Convert the month string to an integer
-            dt_ap = DECODE__am_or_pm( ap );
-
-            //  Verify a successful decode
-            if (    ( dt_year   != -1 )
-                 && ( dt_month  >=  1 ) && ( dt_month  <= 12 )
-                 && ( dt_day    >=  1 ) && ( dt_day    <= 31 )
-                 && ( dt_hour   >=  0 ) && ( dt_hour   <= 23 )
-                 && ( dt_minute >=  0 ) && ( dt_minute <= 59 )
-                 && ( dt_second >=  0 ) && ( dt_second <= 59 )
-                 && ( dt_dow    == -1 )
-                 && ( dt_ap     != -2 ) )
-            {
-                //  YES:    Good decode
-                decoded = true;
-            }
-            else
-            {
-                //  NO:     Bad decode
-                dt_dow = dt_year = dt_month = dt_day = dt_hour = \
-                       dt_minute = dt_second = dt_ap     = -1;
-            }
-        }
-
-        //--------------------------------------------------------------------
-        //  Source format   MM DD YY HH MM   (AP)                          #02
-        //--------------------------------------------------------------------
-
-        //  Do we have a successful decode yet ?
-        if ( decoded == false )
-        {
-            //  Parse the date / time string
-            sscanf( tmp_datetime_p, "%d %d %d %d %d %s",
-                    &dt_month , &dt_day   , &dt_year  ,
-                    &dt_hour  , &dt_minute, ap         );
-
-            //  Convert the month string to an integer
-            dt_ap = DECODE__am_or_pm( ap );
-
-            //  Verify a successful decode
-            if (    ( dt_year   != -1 )
-                 && ( dt_month  >=  1 ) && ( dt_month  <= 12 )
-                 && ( dt_day    >=  1 ) && ( dt_day    <= 31 )
-                 && ( dt_hour   >=  0 ) && ( dt_hour   <= 23 )
-                 && ( dt_minute >=  0 ) && ( dt_minute <= 59 )
-                 && ( dt_second == -1 )
-                 && ( dt_dow    == -1 )
-                 && ( dt_ap     != -2 ) )   //  May or may-not be present
-            {
-                //  YES:    Good decode
-                decoded = true;
-
-                //  Seconds isn't included in this format.
-                dt_second = 0;
-            }
-            else
-            {
-                //  NO:     Bad decode
-                dt_dow = dt_year = dt_month = dt_day = dt_hour = \
-                       dt_minute = dt_second = dt_ap     = -1;
-            }
-        }
-
-        //--------------------------------------------------------------------
-        //  Source format   MM DD YY                                       #03
-        //--------------------------------------------------------------------
-
-        //  Do we have a successful decode yet ?
-        if ( decoded == false )
-        {
-            //  Parse the date / time string
-            sscanf( tmp_datetime_p, "%d %d %d %d %d %s",
-                    &dt_month , &dt_day   , &dt_year  ,
-                    &dt_hour  , &dt_minute, ap         );
-
-            //  Convert the month string to an integer
-            dt_ap = DECODE__am_or_pm( ap );
-
-            //  Verify a successful decode
-            if (    ( dt_year   != -1 )
-                 && ( dt_month  >=  1 ) && ( dt_month  <= 12 )
-                 && ( dt_day    >=  1 ) && ( dt_day    <= 31 )
-                 && ( dt_hour   == -1 )
-                 && ( dt_minute == -1 )
-                 && ( dt_second == -1 )
-                 && ( dt_dow    == -1 )
-                 && ( dt_ap     ==  0 ) )
-            {
-                //  YES:    Good decode
-                decoded = true;
-
-                //  There isn't a time with this format so use '00:00:00'
-                dt_hour   = 0;
-                dt_minute = 0;
-                dt_second = 0;
-            }
-            else
-            {
-                //  NO:     Bad decode
-                dt_dow = dt_year = dt_month = dt_day = dt_hour = \
-                       dt_minute = dt_second = dt_ap     = -1;
-            }
-        }
-
-        //--------------------------------------------------------------------
-        //  Source format   DD MON YY HH MM (SS)                           #05
-        //--------------------------------------------------------------------
-
-        //  Do we have a successful decode yet ?
-        if ( decoded == false )
-        {
-            //  Parse the date / time string
-            sscanf( tmp_datetime_p, "%d %s %d %d %d %d",
-                    &dt_day   ,  month    , &dt_year  ,
-                    &dt_hour  , &dt_minute, &dt_second );
-
-            //  Convert the month string to an integer
-            dt_month = DECODE__month( month );
-
-            if (    ( dt_year   != -1 )
-                 && ( dt_month  >=  1 ) && ( dt_month  <= 12 )
-                 && ( dt_day    >=  1 ) && ( dt_day    <= 31 )
-                 && ( dt_hour   >=  0 ) && ( dt_hour   <= 23 )
-                 && ( dt_minute >=  0 ) && ( dt_minute <= 59 )
-//               && ( dt_second >=  0 ) && ( dt_second <= 59 )     //  Seconds may or MAY NOT exist
-                 && ( dt_dow    == -1 )
-                 && ( dt_ap     == -1 ) )
-            {
-                //  YES:    Good decode
-                decoded = true;
-
-                //  Was the seconds included ?
-                if (    ( dt_second == -1 )
-                     || ( dt_second  > 59 ) )
-                {
-                    //  YES:    Set it to zero
-                    dt_second = 0;
-                }
-            }
-            else
-            {
-                //  NO:     Bad decode
-                dt_dow = dt_year = dt_month = dt_day = dt_hour = \
-                       dt_minute = dt_second = dt_ap     = -1;
-            }
-        }
-
-        //--------------------------------------------------------------------
-        //  Source format   DOW     DD MON YY HH MM SS AP                  #06
-        //--------------------------------------------------------------------
-
-        //  Do we have a successful decode yet ?
-        if ( decoded == false )
-        {
-            //  Parse the date / time string
-            sscanf( tmp_datetime_p, "%s %d %s %d %d %d %d %s",
-                    dow,
-                    &dt_day   , month     , &dt_year  ,
-                    &dt_hour  , &dt_minute, &dt_second, ap       );
-
-            //  Convert the month string to an integer
-            dt_ap = DECODE__am_or_pm( ap );
-
-            //  Convert the month string to an integer
-            dt_dow = DECODE__day_of_week( dow );
-
-            //  Convert the month string to an integer
-            dt_month = DECODE__month( month );
-
-            if (    ( dt_year   != -1 )
-                 && ( dt_month  >=  1 ) && ( dt_month  <= 12 )
-                 && ( dt_day    >=  1 ) && ( dt_day    <= 31 )
-                 && ( dt_hour   >=  0 ) && ( dt_hour   <= 23 )
-                 && ( dt_minute >=  0 ) && ( dt_minute <= 59 )
-                 && ( dt_second >=  0 ) && ( dt_second <= 59 )
-                 && ( dt_dow    >=  1 ) && ( dt_dow    <=  7 )
-                 && ( dt_ap     >   0 ) )
-            {
-                //  YES:    Good decode
-                decoded = true;
-            }
-            else
-            {
-                //  NO:     Bad decode
-                dt_dow = dt_year = dt_month = dt_day = dt_hour = \
-                       dt_minute = dt_second = dt_ap     = -1;
-            }
-        }
-
-        //--------------------------------------------------------------------
-        //  Source format   DOW     DD MON YY HH MM    AP                  #07
-        //--------------------------------------------------------------------
-
-        //  Do we have a successful decode yet ?
-        if ( decoded == false )
-        {
-            //  Parse the date / time string
-            sscanf( tmp_datetime_p, "%s %d %s %d %d %d %s",
-                    dow,
-                    &dt_day   , month     , &dt_year,
-                    &dt_hour  , &dt_minute, ap       );
-
-            //  Convert the month string to an integer
-            dt_ap = DECODE__am_or_pm( ap );
-
-            //  Convert the month string to an integer
-            dt_dow = DECODE__day_of_week( dow );
-
-            //  Convert the month string to an integer
-            dt_month = DECODE__month( month );
-
-            if (    ( dt_year   != -1 )
-                 && ( dt_month  >=  1 ) && ( dt_month  <= 12 )
-                 && ( dt_day    >=  1 ) && ( dt_day    <= 31 )
-                 && ( dt_hour   >=  0 ) && ( dt_hour   <= 23 )
-                 && ( dt_minute >=  0 ) && ( dt_minute <= 59 )
-                 && ( dt_second == -1 )
-                 && ( dt_dow    >=  1 ) && ( dt_dow    <=  7 )
-                 && ( dt_ap     >   0 ) )
-            {
-                //  YES:    Good decode
-                decoded = true;
-
-                //  Seconds isn't included in this format.
-                dt_second = 0;
-            }
-            else
-            {
-                //  NO:     Bad decode
-                dt_dow = dt_year = dt_month = dt_day = dt_hour = \
-                       dt_minute = dt_second = dt_ap     = -1;
-            }
-        }
-
-        //--------------------------------------------------------------------
-        //  Source format   DOW     DD MON YY HH MM( SS)                   #08
-        //--------------------------------------------------------------------
-
-        //  Do we have a successful decode yet ?
-        if ( decoded == false )
-        {
-            //  Parse the date / time string
-            sscanf( tmp_datetime_p, "%s %d %s %d %d %d %d",
-                    dow,
-                    &dt_day   ,  month    , &dt_year  ,
-                    &dt_hour  , &dt_minute, &dt_second );
-
-            //  Convert the month string to an integer
-            dt_dow = DECODE__day_of_week( dow );
-
-            //  Convert the month string to an integer
-            dt_month = DECODE__month( month );
-
-            if (    ( dt_year   != -1 )
-                 && ( dt_month  >=  1 ) && ( dt_month  <= 12 )
-                 && ( dt_day    >=  1 ) && ( dt_day    <= 31 )
-                 && ( dt_hour   >=  0 ) && ( dt_hour   <= 23 )
-                 && ( dt_minute >=  0 ) && ( dt_minute <= 59 )
-//               && ( dt_second >=  0 ) && ( dt_second <= 59 )     //  Seconds may or MAY NOT exist
-                 && ( dt_dow    >=  1 ) && ( dt_dow    <=  7 )
-                 && ( dt_ap     == -1 ) )
-            {
-                //  YES:    Good decode
-                decoded = true;
-
-                //  Was the seconds included ?
-                if (    ( dt_second == -1 )
-                     || ( dt_second  > 59 ) )
-                {
-                    //  YES:    Set it to zero
-                    dt_second = 0;
-                }
-            }
-            else
-            {
-                //  NO:     Bad decode
-                dt_dow = dt_year = dt_month = dt_day = dt_hour = \
-                       dt_minute = dt_second = dt_ap     = -1;
-            }
-        }
-
-        //--------------------------------------------------------------------
-        //  Source format   DOW MON DD     YY HH MMam                      @09
-        //--------------------------------------------------------------------
-
-        //  Do we have a successful decode yet ?
-        if ( decoded == false )
-        {
-            //  Parse the date / time string
-            sscanf( tmp_datetime_p, "%s %s %d %d %d %d%s",
-                    dow,
-                    month     , &dt_day   ,   &dt_year  ,
-                    &dt_hour  , &dt_minute,   ap         );
-
-            //  Convert the month string to an integer
-            dt_ap = DECODE__am_or_pm( ap );
-
-            //  Convert the month string to an integer
-            dt_dow = DECODE__day_of_week( dow );
-
-            //  Convert the month string to an integer
-            dt_month = DECODE__month( month );
-
-            if (    ( dt_year   != -1 )
-                 && ( dt_month  >=  1 ) && ( dt_month  <= 12 )
-                 && ( dt_day    >=  1 ) && ( dt_day    <= 31 )
-                 && ( dt_hour   >=  0 ) && ( dt_hour   <= 23 )
-                 && ( dt_minute >=  0 ) && ( dt_minute <= 59 )
-                 && ( dt_second == -1 )
-                 && ( dt_dow    >=  1 ) && ( dt_dow    <=  7 )
-                 && ( dt_ap     >   0 ) )
-            {
-                //  YES:    Good decode
-                decoded = true;
-
-                //  Seconds isn't included in this format.
-                dt_second = 0;
-            }
-            else
-            {
-                //  NO:     Bad decode
-                dt_dow = dt_year = dt_month = dt_day = dt_hour = \
-                       dt_minute = dt_second = dt_ap     = -1;
-            }
-        }
-
-        //--------------------------------------------------------------------
-        //  Source format   DOW MON DD     YY HH MM SSap                   @10
-        //--------------------------------------------------------------------
-
-        //  Do we have a successful decode yet ?
-        if ( decoded == false )
-        {
-            //  Parse the date / time string
-            sscanf( tmp_datetime_p, "%s %s %d %d %d %d %d%s",
-                    dow,
-                    month     , &dt_day   ,   &dt_year  ,
-                    &dt_hour  , &dt_minute,   &dt_second, ap );
-
-            //  Convert the month string to an integer
-            dt_ap = DECODE__am_or_pm( ap );
-
-            //  Convert the month string to an integer
-            dt_dow = DECODE__day_of_week( dow );
-
-            //  Convert the month string to an integer
-            dt_month = DECODE__month( month );
-
-            if (    ( dt_year   != -1 )
-                 && ( dt_month  >=  1 ) && ( dt_month  <= 12 )
-                 && ( dt_day    >=  1 ) && ( dt_day    <= 31 )
-                 && ( dt_hour   >=  0 ) && ( dt_hour   <= 23 )
-                 && ( dt_minute >=  0 ) && ( dt_minute <= 59 )
-                 && ( dt_second >=  0 ) && ( dt_second <= 59 )
-                 && ( dt_dow    >=  1 ) && ( dt_dow    <=  7 )
-                 && ( dt_ap     >   0 ) )
-            {
-                //  YES:    Good decode
-                decoded = true;
-            }
-            else
-            {
-                //  NO:     Bad decode
-                dt_dow = dt_year = dt_month = dt_day = dt_hour = \
-                       dt_minute = dt_second = dt_ap     = -1;
-            }
-        }
-
-        //--------------------------------------------------------------------
-        //  Source format   DOW MON DD     YY HH MM                        @11
-        //--------------------------------------------------------------------
-
-        //  Do we have a successful decode yet ?
-        if ( decoded == false )
-        {
-            //  Parse the date / time string
-            sscanf( tmp_datetime_p, "%s %s %d %d %d %d %d",
-                    dow,
-                    month     , &dt_day   , &dt_year   ,
-                    &dt_hour  , &dt_minute, &dt_second );
-
-            //  Convert the month string to an integer
-            dt_dow = DECODE__day_of_week( dow );
-
-            //  Convert the month string to an integer
-            dt_month = DECODE__month( month );
-
-            if (    ( dt_year   != -1 )
-                 && ( dt_month  >=  1 ) && ( dt_month  <= 12 )
-                 && ( dt_day    >=  1 ) && ( dt_day    <= 31 )
-                 && ( dt_hour   >=  0 ) && ( dt_hour   <= 23 )
-                 && ( dt_minute >=  0 ) && ( dt_minute <= 59 )
-                 && ( dt_second == -1 )
-                 && ( dt_dow    >=  1 ) && ( dt_dow    <=  7 )
-                 && ( dt_ap     == -1 ) )
-            {
-                //  YES:    Good decode
-                decoded = true;
-
-                //  There isn't a seconds position for this format
-                dt_second = 0;
-            }
-            else
-            {
-                //  NO:     Bad decode
-                dt_dow = dt_year = dt_month = dt_day = dt_hour = \
-                       dt_minute = dt_second = dt_ap     = -1;
-            }
-        }
-
-        //--------------------------------------------------------------------
-        //  Source format   DOW MON DD        HH MM SS YY                  @12
-        //--------------------------------------------------------------------
-
-        //  Do we have a successful decode yet ?
-        if ( decoded == false )
+        //  Was the decode successful ?
+        if ( decoded == true )
         {
-            //  Parse the date / time string
-            sscanf( tmp_datetime_p, "%s %s %d %d %d %d %d",
-                    dow,
-                    month     , &dt_day   , &dt_hour  ,
-                    &dt_minute, &dt_second, &dt_year    );
-
-            //  Convert the month string to an integer
-            dt_dow = DECODE__day_of_week( dow );
-
-            //  Convert the month string to an integer
-            dt_month = DECODE__month( month );
-
-            if (    ( dt_year   != -1 )
-                 && ( dt_month  >=  1 ) && ( dt_month  <= 12 )
-                 && ( dt_day    >=  1 ) && ( dt_day    <= 31 )
-                 && ( dt_hour   >=  0 ) && ( dt_hour   <= 23 )
-                 && ( dt_minute >=  0 ) && ( dt_minute <= 59 )
-                 && ( dt_second >=  0 ) && ( dt_second <= 59 )
-                 && ( dt_dow    >=  1 ) && ( dt_dow    <=  7 )
-                 && ( dt_ap     == -1 ) )
+            //  YES:    Use '00' for a missing (or a bad) hour, minute and
+            //          second.  A pattern only lets through the ones that
+            //          don't have to be there.
+            if ( ( field[ DT_HOUR   ] == -1 ) || ( field[ DT_HOUR   ] > 23 ) )
             {
-                //  YES:    Good decode
-                decoded = true;
+                field[ DT_HOUR   ] = 0;
             }
-            else
-            {
-                //  NO:     Bad decode
-                dt_dow = dt_year = dt_month = dt_day = dt_hour = \
-                       dt_minute = dt_second = dt_ap     = -1;
-            }
-        }
-
-        //--------------------------------------------------------------------
-        //  Source format   DOW MON DD     YY                              #13
-        //--------------------------------------------------------------------
-
-        //  Do we have a successful decode yet ?
-        if ( decoded == false )
-        {
-            //  Parse the date / time string
-            sscanf( tmp_datetime_p, "%s %s %d %d %d",
-                    dow,
-                    month     , &dt_day   , &dt_year   ,
-                    &dt_hour                            );
-
-            //  Convert the month string to an integer
-            dt_dow = DECODE__day_of_week( dow );
-
-            //  Convert the month string to an integer
-            dt_month = DECODE__month( month );
-
-            if (    ( dt_year   != -1 )
-                 && ( dt_month  >=  1 ) && ( dt_month  <= 12 )
-                 && ( dt_day    >=  1 ) && ( dt_day    <= 31 )
-                 &&(( dt_hour   == -1 ) || ( dt_hour > 23   ) )
-                 && ( dt_minute == -1 )
-                 && ( dt_second == -1 )
-                 && ( dt_dow    >=  1 ) && ( dt_dow    <=  7 )
-                 && ( dt_ap     == -1 ) )
+            if ( ( field[ DT_MINUTE ] == -1 ) || ( field[ DT_MINUTE ] > 59 ) )
             {
-                //  YES:    Good decode
-                decoded = true;
-
-                //  Fill in the missing time
-                dt_hour   = 0;
-                dt_minute = 0;
-                dt_second = 0;
+                field[ DT_MINUTE ] = 0;
             }
-            else
+            if ( ( field[ DT_SECOND ] == -1 ) || ( field[ DT_SECOND ] > 59 ) )
             {
-                //  NO:     Bad decode
-                dt_dow = dt_year = dt_month = dt_day = dt_hour = \
-                       dt_minute = dt_second = dt_ap     = -1;
+                field[ DT_SECOND ] = 0;
             }
         }
-
-        //--------------------------------------------------------------------
-        //  Source format       MON DD     YY HH MM    AP                  @14
-        //--------------------------------------------------------------------
-
-        //  Do we have a successful decode yet ?
-        if ( decoded == false )
+        else
         {
-            //  Parse the date / time string
-            sscanf( tmp_datetime_p, "%s %d %d %d %d %s",
-                    month     , &dt_day   , &dt_year   ,
-                    &dt_hour  , &dt_minute, ap          );
-
-            //  Convert the month string to an integer
-            dt_ap = DECODE__am_or_pm( ap );
-
-            //  Convert the month string to an integer
-            dt_month = DECODE__month( month );
-
-            if (    ( dt_year   != -1 )
-                 && ( dt_month  >=  1 ) && ( dt_month  <= 12 )
-                 && ( dt_day    >=  1 ) && ( dt_day    <= 31 )
-                 && ( dt_hour   >=  0 ) && ( dt_hour   <= 23 )
-                 && ( dt_minute >=  0 ) && ( dt_minute <= 59 )
-                 && ( dt_second == -1 )
-                 && ( dt_dow    == -1 )
-                 && ( dt_ap     >   0 ) )
-            {
-                //  YES:    Good decode
-                decoded = true;
-
-                //  There isn't a seconds position for this format
-                dt_second = 0;
-            }
-            else
+            //  NO:     Nothing was found
+            for ( ndx = 0; ndx < DT_FIELDS; ndx += 1 )
             {
-                //  NO:     Bad decode
-                dt_dow = dt_year = dt_month = dt_day = dt_hour = \
-                       dt_minute = dt_second = dt_ap     = -1;
+                field[ ndx ] = -1;
             }
         }
 
@@ -854,16 +320,16 @@ decode_fmt_datetime(
         if ( decoded == true )
         {
             //  Was the time 'PM'
-            if ( dt_ap == 2 )
+            if ( field[ DT_AP ] == 2 )
             {
                 //  YES:    Add twelve hours to the hour
-                dt_hour += 12;
+                field[ DT_HOUR ] += 12;
 
                 //  Fix for 12:00 PM
-                if ( dt_hour == 24 )
+                if ( field[ DT_HOUR ] == 24 )
                 {
                     //  YES:    Change the hour to 00
-                    dt_hour = 12;
+                    field[ DT_HOUR ] = 12;
                 }
             }
         }
@@ -876,26 +342,26 @@ decode_fmt_datetime(
         if ( decoded == true )
         {
             //  Do we have a two digit year ?
-            if ( dt_year < 1970 )
+            if ( field[ DT_YEAR ] < 1970 )
             {
                 //  Do we have a Y2K problem ?
-                if ( dt_year >= 100 )
+                if ( field[ DT_YEAR ] >= 100 )
                 {
                     //  YES:    Correct the year
-                    dt_year += 1900;
+                    field[ DT_YEAR ] += 1900;
                 }
                 //  YES:    In the twentieth century ?
                 else
-                if ( dt_year >= 70 )
+                if ( field[ DT_YEAR ] >= 70 )
                 {
                     //  YES:    Correct the year
-                    dt_year += 1900;
+                    field[ DT_YEAR ] += 1900;
                 }
                 //  00 = 2000
                 else
                 {
                     //  Correct the year
-                    dt_year += 2000;
+                    field[ DT_YEAR ] += 2000;
                 }
             }
         }
@@ -905,18 +371,18 @@ decode_fmt_datetime(
         //--------------------------------------------------------------------
 
         //  Did we successfully decode the date time string
-        if (    ( ( 1970 <= dt_year   )                          )
-             && ( (    1 <= dt_month  ) && (   12 >= dt_month  ) )
-             && ( (    1 <= dt_day    ) && (   31 >= dt_day    ) )
-             && ( (    0 <= dt_hour   ) && (   23 >= dt_hour   ) )
-             && ( (    0 <= dt_minute ) && (   59 >= dt_minute ) )
-             && ( (    0 <= dt_second ) && (   59 >= dt_second ) ) )
+        if (    ( ( 1970 <= field[ DT_YEAR   ] )                                 )
+             && ( (    1 <= field[ DT_MONTH  ] ) && (   12 >= field[ DT_MONTH  ] ) )
+             && ( (    1 <= field[ DT_DAY    ] ) && (   31 >= field[ DT_DAY    ] ) )
+             && ( (    0 <= field[ DT_HOUR   ] ) && (   23 >= field[ DT_HOUR   ] ) )
+             && ( (    0 <= field[ DT_MINUTE ] ) && (   59 >= field[ DT_MINUTE ] ) )
+             && ( (    0 <= field[ DT_SECOND ] ) && (   59 >= field[ DT_SECOND ] ) ) )
         {
             //  YES:    Format the Date/Time string
             snprintf( fmt_datetime_p, 20,
                     "%04d-%02d-%02d %02d:%02d:%02d",
-                    dt_year  , dt_month , dt_day   ,
-                    dt_hour  , dt_minute, dt_second );
+                    field[ DT_YEAR   ], field[ DT_MONTH  ], field[ DT_DAY    ],
+                    field[ DT_HOUR   ], field[ DT_MINUTE ], field[ DT_SECOND ] );
 
 //          log_write( MID_INFO, "decode_D/T", "From: '%s', To: '%s'\n",
 //                  src_datetime_p, fmt_datetime_p );
@@ -925,7 +391,7 @@ decode_fmt_datetime(
         {
             //  NO:     The date/time format is unknown or
             //          the data is invalid.
-            fmt_datetime_p = text_copy_to_new( "1900-01-01 00:00:00" );
+            snprintf( fmt_datetime_p, 20, "1900-01-01 00:00:00" );
 
             //  Write a warning message
             log_write( MID_WARNING, "decode_fmt_datetime",
@@ -1492,14 +958,6 @@ decode_fmt_notes(
     /**
      *  @param  index           Scan index                                  */
     int                         index;
-    /**
-     *  @param  fwos            First Word of Sentence                      */
-    static
-    int                         fwos;
-    /**
-     *  @param  fwol            First Word of Line                          */
-    static
-    int                         fwol;
     /**
      *  @param  tmp_p           Pointer to a temporary buffer               */
     char                    *   tmp_p;
@@ -1512,12 +970,12 @@ decode_fmt_notes(
     if ( list_query_count( recipe_p->notes_p ) == 0 )
     {
         //  YES:    Reset the first word flags
-        fwos = true;
-        fwol = true;
+        recipe_p->notes_fwos = true;
+        recipe_p->notes_fwol = true;
     }
 
     //  Is the first word of a new line ?
-    if ( fwol == true )
+    if ( recipe_p->notes_fwol == true )
     {
         //  YES:    Clear the formatted line buffer
         memset( formatted_text, '\0', sizeof( formatted_text ) );
@@ -1579,7 +1037,7 @@ decode_fmt_notes(
              ****************************************************************/
 
              // Is this a numbered directions sequence ?
-            if (    ( fwos == true )
+            if (    ( recipe_p->notes_fwos == true )
                  && ( isdigit( next_word[ 0 ] ) !=  0  )
                  && (    ( next_word[ 1 ]   == '.' )
                       || ( next_word[ 1 ]   == ')' )
@@ -1591,7 +1049,7 @@ decode_fmt_notes(
                 next_word[ 0 ] = '\0';
 
                 //  That also makes whatever is next the First-Word-of-Line
-                fwol = true;
+                recipe_p->notes_fwol = true;
             }
 
             /****************************************************************
@@ -1601,8 +1059,8 @@ decode_fmt_notes(
 
             if ( next_word[ 0 ] == '*' )
             {
-                fwos = true;
-                fwol = false;
+                recipe_p->notes_fwos = true;
+                recipe_p->notes_fwol = false;
             }
 
             /****************************************************************
@@ -1628,16 +1086,16 @@ decode_fmt_notes(
              *  First Word of Sentence and First-Word-of-Line
              ****************************************************************/
 
-            if (    ( fwos == true )
-                 && ( fwol == true )
+            if (    ( recipe_p->notes_fwos == true )
+                 && ( recipe_p->notes_fwol == true )
                  && ( strlen( next_word ) > 0 ) )
             {
                 strncpy( formatted_text, next_word, MAX_LINE_L );
                 strncat( formatted_text, " ",
                          MAX_LINE_L - strlen( formatted_text ) );
                 formatted_text[ 0 ] = toupper( formatted_text[ 0 ] );
-                fwos = false;
-                fwol = false;
+                recipe_p->notes_fwos = false;
+                recipe_p->notes_fwol = false;
             }
 
             /****************************************************************
@@ -1645,8 +1103,8 @@ decode_fmt_notes(
              ****************************************************************/
 
             else
-            if (    ( fwos == true  )
-                 && ( fwol == false )
+            if (    ( recipe_p->notes_fwos == true  )
+                 && ( recipe_p->notes_fwol == false )
                  && ( strlen( next_word ) > 0 ) )
             {
                 //  This is the first word of a new sentence but not
@@ -1674,8 +1132,8 @@ decode_fmt_notes(
                 strncat( formatted_text, " ",
                          MAX_LINE_L - strlen( formatted_text ) );
                 formatted_text[ 0 ] = toupper( formatted_text[ 0 ] );
-                fwos = false;
-                fwol = false;
+                recipe_p->notes_fwos = false;
+                recipe_p->notes_fwol = false;
             }
 
             /****************************************************************
@@ -1683,15 +1141,15 @@ decode_fmt_notes(
              ****************************************************************/
 
             else
-            if (    ( fwos == false )
-                 && ( fwol == true  )
+            if (    ( recipe_p->notes_fwos == false )
+                 && ( recipe_p->notes_fwol == true  )
                  && ( strlen( next_word ) > 0 ) )
             {
                 //  Append the new word to an existing sentence.
                 strncat( formatted_text, next_word, MAX_LINE_L );
                 strncat( formatted_text, " ", MAX_LINE_L - strlen( formatted_text ) );
-                fwos = false;
-                fwol = false;
+                recipe_p->notes_fwos = false;
+                recipe_p->notes_fwol = false;
             }
 
             /****************************************************************
@@ -1699,16 +1157,16 @@ decode_fmt_notes(
              ****************************************************************/
 
             else
-            if (    ( fwos == false )
-                 && ( fwol == false )
+            if (    ( recipe_p->notes_fwos == false )
+                 && ( recipe_p->notes_fwol == false )
                  && ( strlen( next_word ) > 0 ) )
             {
                 //  Append the new word to an existing sentence.
                 strncat( formatted_text, next_word, MAX_LINE_L );
                 strncat( formatted_text, " ",
                          MAX_LINE_L - strlen( formatted_text ) );
-                fwos = false;
-                fwol = false;
+                recipe_p->notes_fwos = false;
+                recipe_p->notes_fwol = false;
             }
             //  Is this the end of a sentence ?
             if (    ( next_word[ strlen( next_word ) - 1 ] == '.' )
@@ -1717,10 +1175,10 @@ decode_fmt_notes(
                 //  YES:    Insert an extra space in the formatted text.
                 strncat( formatted_text, " ",
                          MAX_LINE_L - strlen( formatted_text ) );
-                fwos = true;
+                recipe_p->notes_fwos = true;
             }
             //  Is this a special ?
-            if (    ( fwos == true )
+            if (    ( recipe_p->notes_fwos == true )
                  && ( formatted_text[ 0 ] == '*' ) )
             {
                 //  YES:    Make sure there is something in the current line
@@ -1736,7 +1194,7 @@ decode_fmt_notes(
 
                     //  Clear the formatted text buffer.
                     memset( formatted_text, '\0', sizeof( formatted_text ) );
-                    fwol = true;
+                    recipe_p->notes_fwol = true;
                 }
             }
 
@@ -1747,8 +1205,8 @@ decode_fmt_notes(
     else
     {
         //  YES:    Whatever (if anything else) is next will start a new line.
-        fwos = true;
-        fwol = true;
+        recipe_p->notes_fwos = true;
+        recipe_p->notes_fwol = true;
     }
 
     /************************************************************************
@@ -1786,6 +1244,8 @@ decode_fmt_notes(
  *  @return void                No return code from this function.
  *
  *  @note
+ *      The ID counter is shared by all decode threads so it is only ever
+ *      touched with an atomic increment.
  *
  ****************************************************************************/
 
@@ -1801,8 +1261,8 @@ decode_next_id(
      *  @param  id_string       Recipe-ID string to identify a recipe       */
     char                        id_string[ ( SHA1_DIGEST_SIZE * 2 ) + 4 ];
     /**
-     *  @param  store_value_p   Pointer to data get                         */
-    char                    *   store_value_p;
+     *  @param  store_value     The ID number as a string                   */
+    char                        store_value[ SHA1_DIGEST_SIZE + 1 ];
     /**
      *  @param  recipe_id_val   Value of the stored recipe_id               */
     int                         recipe_id_val;
@@ -1814,14 +1274,12 @@ decode_next_id(
      *  Function Initialization
      ************************************************************************/
 
-    //  Set an initialization value
-    store_value_p = recipe_id_p;
-
-    //  Convert the recipe-ID to an integer
-    recipe_id_val = atoi( recipe_id_p );
+    //  Claim the next ID number
+    recipe_id_val = __atomic_fetch_add( &recipe_id_count, 1, __ATOMIC_SEQ_CST );
 
-    //  And increment it
-    recipe_id_val += 1;
+    //  Integer to ASCII
+    memset( store_value, '\0', sizeof( store_value ) );
+    snprintf( store_value, sizeof( store_value ), "%016d", recipe_id_val );
 
     /************************************************************************
      *  RECIPE-ID
@@ -1831,7 +1289,7 @@ decode_next_id(
     sha1_init( &context );
 
     //  Build SHA1 version of the recipe id
-    sha1_update( &context, store_value_p, ( SHA1_DIGEST_SIZE ) );
+    sha1_update( &context, store_value, ( SHA1_DIGEST_SIZE ) );
 
     //  Finalize the SHA1 operation
     sha1_final( &context, (char*)recipe_id );
@@ -1854,9 +1312,6 @@ decode_next_id(
      *  Function Exit
      ************************************************************************/
 
-    //  Integer back to ASCII
-    snprintf( recipe_id_p, RECIPE_ID_L, "%016d", recipe_id_val );
-
     //  DONE!
 }
 
@@ -2175,6 +1630,210 @@ decode_wbt(
     return ( decode_rc );
 }
 
+/****************************************************************************/
+/**
+ *  Run the decode benchmarks.
+ *
+ *  @param  void                No parameters are passed in.
+ *
+ *  @return void                No information is returned
+ *
+ *  @note
+ *      The results are written to the log file.
+ *
+ ****************************************************************************/
+
+void
+decode_benchmark(
+    void
+    )
+{
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    //  Date / time decoder
+    DECODE__BENCH_fmt_datetime( );
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+}
+
+/****************************************************************************/
+/**
+ *  Look up a recipe format.
+ *
+ *  @param  recipe_format       The format
+ *
+ *  @return format_p            Pointer to the format's decode_format_t or
+ *                              NULL when it isn't a known format.
+ *
+ *  @note
+ *
+ ****************************************************************************/
+
+struct  decode_format_t     *
+decode_format(
+    enum    recipe_format_e     recipe_format
+    )
+{
+    /**
+     *  @param  format_p        Pointer to the format                       */
+    struct  decode_format_t *   format_p;
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+    //  Assume it isn't known
+    format_p = NULL;
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    //  Is it in the table ?
+    if (    ( recipe_format >= 0                 )
+         && ( recipe_format <  DECODE_FORMAT_MAX ) )
+    {
+        //  YES:    Use it
+        format_p = format_table[ recipe_format ];
+    }
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+    return( format_p );
+}
+
+/****************************************************************************/
+/**
+ *  Decode the recipe that is held by a Recipe Control Block.
+ *
+ *  @param  tcb_p               Pointer to a Thread Control Block
+ *  @param  void_p              Pointer to a Recipe Control Block
+ *
+ *  @return void                No information is returned
+ *
+ *  @note
+ *      A recipe that decodes cleanly is passed on to the ENCODE thread group.
+ *
+ ****************************************************************************/
+
+void
+decode_rcb(
+    struct  tcb_t           *   tcb_p,
+    void                    *   void_p
+    )
+{
+    /**
+     *  @param  rcb_p           Pointer to a Recipe Control Block           */
+    struct  rcb_t           *   rcb_p;
+#if ! STUB
+    /**
+     *  @param  ok_to_encode    TRUE = OK to encode the recipe              */
+    int                         ok_to_encode;
+    /**
+     *  @param  format_p        The recipe format                           */
+    struct  decode_format_t *   format_p;
+#endif
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+    //  Set the pointer
+    rcb_p = void_p;
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+#if ! STUB
+
+    /********************************************************************
+     *  Decoder selection
+     ********************************************************************/
+
+    //  Based on the recipe format of the recipe start
+    format_p = decode_format( rcb_p->recipe_format );
+
+    //  Is there a decoder for it ?
+    if (    ( format_p           != NULL )
+         && ( format_p->decode_p != NULL ) )
+    {
+        //  YES:    Decode it
+        format_p->decode_p( rcb_p );
+        ok_to_encode = true;
+    }
+    else
+    if ( format_p != NULL )
+    {
+        //  NO:     Known but not available
+        log_write( MID_WARNING, tcb_p->thread_name,
+                   "Decode for recipe format '%s' is not available\n",
+                   format_p->name_p );
+        //  Clean out the recipe control block
+        ok_to_encode = false;
+    }
+    else
+    {
+        //  OOPS.
+        log_write( MID_WARNING, tcb_p->thread_name,
+                   "recipe format (%d)\n",
+                   rcb_p->recipe_format );
+        //  Clean out the recipe control block
+        ok_to_encode = false;
+    }
+
+
+    /********************************************************************
+     *  Pass the recipe on to the recipe encoder.
+     ********************************************************************/
+
+    //  Is it OK to encode this recipe ?
+    if ( ok_to_encode == true )
+    {
+        //  Post processing recipe format.
+        decode_post( rcb_p );
+
+        //  Perform the final verification
+        ok_to_encode = DECODE__recipe_verify( rcb_p );
+
+        //  Add it to the batch for the ENCODE queue
+        tcb_batch_put( tcb_p, encode_tcb, rcb_p );
+    }
+    else
+    {
+        //  NO:     Kill the RCB
+        rcb_kill( rcb_p );
+    }
+
+#else
+
+    //  Kill the Recipe Control Block
+    rcb_kill( rcb_p );
+
+#endif
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+}
+
 /****************************************************************************/
 /**
  *  Initialize the Translations tables.
@@ -2199,11 +1858,15 @@ decode(
     /**
      *  @param  rcb_p           Pointer to a Recipe Control Block           */
     struct  rcb_t           *   rcb_p;
-#if ! STUB
     /**
-     *  @param  ok_to_encode    TRUE = OK to encode the recipe              */
-    int                         ok_to_encode;
-#endif
+     *  @param  rcb_list        Batch of Recipe Control Blocks              */
+    void                    *   rcb_list[ TCB_BATCH_MAX ];
+    /**
+     *  @param  rcb_count       Number of RCBs in the batch                 */
+    int                         rcb_count;
+    /**
+     *  @param  ndx             Index into the batch                        */
+    int                         ndx;
 
     /************************************************************************
      *  Function Initialization
@@ -2217,7 +1880,7 @@ decode(
                "Initialization complete.\n" );
 
     //  Change execution state to "WAIT"ing for work.
-    tcb_p->thread_state = TS_WAIT;
+    tcb_set_state( tcb_p, TS_WAIT );
 
     /************************************************************************
      *  Function Body
@@ -2230,152 +1893,38 @@ decode(
          *  Get a new file to import
          ********************************************************************/
 
-        //  Get the current File-ID.
-        rcb_p = queue_get_payload( tcb_p->queue_id );
-
-        //  This thread is now the owner of the RCB
-        rcb_p->tcb_p = tcb_p;
-
-        //  Progress report.
-        log_write( MID_LOGONLY, tcb_p->thread_name,
-                   "SIZE: %10d - FILE-ID: %s\n",
-                   list_query_count( rcb_p->import_list_p ),
-                   rcb_p->file_path );
+        //  Get everything that is waiting (up to a full batch).
+        rcb_count = tcb_queue_get_batch( tcb_p, rcb_list, TCB_BATCH_MAX );
 
         //  Change execution state to "INITIALIZED" for work.
-        tcb_p->thread_state = TS_WORKING;
-
-#if ! STUB
-
-        /********************************************************************
-         *  Decoder selection
-         ********************************************************************/
+        tcb_set_state( tcb_p, TS_WORKING );
 
-        //  Based on the recipe format of the recipe start
-        switch( rcb_p->recipe_format )
+        //  Process the batch
+        for ( ndx = 0;
+              ndx < rcb_count;
+              ndx += 1 )
         {
-            case    RECIPE_FORMAT_BOF:
-            {
-                decode_bof( rcb_p );
-                ok_to_encode = true;
-            }   break;
-            case    RECIPE_FORMAT_MXP:
-            {
-                //  Decode a MasterCook recipe
-                decode_mxp( rcb_p );
-                ok_to_encode = true;
-            }   break;
-            case    RECIPE_FORMAT_MX2:
-            {
-                //  @ToDo: 3 mx2 decode
-                log_write( MID_WARNING, tcb_p->thread_name,
-                           "Decode for recipe format 'MX2' is not available\n" );
-                //  Clean out the recipe control block
-                ok_to_encode = false;
-            }   break;
-            case    RECIPE_FORMAT_MMF:
-            {
-                //  Decode a Meal-Master recipe
-                decode_mmf( rcb_p );
-                ok_to_encode = true;
-            }   break;
-            case    RECIPE_FORMAT_RXF:
-            {
-                //  Decode a Recipe eXchange Format recipe
-                decode_rxf( rcb_p );
-                ok_to_encode = true;
-            }   break;
-            case    RECIPE_FORMAT_NYC:
-            {
-                //  @ToDo: 3 nyc decode
-                log_write( MID_WARNING, tcb_p->thread_name,
-                           "Decode for recipe format 'NYC' is not available\n" );
-                //  Clean out the recipe control block
-                ok_to_encode = false;
-            }   break;
-            case    RECIPE_FORMAT_CP2:
-            {
-                //  @ToDo: 3 cp2 decode
-                log_write( MID_WARNING, tcb_p->thread_name,
-                           "Decode for recipe format 'CP2' is not available\n" );
-                //  Clean out the recipe control block
-                ok_to_encode = false;
-            }   break;
-            case    RECIPE_FORMAT_GRF:
-            {
-                //  @ToDo: 3 grf decode
-                log_write( MID_WARNING, tcb_p->thread_name,
-                           "Decode for recipe format 'GRF' is not available\n" );
-                //  Clean out the recipe control block
-                ok_to_encode = false;
-            }   break;
-            case    RECIPE_FORMAT_GF2:
-            {
-                //  @ToDo: 3 gf2 decode
-                log_write( MID_WARNING, tcb_p->thread_name,
-                           "Decode for recipe format 'GF2' is not available\n" );
-                //  Clean out the recipe control block
-                ok_to_encode = false;
-            }   break;
-            case    RECIPE_FORMAT_ERD:
-            {
-                //  @ToDo: 3 erd decode
-                log_write( MID_WARNING, tcb_p->thread_name,
-                           "Decode for recipe format 'ERD' is not available\n" );
-                //  Clean out the recipe control block
-                ok_to_encode = false;
-            }   break;
-            case    RECIPE_FORMAT_TXT:
-            {
-                //  @ToDo: 3 txt decode
-                log_write( MID_WARNING, tcb_p->thread_name,
-                           "Decode for recipe format 'TXT' is not available\n" );
-                //  Clean out the recipe control block
-                ok_to_encode = false;
-            }   break;
-            default:
-            {
-                //  OOPS.
-                log_write( MID_WARNING, tcb_p->thread_name,
-                           "recipe format (%d)\n",
-                           rcb_p->recipe_format );
-                //  Clean out the recipe control block
-                ok_to_encode = false;
-            }
-        }
-
-
-        /********************************************************************
-         *  Pass the recipe on to the recipe encoder.
-         ********************************************************************/
+            //  Get the current File-ID.
+            rcb_p = rcb_list[ ndx ];
 
-        //  Is it OK to encode this recipe ?
-        if ( ok_to_encode == true )
-        {
-            //  Post processing recipe format.
-            decode_post( rcb_p );
+            //  This thread is now the owner of the RCB
+            rcb_p->tcb_p = tcb_p;
 
-            //  Perform the final verification
-            ok_to_encode = DECODE__recipe_verify( rcb_p );
+            //  Progress report.
+            log_write( MID_LOGONLY, tcb_p->thread_name,
+                       "SIZE: %10d - FILE-ID: %s\n",
+                       list_query_count( rcb_p->import_list_p ),
+                       rcb_p->file_path );
 
-            //  Put it in one of the IMPORT queue's
-            queue_put_payload( encode_tcb->queue_id, rcb_p  );
-        }
-        else
-        {
-            //  NO:     Kill the RCB
-            rcb_kill( rcb_p );
+            //  Process the payload
+            decode_rcb( tcb_p, rcb_p );
         }
 
-#else
-
-        //  Kill the Recipe Control Block
-        rcb_kill( rcb_p );
-
-#endif
+        //  Hand the rest of the batch to the ENCODE queue
+        tcb_batch_flush( tcb_p );
 
         //  Change execution state to "INITIALIZED" for work.
-        tcb_p->thread_state = TS_WAIT;
+        tcb_set_state( tcb_p, TS_WAIT );
     }
 
     /************************************************************************
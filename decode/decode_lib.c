@@ -31,6 +31,7 @@
                                 //*******************************************
 #include <ctype.h>              //  Determine the type contained
 #include <string.h>             //  Functions for managing strings
+#include <limits.h>             //  INT_MIN, INT_MAX, LONG_MAX
                                 //*******************************************
 
 /****************************************************************************
@@ -423,6 +424,77 @@ struct   recipe_t
     return( decode_rc );
 }
 
+/****************************************************************************/
+/**
+ *  Look up the first three letters of a name.
+ *
+ *  @param  name_p              A pointer to the name
+ *  @param  abbreviation_p      Three letter lower case abbreviations
+ *
+ *  @return                     The abbreviation number 1 -> N, else 0.
+ *
+ *  @note
+ *      The same as strncasecmp( abbreviation, name_p, 3 ) for each one of
+ *      the abbreviations but the name is only folded to lower case once.
+ *
+ ****************************************************************************/
+
+static
+int
+DECODE__abbreviation(
+    char                    *   name_p,
+    char                    *   abbreviation_p
+    )
+{
+    /**
+     *  @param  number          The abbreviation number                     */
+    int                         number;
+    /**
+     *  @param  key             The name in lower case                      */
+    char                        key[ 3 ];
+    /**
+     *  @param  ndx             Index into the key                          */
+    int                         ndx;
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+    //  Initialize variables
+    number = 0;
+    memset( key, '\0', sizeof( key ) );
+
+    //  Fold the first three characters (don't go past the end)
+    for ( ndx = 0; ( ndx < 3 ) && ( name_p[ ndx ] != '\0' ); ndx += 1 )
+    {
+        key[ ndx ] = tolower( (unsigned char)name_p[ ndx ] );
+    }
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    for ( ndx = 0; abbreviation_p[ ndx ] != '\0'; ndx += 3 )
+    {
+        //  Is this the one ?
+        if (    ( key[ 0 ] == abbreviation_p[ ndx + 0 ] )
+             && ( key[ 1 ] == abbreviation_p[ ndx + 1 ] )
+             && ( key[ 2 ] == abbreviation_p[ ndx + 2 ] ) )
+        {
+            //  YES:    Done
+            number = ( ndx / 3 ) + 1;
+            break;
+        }
+    }
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+    return( number );
+}
+
 /****************************************************************************/
 /**
  *  Convert a text AM or PM to a integer.
@@ -502,20 +574,8 @@ DECODE__day_of_week(
      *  Function Body
      ************************************************************************/
 
-         if ( strncasecmp( "Sun",        dow_p, 3 ) == 0 ) dow =  1;
-    else if ( strncasecmp( "Mon",        dow_p, 3 ) == 0 ) dow =  2;
-    else if ( strncasecmp( "Tue",        dow_p, 3 ) == 0 ) dow =  3;
-    else if ( strncasecmp( "Wed",        dow_p, 3 ) == 0 ) dow =  4;
-    else if ( strncasecmp( "Thu",        dow_p, 3 ) == 0 ) dow =  5;
-    else if ( strncasecmp( "Fri",        dow_p, 3 ) == 0 ) dow =  6;
-    else if ( strncasecmp( "Sat",        dow_p, 3 ) == 0 ) dow =  7;
-    else if ( strncasecmp( "Sunday",     dow_p, 6 ) == 0 ) dow =  1;
-    else if ( strncasecmp( "Monday",     dow_p, 6 ) == 0 ) dow =  2;
-    else if ( strncasecmp( "Tuesday",    dow_p, 7 ) == 0 ) dow =  3;
-    else if ( strncasecmp( "Wednesday",  dow_p, 9 ) == 0 ) dow =  4;
-    else if ( strncasecmp( "Thursday",   dow_p, 8 ) == 0 ) dow =  5;
-    else if ( strncasecmp( "Friday",     dow_p, 6 ) == 0 ) dow =  6;
-    else if ( strncasecmp( "Saturday",   dow_p, 8 ) == 0 ) dow =  7;
+    //  Every name starts with its three letter abbreviation
+    dow = DECODE__abbreviation( dow_p, "sunmontuewedthufrisat" );
 
     /************************************************************************
      *  Function Exit
@@ -558,30 +618,8 @@ DECODE__month(
      *  Function Body
      ************************************************************************/
 
-         if ( strncasecmp( "Jan",        month_p, 3 ) == 0 ) month =  1;
-    else if ( strncasecmp( "Feb",        month_p, 3 ) == 0 ) month =  2;
-    else if ( strncasecmp( "Mar",        month_p, 3 ) == 0 ) month =  3;
-    else if ( strncasecmp( "Apr",        month_p, 3 ) == 0 ) month =  4;
-    else if ( strncasecmp( "May",        month_p, 3 ) == 0 ) month =  5;
-    else if ( strncasecmp( "Jun",        month_p, 3 ) == 0 ) month =  6;
-    else if ( strncasecmp( "Jul",        month_p, 3 ) == 0 ) month =  7;
-    else if ( strncasecmp( "Aug",        month_p, 3 ) == 0 ) month =  8;
-    else if ( strncasecmp( "Sep",        month_p, 3 ) == 0 ) month =  9;
-    else if ( strncasecmp( "Oct",        month_p, 3 ) == 0 ) month = 10;
-    else if ( strncasecmp( "Nov",        month_p, 3 ) == 0 ) month = 11;
-    else if ( strncasecmp( "Dec",        month_p, 3 ) == 0 ) month = 12;
-    else if ( strncasecmp( "January",    month_p, 7 ) == 0 ) month =  1;
-    else if ( strncasecmp( "February",   month_p, 8 ) == 0 ) month =  2;
-    else if ( strncasecmp( "March",      month_p, 5 ) == 0 ) month =  3;
-    else if ( strncasecmp( "April",      month_p, 5 ) == 0 ) month =  4;
-    else if ( strncasecmp( "May",        month_p, 3 ) == 0 ) month =  5;
-    else if ( strncasecmp( "June",       month_p, 4 ) == 0 ) month =  6;
-    else if ( strncasecmp( "July",       month_p, 4 ) == 0 ) month =  7;
-    else if ( strncasecmp( "August",     month_p, 6 ) == 0 ) month =  8;
-    else if ( strncasecmp( "September",  month_p, 9 ) == 0 ) month =  9;
-    else if ( strncasecmp( "October",    month_p, 7 ) == 0 ) month = 10;
-    else if ( strncasecmp( "November",   month_p, 8 ) == 0 ) month = 11;
-    else if ( strncasecmp( "December",   month_p, 8 ) == 0 ) month = 12;
+    //  Every name starts with its three letter abbreviation
+    month = DECODE__abbreviation( month_p, "janfebmaraprmayjunjulaugsepoctnovdec" );
 
     /************************************************************************
      *  Function Exit
@@ -591,6 +629,421 @@ DECODE__month(
     return( month );
 }
 
+/****************************************************************************/
+/**
+ *  Test for a character that separates the words of a date / time string.
+ *
+ *  @param  data                The character
+ *
+ *  @return separator           TRUE for white space and  : / - , ( )
+ *
+ *  @note
+ *
+ ****************************************************************************/
+
+static
+int
+DECODE__dt_separator(
+    char                        data
+    )
+{
+    /**
+     *  @param  separator       Return code from this function              */
+    int                         separator;
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    switch( data )
+    {
+        case    ':':
+        case    '/':
+        case    '-':
+        case    ',':
+        case    '(':
+        case    ')':
+        {
+            separator = true;
+        }   break;
+
+        default:
+        {
+            separator = ( isspace( (unsigned char)data ) != 0 );
+        }   break;
+    }
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+    return( separator );
+}
+
+/****************************************************************************/
+/**
+ *  Break a date / time string into tokens.
+ *
+ *  @param  src_datetime_p      Pointer to the source date / time string
+ *  @param  token_p             Array of DECODE_DT_TOKENS tokens
+ *
+ *  @return token_count         Number of tokens found
+ *
+ *  @note
+ *      Words are separated by white space and  : / - , ( )
+ *      A word that starts with a number is split into its numbers (a '+'
+ *      starts the next one) and whatever text follows them, the same way
+ *      sscanf( "%d" ) would take it apart.  Any other word is one text
+ *      token.  No pattern has more than DECODE_DT_SLOTS fields, so only
+ *      that many words (and numbers in a word) are kept.
+ *
+ *      The text of each token (to the end of its word) is looked up as a
+ *      month, a Day-Of-Week and AM or PM here so the patterns don't have
+ *      to do it over and over.  The names are all letters, so the lookup
+ *      stops at the separator that ends the word.
+ *
+ ****************************************************************************/
+
+int
+DECODE__dt_tokenize(
+    char                    *   src_datetime_p,
+    struct  decode_dt_token_t   *   token_p
+    )
+{
+    /**
+     *  @param  token_count     Number of tokens found                      */
+    int                         token_count;
+    /**
+     *  @param  word_count      Number of words found                       */
+    int                         word_count;
+    /**
+     *  @param  number_count    Number of numbers in this word              */
+    int                         number_count;
+    /**
+     *  @param  first_token     Index of the first token of this word       */
+    int                         first_token;
+    /**
+     *  @param  data_p          Scan pointer                                */
+    char                    *   data_p;
+    /**
+     *  @param  number          The number being built                      */
+    long                        number;
+    /**
+     *  @param  digit           One digit                                   */
+    int                         digit;
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+    //  Initialize variables
+    token_count = 0;
+    word_count  = 0;
+    data_p      = src_datetime_p;
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    while( word_count < DECODE_DT_SLOTS )
+    {
+        //  Skip to the start of the next word
+        while( ( data_p[ 0 ] != '\0' ) && ( DECODE__dt_separator( data_p[ 0 ] ) == true ) )
+        {
+            data_p += 1;
+        }
+
+        //  Is this the end of the string ?
+        if ( data_p[ 0 ] == '\0' )
+        {
+            //  YES:    Done
+            break;
+        }
+
+        //  Start a new word
+        word_count  += 1;
+        number_count = 0;
+        first_token  = token_count;
+
+        //  Split off the numbers
+        while(    ( number_count < DECODE_DT_SLOTS )
+               && (    ( isdigit( (unsigned char)data_p[ 0 ] ) != 0 )
+                    || (    ( data_p[ 0 ] == '+' )
+                         && ( isdigit( (unsigned char)data_p[ 1 ] ) != 0 ) ) ) )
+        {
+            memset( &token_p[ token_count ], '\0', sizeof( token_p[ 0 ] ) );
+            token_p[ token_count ].text_p    = data_p;
+            token_p[ token_count ].is_number = true;
+
+            //  Skip the sign
+            if ( data_p[ 0 ] == '+' )
+            {
+                data_p += 1;
+            }
+
+            //  Build the number (it stops at LONG_MAX like strtol( ) does)
+            for ( number = 0;
+                  isdigit( (unsigned char)data_p[ 0 ] ) != 0;
+                  data_p += 1 )
+            {
+                digit = data_p[ 0 ] - '0';
+
+                if ( number <= ( LONG_MAX - digit ) / 10 )
+                {
+                    number = ( number * 10 ) + digit;
+                }
+                else
+                {
+                    number = LONG_MAX;
+                }
+            }
+
+            //  NOTE:   sscanf( "%d" ) keeps what fits in an int
+            token_p[ token_count ].number = (int)number;
+
+            token_count  += 1;
+            number_count += 1;
+        }
+
+        //  Is there text left in the word ?
+        if (    ( number_count < DECODE_DT_SLOTS )
+             && ( data_p[ 0 ] != '\0' )
+             && ( DECODE__dt_separator( data_p[ 0 ] ) == false ) )
+        {
+            //  YES:    One text token for the rest of the word
+            memset( &token_p[ token_count ], '\0', sizeof( token_p[ 0 ] ) );
+            token_p[ token_count ].text_p    = data_p;
+            token_p[ token_count ].is_number = false;
+            token_p[ token_count ].month     = DECODE__month( data_p );
+            token_p[ token_count ].dow       = DECODE__day_of_week( data_p );
+            token_p[ token_count ].ap        = DECODE__am_or_pm( data_p );
+
+            token_count += 1;
+        }
+
+        //  Skip to the end of the word
+        while( ( data_p[ 0 ] != '\0' ) && ( DECODE__dt_separator( data_p[ 0 ] ) == false ) )
+        {
+            data_p += 1;
+        }
+
+        //  Link the tokens of this word to the next word
+        for ( ; first_token < token_count; first_token += 1 )
+        {
+            token_p[ first_token ].next_word = token_count;
+        }
+    }
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+    return( token_count );
+}
+
+/****************************************************************************/
+/**
+ *  Match date / time tokens to a pattern.
+ *
+ *  @param  pattern_p           Pointer to the pattern
+ *  @param  token_p             The tokens
+ *  @param  token_count         Number of tokens
+ *  @param  text_ndx            The token last used for each text field
+ *  @param  field               The date / time values that were found
+ *
+ *  @return match               TRUE when the tokens match the pattern
+ *
+ *  @note
+ *      The fields are taken in order until a token doesn't fit.  A field
+ *      that isn't found is -1.
+ *
+ *      The patterns used to be sscanf( ) calls that shared the month,
+ *      Day-Of-Week and AM/PM text buffers.  A text field that wasn't found
+ *      kept the text from an earlier pattern.  text_ndx[ ] does the same
+ *      thing (-1 is no text) so every string still decodes the same way.
+ *
+ ****************************************************************************/
+
+int
+DECODE__dt_match(
+    struct  decode_dt_pattern_t *   pattern_p,
+    struct  decode_dt_token_t   *   token_p,
+    int                         token_count,
+    int                         text_ndx[ DT_FIELDS ],
+    int                         field[ DT_FIELDS ]
+    )
+{
+    /**
+     *  @param  match           Return code from this function              */
+    int                         match;
+    /**
+     *  @param  slot_p          The next field of the pattern               */
+    char                    *   slot_p;
+    /**
+     *  @param  ndx             Index of the next token                     */
+    int                         ndx;
+    /**
+     *  @param  found           TRUE while the tokens fit the pattern       */
+    int                         found;
+    /**
+     *  @param  field_ndx       Field number                                */
+    int                         field_ndx;
+    /**
+     *  @param  value           Value of one field                          */
+    int                         value;
+    /**
+     *  @param  low             Smallest valid value for each field         */
+    static
+    int                         low[ DT_FIELDS ]  =
+        { INT_MIN,  1,  1,  0,  0,  0,  1,  1 };
+    /**
+     *  @param  high            Biggest valid value for each field          */
+    static
+    int                         high[ DT_FIELDS ] =
+        { INT_MAX, 12, 31, 23, 59, 59,  7,  2 };
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+    //  Initialize variables
+    match = true;
+    ndx   = 0;
+    found = true;
+
+    //  Nothing has been found yet
+    for ( field_ndx = 0; field_ndx < DT_FIELDS; field_ndx += 1 )
+    {
+        field[ field_ndx ] = -1;
+    }
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    for ( slot_p = pattern_p->slot_p; slot_p[ 0 ] != '\0'; slot_p += 1 )
+    {
+        //  Is there a token for this field ?
+        if ( ndx >= token_count )
+        {
+            //  NO:     Nothing more will be found
+            found = false;
+        }
+
+        //  Which field is it ?
+        switch( slot_p[ 0 ] )
+        {
+            case    'Y':    field_ndx = DT_YEAR;        break;
+            case    'M':    field_ndx = DT_MONTH;       break;
+            case    'N':    field_ndx = DT_MONTH;       break;
+            case    'D':    field_ndx = DT_DAY;         break;
+            case    'h':    field_ndx = DT_HOUR;        break;
+            case    'm':    field_ndx = DT_MINUTE;      break;
+            case    's':    field_ndx = DT_SECOND;      break;
+            case    'W':    field_ndx = DT_DOW;         break;
+            default:        field_ndx = DT_AP;          break;
+        }
+
+        //  Is it text ?
+        if (    ( slot_p[ 0 ] == 'N' )
+             || ( slot_p[ 0 ] == 'W' )
+             || ( slot_p[ 0 ] == 'A' ) )
+        {
+            //  YES:    Take the rest of the word
+            if ( found == true )
+            {
+                text_ndx[ field_ndx ] = ndx;
+                ndx = token_p[ ndx ].next_word;
+            }
+
+            //  Look it up (text that wasn't replaced is still there)
+            if ( text_ndx[ field_ndx ] == -1 )
+            {
+                field[ field_ndx ] = 0;
+            }
+            else if ( field_ndx == DT_MONTH )
+            {
+                field[ field_ndx ] = token_p[ text_ndx[ field_ndx ] ].month;
+            }
+            else if ( field_ndx == DT_DOW )
+            {
+                field[ field_ndx ] = token_p[ text_ndx[ field_ndx ] ].dow;
+            }
+            else
+            {
+                field[ field_ndx ] = token_p[ text_ndx[ field_ndx ] ].ap;
+            }
+        }
+
+        //  Is it a number ?
+        else if (    ( found == true )
+                  && ( token_p[ ndx ].is_number == true ) )
+        {
+            //  YES:    Take it
+            field[ field_ndx ] = token_p[ ndx ].number;
+            ndx += 1;
+        }
+        else
+        {
+            //  NO:     Nothing more will be found
+            found = false;
+        }
+    }
+
+    //  Check every field against its rule
+    for ( field_ndx = 0;
+          ( field_ndx < DT_FIELDS ) && ( match == true );
+          field_ndx += 1 )
+    {
+        value = field[ field_ndx ];
+
+        switch( pattern_p->rule[ field_ndx ] )
+        {
+            case    DT_ANY:
+            {
+                //  Anything goes
+            }   break;
+
+            case    DT_NONE:
+            {
+                match = ( value == -1 );
+            }   break;
+
+            case    DT_VALID:
+            {
+                match = (    ( value != -1 )
+                          && ( value >= low[ field_ndx ]  )
+                          && ( value <= high[ field_ndx ] ) );
+            }   break;
+
+            case    DT_OVER_70:
+            {
+                match = ( value > 70 );
+            }   break;
+
+            case    DT_BLANK:
+            {
+                match = ( value == 0 );
+            }   break;
+
+            case    DT_NONE_OR_OVER:
+            {
+                match = (    ( value == -1 )
+                          || ( value >  high[ field_ndx ] ) );
+            }   break;
+        }
+    }
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+    return( match );
+}
+
 /****************************************************************************/
 /**
  *  Format an UNIT field.
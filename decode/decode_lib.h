@@ -47,6 +47,12 @@
  ****************************************************************************/
 
 //----------------------------------------------------------------------------
+/**
+ *  @param  DECODE_DT_SLOTS     Most fields in one date / time pattern      */
+#define DECODE_DT_SLOTS         (    8 )
+/**
+ *  @param  DECODE_DT_TOKENS    Most date / time tokens that are kept       */
+#define DECODE_DT_TOKENS        ( DECODE_DT_SLOTS * DECODE_DT_SLOTS )
 //----------------------------------------------------------------------------
 
 /****************************************************************************
@@ -54,6 +60,28 @@
  ****************************************************************************/
 
 //----------------------------------------------------------------------------
+enum    decode_dt_field_e
+{
+    DT_YEAR                     =   0,
+    DT_MONTH                    =   1,
+    DT_DAY                      =   2,
+    DT_HOUR                     =   3,
+    DT_MINUTE                   =   4,
+    DT_SECOND                   =   5,
+    DT_DOW                      =   6,      //  Day-Of-Week
+    DT_AP                       =   7,      //  AM or PM
+    DT_FIELDS                   =   8       //  Number of fields
+};
+//----------------------------------------------------------------------------
+enum    decode_dt_rule_e
+{
+    DT_ANY                      =   0,      //  Anything (or nothing)
+    DT_NONE                     =   1,      //  Not found
+    DT_VALID                    =   2,      //  Found and in range
+    DT_OVER_70                  =   3,      //  A year after 70
+    DT_BLANK                    =   4,      //  Text that isn't AM or PM
+    DT_NONE_OR_OVER             =   5       //  Not found or too big
+};
 //----------------------------------------------------------------------------
 
 /****************************************************************************
@@ -61,6 +89,49 @@
  ****************************************************************************/
 
 //----------------------------------------------------------------------------
+/**
+ *  @param  decode_dt_token_t   One token of a date / time string           */
+struct  decode_dt_token_t
+{
+    /**
+     *  @param  text_p          The token in the source string              */
+    char                    *   text_p;
+    /**
+     *  @param  is_number       TRUE when the token is a number             */
+    int                         is_number;
+    /**
+     *  @param  number          The number                                  */
+    int                         number;
+    /**
+     *  @param  next_word       Index of the first token of the next word   */
+    int                         next_word;
+    /**
+     *  @param  month           Month of the rest of the word (or 0)        */
+    int                         month;
+    /**
+     *  @param  dow             Day-Of-Week of the rest of the word (or 0)  */
+    int                         dow;
+    /**
+     *  @param  ap              AM or PM of the rest of the word (or 0)     */
+    int                         ap;
+};
+//----------------------------------------------------------------------------
+/**
+ *  @param  decode_dt_pattern_t One date / time pattern                     */
+struct  decode_dt_pattern_t
+{
+    /**
+     *  @param  id_p            Sequence-ID                                 */
+    char                    *   id_p;
+    /**
+     *  @param  slot_p          The fields in the order they are found:
+     *                          Y M D h m s are numbers, N is a month name,
+     *                          W is a Day-Of-Week and A is AM or PM        */
+    char                    *   slot_p;
+    /**
+     *  @param  rule            What each field must be for a match         */
+    enum    decode_dt_rule_e    rule[ DT_FIELDS ];
+};
 //----------------------------------------------------------------------------
 
 /****************************************************************************
@@ -82,6 +153,11 @@ DECODE__TEST_fmt_datetime(
     void
     );
 //----------------------------------------------------------------------------
+void
+DECODE__BENCH_fmt_datetime(
+    void
+    );
+//----------------------------------------------------------------------------
 int
 DECODE__recipe_verify(
     struct  rcb_t           *   rcb_p
@@ -103,6 +179,21 @@ DECODE__month(
     );
 //----------------------------------------------------------------------------
 int
+DECODE__dt_tokenize(
+    char                    *   src_datetime_p,
+    struct  decode_dt_token_t   *   token_p
+    );
+//----------------------------------------------------------------------------
+int
+DECODE__dt_match(
+    struct  decode_dt_pattern_t *   pattern_p,
+    struct  decode_dt_token_t   *   token_p,
+    int                         token_count,
+    int                         text_ndx[ DT_FIELDS ],
+    int                         field[ DT_FIELDS ]
+    );
+//----------------------------------------------------------------------------
+int
 DECODE__is_preperations(
     char                    *   data_p
     );
@@ -42,6 +42,7 @@
                                 //*******************************************
 #include "tcb_api.h"            //  API for all tcb_*               PUBLIC
 #include "rcb_api.h"            //  API for all rcb_*               PUBLIC
+#include "import_api.h"         //  API for all import_*            PUBLIC
 #include "recipe_api.h"         //  API for all recipe_*            PUBLIC
                                 //*******************************************
 #include "decode_api.h"         //  API for all decode_*            PUBLIC
@@ -84,6 +85,16 @@ enum    mmf_decode_state_e
  ****************************************************************************/
 
 //----------------------------------------------------------------------------
+/**
+ *  @param  mmf_format          Meal-Master
+ *      start   "-----", "MMMMM", "- -----" ... "Meal-Master", "Recipe via...",
+ *              ":MMMMM...", "----- Now You're Cooking!" ...
+ *      end     "-----", "MMMMM", "- -----", "-+-", "-----...-----" (any case) */
+struct  decode_format_t         mmf_format =
+{
+    RECIPE_FORMAT_MMF,  "MMF",  mmf_is_start,   mmf_is_end,     decode_mmf,
+    "-:MR", "-Mm",  { "meal-master", "now you're cooking" }
+};
 //----------------------------------------------------------------------------
 
 /****************************************************************************
@@ -343,7 +354,7 @@ decode_mmf(
         }
 
         //  Free the buffer
-        mem_free( list_data_p );
+        import_line_free( rcb_p, list_data_p );
     }
 
     /************************************************************************
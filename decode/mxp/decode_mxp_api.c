@@ -41,6 +41,7 @@
                                 //*******************************************
 #include "tcb_api.h"            //  API for all tcb_*               PUBLIC
 #include "rcb_api.h"            //  API for all rcb_*               PUBLIC
+#include "import_api.h"         //  API for all import_*            PUBLIC
 #include "recipe_api.h"         //  API for all recipe_*            PUBLIC
                                 //*******************************************
 #include "decode_api.h"         //  API for all decode_*            PUBLIC
@@ -87,6 +88,15 @@ enum    mxp_decode_state_e
  ****************************************************************************/
 
 //----------------------------------------------------------------------------
+/**
+ *  @param  mxp_format          MasterCook eXport
+ *      start   "*  Exported from...", "{ Exported from MasterCook Mac }"
+ *      end     There is no end marker.                                     */
+struct  decode_format_t         mxp_format =
+{
+    RECIPE_FORMAT_MXP,  "MXP",  mxp_is_start,   mxp_is_end,     decode_mxp,
+    "*{",   "",     { "exported" }
+};
 //----------------------------------------------------------------------------
 
 /****************************************************************************
@@ -369,7 +379,7 @@ decode_mxp(
         }
 
         //  Free the buffer
-        mem_free( list_data_p );
+        import_line_free( rcb_p, list_data_p );
     }
 
     /************************************************************************
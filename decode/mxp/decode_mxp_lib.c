@@ -989,7 +989,7 @@ DECODE_MXP__notes(
      ************************************************************************/
 
     //  NO:     Continue (or start) the notes decode.
-    if ( note_state == MXP_NS_IDLE )
+    if ( recipe_p->note_scan_state == MXP_NS_IDLE )
     {
         //----------------------------------------------------------------
         //  Is this a blank line ?
@@ -1003,7 +1003,7 @@ DECODE_MXP__notes(
         if ( strncasecmp( tmp_data_p, MXP_PER_SERVING, MXP_PER_SERVING_L ) == 0 )
         {
             //  Change the state
-            note_state = MXP_NS_PER_SERVING;
+            recipe_p->note_scan_state = MXP_NS_PER_SERVING;
         }
         //----------------------------------------------------------------
         //  "Nutr. Assoc."
@@ -1011,7 +1011,7 @@ DECODE_MXP__notes(
         if ( strncasecmp( tmp_data_p, MXP_NUTR_ASSOC, MXP_NUTR_ASSOC_L ) == 0 )
         {
             //  Change the state
-            note_state = MXP_NS_NUTR_ASSOC;
+            recipe_p->note_scan_state = MXP_NS_NUTR_ASSOC;
         }
         //----------------------------------------------------------------
         //  "NOTES :"
@@ -1019,7 +1019,7 @@ DECODE_MXP__notes(
         if ( strncasecmp( tmp_data_p, MXP_NOTES, MXP_NOTES_L ) == 0 )
         {
             //  Change the state
-            note_state = MXP_NS_NOTES;
+            recipe_p->note_scan_state = MXP_NS_NOTES;
         }
         //----------------------------------------------------------------
         //  "Suggested Wine:"
@@ -1027,7 +1027,7 @@ DECODE_MXP__notes(
         if ( strncasecmp( tmp_data_p, MXP_WINE, MXP_WINE_L ) == 0 )
         {
             //  Change the state
-            note_state = MXP_NS_WINE;
+            recipe_p->note_scan_state = MXP_NS_WINE;
         }
         //----------------------------------------------------------------
         //  "Serving Ideas:"
@@ -1035,7 +1035,7 @@ DECODE_MXP__notes(
         if ( strncasecmp( tmp_data_p, MXP_SERVING_IDEAS, MXP_SERVING_IDEAS_L ) == 0 )
         {
             //  Change the state
-            note_state = MXP_NS_SERVING_IDEAS;
+            recipe_p->note_scan_state = MXP_NS_SERVING_IDEAS;
         }
         //----------------------------------------------------------------
         //  Not a valid notes tag.
@@ -1046,8 +1046,8 @@ DECODE_MXP__notes(
         }
     }
     //--------------------------------------------------------------------
-    if (    ( note_state == MXP_NS_SERVING_IDEAS )
-         || ( note_state == MXP_NS_NOTES         ) )
+    if (    ( recipe_p->note_scan_state == MXP_NS_SERVING_IDEAS )
+         || ( recipe_p->note_scan_state == MXP_NS_NOTES         ) )
     {
         //  Is this the start of another section ?
         if (    ( strncasecmp( tmp_data_p, MXP_PER_SERVING,   MXP_PER_SERVING_L   ) != 0 )
@@ -1072,13 +1072,13 @@ DECODE_MXP__notes(
         else
         {
             //  NO:     Change the state
-            note_state = MXP_NS_IDLE;
+            recipe_p->note_scan_state = MXP_NS_IDLE;
         }
     }
     //--------------------------------------------------------------------
-    if (    ( note_state == MXP_NS_PER_SERVING )
-         || ( note_state == MXP_NS_WINE        )
-         || ( note_state == MXP_NS_NUTR_ASSOC  ) )
+    if (    ( recipe_p->note_scan_state == MXP_NS_PER_SERVING )
+         || ( recipe_p->note_scan_state == MXP_NS_WINE        )
+         || ( recipe_p->note_scan_state == MXP_NS_NUTR_ASSOC  ) )
     {
         //  @note:  Information from these three sections will be deleted
 
@@ -1086,7 +1086,7 @@ DECODE_MXP__notes(
         if ( text_is_blank_line( tmp_data_p ) == true )
         {
             //  YES:    Change the state
-            note_state = MXP_NS_IDLE;
+            recipe_p->note_scan_state = MXP_NS_IDLE;
         }
     }
 
@@ -52,15 +52,6 @@
  ****************************************************************************/
 
 //----------------------------------------------------------------------------
-enum    mxp_note_state_e
-{
-    MXP_NS_IDLE                 =    0,
-    MXP_NS_PER_SERVING          =    1,
-    MXP_NS_WINE                 =    2,
-    MXP_NS_SERVING_IDEAS        =    3,
-    MXP_NS_NOTES                =    4,
-    MXP_NS_NUTR_ASSOC           =    5
-};
 //----------------------------------------------------------------------------
 
 /****************************************************************************
@@ -75,8 +66,6 @@ enum    mxp_note_state_e
  ****************************************************************************/
 
 //----------------------------------------------------------------------------
-DECODE_MXP_EXT
-enum    mxp_note_state_e            note_state;
 //----------------------------------------------------------------------------
 
 /****************************************************************************
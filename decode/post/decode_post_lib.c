@@ -381,14 +381,6 @@ DECODE_POST__fmt_directions(
     /**
      *  @param  index           Scan index                                  */
     int                         index;
-    /**
-     *  @param  fwos            First Word of Sentence                      */
-    static
-    int                         fwos;
-    /**
-     *  @param  fwol            First Word of Line                          */
-    static
-    int                         fwol;
     /**
      *  @param  tmp_p           Pointer to a temporary buffer               */
     char                    *   tmp_p;
@@ -401,12 +393,12 @@ DECODE_POST__fmt_directions(
     if ( list_query_count( rcb_p->recipe_p->directions_p ) == 0 )
     {
         //  YES:    Reset the first word flags
-        fwos = true;
-        fwol = true;
+        rcb_p->recipe_p->directions_fwos = true;
+        rcb_p->recipe_p->directions_fwol = true;
     }
 
     //  Is the first word of a new line ?
-    if ( fwol == true )
+    if ( rcb_p->recipe_p->directions_fwol == true )
     {
         //  YES:    Clear the formatted line buffer
         memset( formatted_text, '\0', sizeof( formatted_text ) );
@@ -492,7 +484,7 @@ DECODE_POST__fmt_directions(
              ****************************************************************/
 
              // Is this a numbered directions sequence ?
-            if (    ( fwos == true )
+            if (    ( rcb_p->recipe_p->directions_fwos == true )
                  && ( isdigit( next_word[ 0 ] ) !=  0  )
                  && (    ( next_word[ 1 ]   == '.' )
                       || ( next_word[ 1 ]   == ')' )
@@ -504,7 +496,7 @@ DECODE_POST__fmt_directions(
                 next_word[ 0 ] = '\0';
 
                 //  That also makes whatever is next the First-Word-of-Line
-                fwol = true;
+                rcb_p->recipe_p->directions_fwol = true;
             }
 
             /****************************************************************
@@ -514,8 +506,8 @@ DECODE_POST__fmt_directions(
 
             if ( next_word[ 0 ] == '*' )
             {
-                fwos = true;
-                fwol = false;
+                rcb_p->recipe_p->directions_fwos = true;
+                rcb_p->recipe_p->directions_fwol = false;
             }
 
             /****************************************************************
@@ -554,8 +546,8 @@ DECODE_POST__fmt_directions(
             if ( strchr( next_word, ':' ) != NULL )
             {
                 //  YES:    Set the flags.
-                fwos = true;
-                fwol = true;
+                rcb_p->recipe_p->directions_fwos = true;
+                rcb_p->recipe_p->directions_fwol = true;
 
                 //  Is there anything in the formatted text buffer ?
                 if ( strlen( formatted_text ) > 0 )
@@ -578,8 +570,8 @@ DECODE_POST__fmt_directions(
              ****************************************************************/
 
             //  First-Word-Of-Sentence && First-Word-Of-Line && something to save
-            if (    ( fwos == true )
-                 && ( fwol == true )
+            if (    ( rcb_p->recipe_p->directions_fwos == true )
+                 && ( rcb_p->recipe_p->directions_fwol == true )
                  && ( strlen( next_word ) > 0 ) )
             {
                 //  YES:    Drop the new word in the output buffer.
@@ -589,8 +581,8 @@ DECODE_POST__fmt_directions(
                 formatted_text[ 0 ] = toupper( formatted_text[ 0 ] );
 
                 //  It is no lonfer the first word of anything.
-                fwos = false;
-                fwol = false;
+                rcb_p->recipe_p->directions_fwos = false;
+                rcb_p->recipe_p->directions_fwol = false;
             }
 
             /****************************************************************
@@ -598,8 +590,8 @@ DECODE_POST__fmt_directions(
              ****************************************************************/
 
             else
-            if (    ( fwos == true  )
-                 && ( fwol == false )
+            if (    ( rcb_p->recipe_p->directions_fwos == true  )
+                 && ( rcb_p->recipe_p->directions_fwol == false )
                  && ( strlen( next_word ) > 0 ) )
             {
                 //  This is the first word of a new sentence but not
@@ -627,8 +619,8 @@ DECODE_POST__fmt_directions(
                 strncat( formatted_text, " ",
                          MAX_LINE_L - strlen( formatted_text ) );
                 formatted_text[ 0 ] = toupper( formatted_text[ 0 ] );
-                fwos = false;
-                fwol = false;
+                rcb_p->recipe_p->directions_fwos = false;
+                rcb_p->recipe_p->directions_fwol = false;
             }
 
             /****************************************************************
@@ -636,15 +628,15 @@ DECODE_POST__fmt_directions(
              ****************************************************************/
 
             else
-            if (    ( fwos == false )
-                 && ( fwol == true  )
+            if (    ( rcb_p->recipe_p->directions_fwos == false )
+                 && ( rcb_p->recipe_p->directions_fwol == true  )
                  && ( strlen( next_word ) > 0 ) )
             {
                 //  Append the new word to an existing sentence.
                 strncat( formatted_text, next_word, MAX_LINE_L );
                 strncat( formatted_text, " ", MAX_LINE_L - strlen( formatted_text ) );
-                fwos = false;
-                fwol = false;
+                rcb_p->recipe_p->directions_fwos = false;
+                rcb_p->recipe_p->directions_fwol = false;
             }
 
             /****************************************************************
@@ -652,16 +644,16 @@ DECODE_POST__fmt_directions(
              ****************************************************************/
 
             else
-            if (    ( fwos == false )
-                 && ( fwol == false )
+            if (    ( rcb_p->recipe_p->directions_fwos == false )
+                 && ( rcb_p->recipe_p->directions_fwol == false )
                  && ( strlen( next_word ) > 0 ) )
             {
                 //  Append the new word to an existing sentence.
                 strncat( formatted_text, next_word, MAX_LINE_L );
                 strncat( formatted_text, " ",
                          MAX_LINE_L - strlen( formatted_text ) );
-                fwos = false;
-                fwol = false;
+                rcb_p->recipe_p->directions_fwos = false;
+                rcb_p->recipe_p->directions_fwol = false;
             }
             //  Is this the end of a sentence ?
             if ( next_word[ strlen( next_word ) - 1 ] == '.' )
@@ -669,10 +661,10 @@ DECODE_POST__fmt_directions(
                 //  YES:    Insert an extra space in the formatted text.
                 strncat( formatted_text, " ",
                          MAX_LINE_L - strlen( formatted_text ) );
-                fwos = true;
+                rcb_p->recipe_p->directions_fwos = true;
             }
             //  Is this a special ?
-            if (    ( fwos == true )
+            if (    ( rcb_p->recipe_p->directions_fwos == true )
                  && ( formatted_text[ 0 ] == '*' ) )
             {
                 //  YES:    Make sure there is something in the current line
@@ -688,7 +680,7 @@ DECODE_POST__fmt_directions(
 
                     //  Clear the formatted text buffer.
                     memset( formatted_text, '\0', sizeof( formatted_text ) );
-                    fwol = true;
+                    rcb_p->recipe_p->directions_fwol = true;
                 }
             }
 
@@ -699,8 +691,8 @@ DECODE_POST__fmt_directions(
     else
     {
         //  YES:    Whatever (if anything else) is next will start a new line.
-        fwos = true;
-        fwol = true;
+        rcb_p->recipe_p->directions_fwos = true;
+        rcb_p->recipe_p->directions_fwol = true;
     }
 
     /************************************************************************
@@ -2791,6 +2783,9 @@ DECODE_POST__recipe_id(
  *  @return void                No return code from this function.
  *
  *  @note
+ *      The file and e-Mail information is shared with the other recipes
+ *      from the same message.  It is only copied (rcb_info_own( )) when
+ *      one of the formatted strings is different.
  *
  ****************************************************************************/
 
@@ -2799,11 +2794,24 @@ DECODE_POST__datetime(
     struct  rcb_t           *   rcb_p
     )
 {
+    /**
+     *  @param  file_dt_p       Formatted FILE-INFO date/time               */
+    char                    *   file_dt_p;
+    /**
+     *  @param  e_dt_p          Formatted E-MAIL date/time                  */
+    char                    *   e_dt_p;
+    /**
+     *  @param  g_dt_p          Formatted GROUP date/time                   */
+    char                    *   g_dt_p;
 
     /************************************************************************
      *  Function Initialization
      ************************************************************************/
 
+    //  Nothing formatted yet
+    file_dt_p = NULL;
+    e_dt_p    = NULL;
+    g_dt_p    = NULL;
 
     /************************************************************************
      *  Function Code
@@ -2812,31 +2820,58 @@ DECODE_POST__datetime(
     //  FILE-INFO
     if ( strlen( rcb_p->file_info_p->date_time ) > 0 )
     {
-        strncpy( rcb_p->file_info_p->date_time,
-                 decode_fmt_datetime( rcb_p->file_info_p->date_time ),
-                 sizeof( rcb_p->file_info_p->date_time ) );
+        file_dt_p = decode_fmt_datetime( rcb_p->file_info_p->date_time );
     }
 
     //  E-MAIL: FROM
     if ( strlen( rcb_p->email_info_p->e_datetime ) > 0 )
     {
-        strncpy( rcb_p->email_info_p->e_datetime,
-                 decode_fmt_datetime( rcb_p->email_info_p->e_datetime ),
-                 sizeof( rcb_p->email_info_p->e_datetime ) );
+        e_dt_p    = decode_fmt_datetime( rcb_p->email_info_p->e_datetime );
     }
 
     //  E-MAIL: GROUP FROM
     if ( strlen( rcb_p->email_info_p->g_datetime ) > 0 )
     {
-        strncpy( rcb_p->email_info_p->g_datetime,
-                 decode_fmt_datetime( rcb_p->email_info_p->g_datetime ),
-                 sizeof( rcb_p->email_info_p->g_datetime ) );
+        g_dt_p    = decode_fmt_datetime( rcb_p->email_info_p->g_datetime );
+    }
+
+    //  Is anything different ?
+    if (    (    ( file_dt_p != NULL )
+              && ( strcmp( file_dt_p, rcb_p->file_info_p->date_time    ) != 0 ) )
+         || (    ( e_dt_p    != NULL )
+              && ( strcmp( e_dt_p,    rcb_p->email_info_p->e_datetime  ) != 0 ) )
+         || (    ( g_dt_p    != NULL )
+              && ( strcmp( g_dt_p,    rcb_p->email_info_p->g_datetime  ) != 0 ) ) )
+    {
+        //  YES:    Get a private copy and update it
+        rcb_info_own( rcb_p );
+
+        if ( file_dt_p != NULL )
+        {
+            strncpy( rcb_p->file_info_p->date_time, file_dt_p,
+                     sizeof( rcb_p->file_info_p->date_time ) );
+        }
+        if ( e_dt_p != NULL )
+        {
+            strncpy( rcb_p->email_info_p->e_datetime, e_dt_p,
+                     sizeof( rcb_p->email_info_p->e_datetime ) );
+        }
+        if ( g_dt_p != NULL )
+        {
+            strncpy( rcb_p->email_info_p->g_datetime, g_dt_p,
+                     sizeof( rcb_p->email_info_p->g_datetime ) );
+        }
     }
 
     /************************************************************************
      *  Function Exit
      ************************************************************************/
 
+    //  Release the formatted strings
+    if ( file_dt_p != NULL ) mem_free( file_dt_p );
+    if ( e_dt_p    != NULL ) mem_free( e_dt_p    );
+    if ( g_dt_p    != NULL ) mem_free( g_dt_p    );
+
     //  DONE!
 }
 /****************************************************************************/
\ No newline at end of file
@@ -41,6 +41,7 @@
                                 //*******************************************
 #include "tcb_api.h"            //  API for all tcb_*               PUBLIC
 #include "rcb_api.h"            //  API for all rcb_*               PUBLIC
+#include "import_api.h"         //  API for all import_*            PUBLIC
 #include "recipe_api.h"         //  API for all recipe_*            PUBLIC
                                 //*******************************************
 #include "decode_api.h"         //  API for all decode_*            PUBLIC
@@ -73,6 +74,15 @@
  ****************************************************************************/
 
 //----------------------------------------------------------------------------
+/**
+ *  @param  rxf_format          Recipe eXchange Format
+ *      start   "-----  Recipe Import Assist Start -----"
+ *      end     "-----  Recipe Import Assist End -----"                     */
+struct  decode_format_t         rxf_format =
+{
+    RECIPE_FORMAT_RXF,  "RXF",  rxf_is_start,   rxf_is_end,     decode_rxf,
+    "-",    "-",    { "recipe import assist start" }
+};
 //----------------------------------------------------------------------------
 
 /****************************************************************************
@@ -517,7 +527,7 @@ decode_rxf(
         }
 
         //  Free the buffer
-        mem_free( list_data_p );
+        import_line_free( rcb_p, list_data_p );
     }
 
     /************************************************************************
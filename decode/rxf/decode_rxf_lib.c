@@ -91,10 +91,6 @@ enum    data_type_e
  ****************************************************************************/
 
 //----------------------------------------------------------------------------
-/**
- * @param notes_parsing_flag        Set TRUE when parsing the notes segment */
-static
-int                                 notes_parsing_flag;
 //----------------------------------------------------------------------------
 
 /****************************************************************************
@@ -959,12 +955,12 @@ DECODE_RXF__do_recipe_data(
     if ( strncmp( in_buffer_p, RXF_RECIPE_NOTES, RXF_RECIPE_NOTES_L  ) == 0 )
     {
         //  YES:    Set the notes processing flag
-        notes_parsing_flag = true;
+        recipe_p->notes_parsing = true;
         log_write( MID_TEMPORARY, "DECODE_RXF__do_recipe_data", "RXF_RECIPE_SOURCE = TRUE\n" );
     }
     //  NOTES:
     else
-    if ( notes_parsing_flag == true  )
+    if ( recipe_p->notes_parsing == true  )
     {
         //  YES:    Add the text to the notes.
         decode_fmt_notes( recipe_p, in_buffer_p );
@@ -974,7 +970,7 @@ DECODE_RXF__do_recipe_data(
         if ( strlen( in_buffer_p ) == 0 )
         {
             //  YES:    Set the flag to false.
-            notes_parsing_flag = false;
+            recipe_p->notes_parsing = false;
         }
 
     }
@@ -1127,8 +1123,8 @@ DECODE_RXF__do_recipe_data(
     else
     {
         //  We are not parsing the notes field yet.
-        notes_parsing_flag = false;
-    log_write( MID_TEMPORARY, "DECODE_RXF__do_recipe_data", "DEFAULT: notes_parsing_flag = false\n" );
+        recipe_p->notes_parsing = false;
+    log_write( MID_TEMPORARY, "DECODE_RXF__do_recipe_data", "DEFAULT: notes_parsing = false\n" );
     }
 
     /************************************************************************
@@ -1176,6 +1172,9 @@ DECODE_RXF__do_source_info(
     //  Initialize variables
     tmp_data_p = NULL;
 
+    //  The source information is about to be replaced
+    rcb_info_own( rcb_p );
+
     /************************************************************************
      *  Function Body
      ************************************************************************/
@@ -1277,7 +1276,7 @@ DECODE_RXF__do_source_info(
 
         //  Save the file name where the recipe was first imported from
         if ( strlen( tmp_data_p ) >= 1 )
-            strncpy( rcb_p->file_path, tmp_data_p, sizeof( rcb_p->file_path ) );
+            strncpy( rcb_p->file_path, tmp_data_p, RCB_FILE_PATH_L );
     log_write( MID_TEMPORARY, "DECODE_RXF__do_recipe_data", "RXF_FILE_NAME -- %s\n", tmp_data_p );
     }
     //------------------------------------------------------------------------
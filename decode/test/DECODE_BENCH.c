@@ -0,0 +1,474 @@
+/*******************************  COPYRIGHT  ********************************/
+/**
+ *  Author? "Gregory N. Leonhardt"
+ *  License? "CC BY-NC 2.0"
+ *           "https://creativecommons.org/licenses/by-nc/2.0/"
+ *
+ ****************************************************************************/
+
+/******************************** JAVADOC ***********************************/
+/**
+ *  This file contains the benchmarks for the 'decode' library.
+ *
+ *  @note
+ *      decode_fmt_datetime( ) is run BENCH_DT_PASSES times over a set of
+ *      date / time strings taken from e-Mail and recipe headers.  The same
+ *      strings are run through BENCH__sscanf_datetime( ), a copy of the
+ *      sscanf( ) decoder that decode_fmt_datetime( ) replaced.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ *  Compiler directives
+ ****************************************************************************/
+
+
+/****************************************************************************
+ * System Function API
+ ****************************************************************************/
+
+                                //*******************************************
+#include <stdint.h>             //  Alternative storage types
+#include <stdbool.h>            //  TRUE, FALSE, etc.
+#include <stdio.h>              //  Standard I/O definitions
+                                //*******************************************
+#include <string.h>             //  Functions for managing strings
+#include <time.h>               //  clock_gettime( )
+                                //*******************************************
+
+/****************************************************************************
+ * Application APIs
+ ****************************************************************************/
+
+                                //*******************************************
+#include "global.h"             //  Global stuff for this application
+#include "libtools_api.h"       //  My Tools Library
+                                //*******************************************
+#include "decode_api.h"         //  API for all decode_*            PUBLIC
+#include "../decode_lib.h"      //  API for all DECODE__*           PRIVATE
+                                //*******************************************
+
+/****************************************************************************
+ * Enumerations local to this file
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Definitions local to this file
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+#define BENCH_DT_PASSES         ( 100000 )
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Structures local to this file
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Storage Allocation local to this file
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+/**
+ *  @param  bench_dt            Date / time strings                         */
+static
+char                        *   bench_dt[ ] =
+{
+    "2001-01-02 03:04:05",
+    "10/4/2013 8:16:41 PM",
+    "4 Jan 05 05:04:04",
+    "Mon 1 Jan 06 11 11 11 PM",
+    "Mon 1 Jan 08 11 11 11",
+    "Mon Jan 1 10 11 11AM",
+    "Monday, April 08, 2002 09:24:28 PM",
+    "Mon Jan 1 11 11 11 12",
+    "Jan 1 14 11 11 PM",
+    "Wed, 17 Jul 1996 10:38 -0500 (EST)",
+    "Fri, 5 Dec 2003 14:02:03 +0100",
+    "Saturday, November 02, 1996 1119",
+    NULL
+};
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * LIB Functions
+ ****************************************************************************/
+
+/****************************************************************************/
+/**
+ *  Check a date / time value.
+ *
+ *  @param  value               The value
+ *  @param  low                 Smallest valid value
+ *  @param  high                Biggest valid value
+ *
+ *  @return in_range            TRUE when low <= value <= high
+ *
+ *  @note
+ *
+ ****************************************************************************/
+
+static
+int
+BENCH__in(
+    int                         value,
+    int                         low,
+    int                         high
+    )
+{
+    //  DONE!
+    return( ( value >= low ) && ( value <= high ) );
+}
+
+/****************************************************************************/
+/**
+ *  The sscanf( ) date / time decoder that decode_fmt_datetime( ) replaced.
+ *
+ *  @param  src_datetime_p      Pointer to source date/time string.
+ *  @param  fmt_datetime_p      A 20 byte buffer for the formatted string
+ *
+ *  @return decoded             FALSE when the string is too short
+ *
+ *  @note
+ *      Same patterns, same order and the same (shared) text buffers.
+ *
+ ****************************************************************************/
+
+static
+int
+BENCH__sscanf_datetime(
+    char                    *   src_datetime_p,
+    char                    *   fmt_datetime_p
+    )
+{
+    /**
+     *  @param  tmp_datetime_p  Pointer to the temp date string             */
+    char                    *   tmp_datetime_p;
+    /**
+     *  @param  data_p          Scan pointer                                */
+    char                    *   data_p;
+    /**
+     *  @param  decoded         TRUE Date & Time have been decoded          */
+    int                         decoded;
+    /**
+     *  @param  attempt         The pattern being tried                     */
+    int                         attempt;
+    /**
+     *  @param                  Date & Time values                          */
+    int                         Y, M, D, h, m, s, w, a;
+    /**
+     *  @param                  Text buffers                                */
+    char                        dow[ 10 ], month[ 10 ], ap[ 50 ];
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+    //  Is the source date string long enough to contain a valid date ?
+    if ( strlen( src_datetime_p ) < 5 )
+    {
+        //  NO:     Nothing to do
+        return( false );
+    }
+
+    //  Copy the Date/Time string and remove punctuation characters
+    tmp_datetime_p = text_copy_to_new( src_datetime_p );
+
+    for ( data_p = tmp_datetime_p; data_p[ 0 ] != '\0'; data_p += 1 )
+    {
+        if ( strchr( ":/-,()", data_p[ 0 ] ) != NULL ) data_p[ 0 ] = ' ';
+    }
+
+    decoded = false;
+    memset( dow,   '\0', sizeof( dow   ) );
+    memset( month, '\0', sizeof( month ) );
+    memset( ap,    '\0', sizeof( ap    ) );
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    for ( attempt = 1; ( attempt <= 14 ) && ( decoded == false ); attempt += 1 )
+    {
+        Y = M = D = h = m = s = w = a = -1;
+
+        switch( attempt )
+        {
+            case    1:      //  #01
+                sscanf( tmp_datetime_p, "%d %d %d %d %d %d",
+                        &Y, &M, &D, &h, &m, &s );
+                decoded = ( Y > 70 ) && BENCH__in( s, 0, 59 );
+                break;
+            case    2:      //  #04
+                sscanf( tmp_datetime_p, "%d %d %d %d %d %d %s",
+                        &M, &D, &Y, &h, &m, &s, ap );
+                a = DECODE__am_or_pm( ap );
+                decoded = ( Y != -1 ) && BENCH__in( s, 0, 59 );
+                break;
+            case    3:      //  #02
+                sscanf( tmp_datetime_p, "%d %d %d %d %d %s",
+                        &M, &D, &Y, &h, &m, ap );
+                a = DECODE__am_or_pm( ap );
+                decoded = ( Y != -1 ) && ( s == -1 );
+                break;
+            case    4:      //  #03
+                sscanf( tmp_datetime_p, "%d %d %d %d %d %s",
+                        &M, &D, &Y, &h, &m, ap );
+                a = DECODE__am_or_pm( ap );
+                decoded =    ( Y != -1 ) && ( h == -1 ) && ( m == -1 )
+                          && ( s == -1 ) && ( a ==  0 ) && BENCH__in( M, 1, 12 )
+                          && BENCH__in( D, 1, 31 );
+                h = m = 0;
+                break;
+            case    5:      //  #05
+                sscanf( tmp_datetime_p, "%d %s %d %d %d %d",
+                        &D, month, &Y, &h, &m, &s );
+                M = DECODE__month( month );
+                decoded = ( Y != -1 ) && ( a == -1 );
+                break;
+            case    6:      //  #06
+                sscanf( tmp_datetime_p, "%s %d %s %d %d %d %d %s",
+                        dow, &D, month, &Y, &h, &m, &s, ap );
+                a = DECODE__am_or_pm( ap );
+                w = DECODE__day_of_week( dow );
+                M = DECODE__month( month );
+                decoded = ( Y != -1 ) && BENCH__in( s, 0, 59 ) && ( a > 0 );
+                break;
+            case    7:      //  #07
+                sscanf( tmp_datetime_p, "%s %d %s %d %d %d %s",
+                        dow, &D, month, &Y, &h, &m, ap );
+                a = DECODE__am_or_pm( ap );
+                w = DECODE__day_of_week( dow );
+                M = DECODE__month( month );
+                decoded = ( Y != -1 ) && ( s == -1 ) && ( a > 0 );
+                break;
+            case    8:      //  #08
+                sscanf( tmp_datetime_p, "%s %d %s %d %d %d %d",
+                        dow, &D, month, &Y, &h, &m, &s );
+                w = DECODE__day_of_week( dow );
+                M = DECODE__month( month );
+                decoded = ( Y != -1 ) && ( a == -1 );
+                break;
+            case    9:      //  @09
+                sscanf( tmp_datetime_p, "%s %s %d %d %d %d%s",
+                        dow, month, &D, &Y, &h, &m, ap );
+                a = DECODE__am_or_pm( ap );
+                w = DECODE__day_of_week( dow );
+                M = DECODE__month( month );
+                decoded = ( Y != -1 ) && ( s == -1 ) && ( a > 0 );
+                break;
+            case    10:     //  @10
+                sscanf( tmp_datetime_p, "%s %s %d %d %d %d %d%s",
+                        dow, month, &D, &Y, &h, &m, &s, ap );
+                a = DECODE__am_or_pm( ap );
+                w = DECODE__day_of_week( dow );
+                M = DECODE__month( month );
+                decoded = ( Y != -1 ) && BENCH__in( s, 0, 59 ) && ( a > 0 );
+                break;
+            case    11:     //  @11
+                sscanf( tmp_datetime_p, "%s %s %d %d %d %d %d",
+                        dow, month, &D, &Y, &h, &m, &s );
+                w = DECODE__day_of_week( dow );
+                M = DECODE__month( month );
+                decoded = ( Y != -1 ) && ( s == -1 );
+                break;
+            case    12:     //  @12
+                sscanf( tmp_datetime_p, "%s %s %d %d %d %d %d",
+                        dow, month, &D, &h, &m, &s, &Y );
+                w = DECODE__day_of_week( dow );
+                M = DECODE__month( month );
+                decoded = ( Y != -1 ) && BENCH__in( s, 0, 59 );
+                break;
+            case    13:     //  #13
+                sscanf( tmp_datetime_p, "%s %s %d %d %d",
+                        dow, month, &D, &Y, &h );
+                w = DECODE__day_of_week( dow );
+                M = DECODE__month( month );
+                decoded =    ( Y != -1 ) && ( ( h == -1 ) || ( h > 23 ) )
+                          && ( m == -1 ) && ( s == -1 )
+                          && BENCH__in( M, 1, 12 ) && BENCH__in( D, 1, 31 )
+                          && BENCH__in( w, 1,  7 );
+                h = m = 0;
+                break;
+            case    14:     //  @14
+                sscanf( tmp_datetime_p, "%s %d %d %d %d %s",
+                        month, &D, &Y, &h, &m, ap );
+                a = DECODE__am_or_pm( ap );
+                M = DECODE__month( month );
+                decoded = ( Y != -1 ) && ( s == -1 ) && ( a > 0 );
+                break;
+        }
+
+        //  Every pattern but #03 and #13 needs a date, an hour and a minute
+        //  and only the text it has.
+        if ( ( decoded == true ) && ( attempt != 4 ) && ( attempt != 13 ) )
+        {
+            decoded =    BENCH__in( M, 1, 12 ) && BENCH__in( D, 1, 31 )
+                      && BENCH__in( h, 0, 23 ) && BENCH__in( m, 0, 59 )
+                      && (    ( ( attempt <= 5 ) || ( attempt == 14 ) )
+                           ? ( w == -1 ) : BENCH__in( w, 1, 7 ) );
+        }
+    }
+
+    //  Fill in a missing second, fix AM/PM and the year
+    if ( decoded == true )
+    {
+        if ( ( s == -1 ) || ( s > 59 ) ) s = 0;
+        if ( a == 2 ) h = ( h == 12 ) ? 12 : h + 12;
+        if ( Y < 1970 ) Y += ( Y >= 70 ) ? 1900 : 2000;
+    }
+    else
+    {
+        //  Nothing was found
+        Y = -1;
+    }
+
+    //  Build the formatted date / time string
+    if (    ( Y >= 1970 ) && BENCH__in( M, 1, 12 ) && BENCH__in( D, 1, 31 )
+         && BENCH__in( h, 0, 23 ) && BENCH__in( m, 0, 59 )
+         && BENCH__in( s, 0, 59 ) )
+    {
+        snprintf( fmt_datetime_p, 20, "%04d-%02d-%02d %02d:%02d:%02d",
+                  Y, M, D, h, m, s );
+    }
+    else
+    {
+        snprintf( fmt_datetime_p, 20, "1900-01-01 00:00:00" );
+    }
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  Clean up
+    mem_free( tmp_datetime_p );
+
+    //  DONE!
+    return( true );
+}
+
+/****************************************************************************/
+/**
+ *  Time the date / time decoder.
+ *
+ *  @param  void                No parameters are passed into this function.
+ *
+ *  @return void                No information is returned
+ *
+ *  @note
+ *      Both decoders must produce the same strings.
+ *
+ ****************************************************************************/
+
+void
+DECODE__BENCH_fmt_datetime(
+    void
+    )
+{
+    /**
+     *  @param  fmt_datetime_p  Formatted date / time string                */
+    char                    *   fmt_datetime_p;
+    /**
+     *  @param  check           Formatted date / time string (sscanf)       */
+    char                        check[ 20 ];
+    /**
+     *  @param  string_count    Number of strings decoded each pass         */
+    int                         string_count;
+    /**
+     *  @param  ndx             Index into bench_dt                         */
+    int                         ndx;
+    /**
+     *  @param  pass            Pass number                                 */
+    int                         pass;
+    /**
+     *  @param  start           Start time                                  */
+    struct  timespec            start;
+    /**
+     *  @param  stop            Stop time                                   */
+    struct  timespec            stop;
+    /**
+     *  @param  seconds         Run time                                    */
+    double                      seconds;
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+    for ( string_count = 0;
+          bench_dt[ string_count ] != NULL;
+          string_count += 1 );
+
+    log_write( MID_INFO, "DECODE__BENCH",
+               "fmt_datetime: %d strings x %d passes\n",
+               string_count, BENCH_DT_PASSES );
+    log_write( MID_INFO, "DECODE__BENCH",
+               "DECODER         SECONDS  NS/STRING\n" );
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    //  Tokens and a pattern table
+    clock_gettime( CLOCK_MONOTONIC, &start );
+    for ( pass = 0; pass < BENCH_DT_PASSES; pass += 1 )
+    {
+        for ( ndx = 0; ndx < string_count; ndx += 1 )
+        {
+            fmt_datetime_p = decode_fmt_datetime( bench_dt[ ndx ] );
+            mem_free( fmt_datetime_p );
+        }
+    }
+    clock_gettime( CLOCK_MONOTONIC, &stop );
+    seconds = (   (double)( stop.tv_sec  - start.tv_sec  )
+                + (double)( stop.tv_nsec - start.tv_nsec ) / 1000000000.0 );
+    log_write( MID_INFO, "DECODE__BENCH",
+               "table        %10.3f %10.1f\n", seconds,
+               seconds * 1000000000.0 / BENCH_DT_PASSES / string_count );
+
+    //  One sscanf( ) per pattern
+    clock_gettime( CLOCK_MONOTONIC, &start );
+    for ( pass = 0; pass < BENCH_DT_PASSES; pass += 1 )
+    {
+        for ( ndx = 0; ndx < string_count; ndx += 1 )
+        {
+            fmt_datetime_p = mem_malloc( 20 );
+            BENCH__sscanf_datetime( bench_dt[ ndx ], fmt_datetime_p );
+            mem_free( fmt_datetime_p );
+        }
+    }
+    clock_gettime( CLOCK_MONOTONIC, &stop );
+    seconds = (   (double)( stop.tv_sec  - start.tv_sec  )
+                + (double)( stop.tv_nsec - start.tv_nsec ) / 1000000000.0 );
+    log_write( MID_INFO, "DECODE__BENCH",
+               "sscanf       %10.3f %10.1f\n", seconds,
+               seconds * 1000000000.0 / BENCH_DT_PASSES / string_count );
+
+    //  Did they agree ?
+    for ( ndx = 0; ndx < string_count; ndx += 1 )
+    {
+        fmt_datetime_p = decode_fmt_datetime( bench_dt[ ndx ] );
+        BENCH__sscanf_datetime( bench_dt[ ndx ], check );
+
+        if ( strcmp( fmt_datetime_p, check ) != 0 )
+        {
+            //  NO:     That's a bug
+            log_write( MID_WARNING, "DECODE__BENCH",
+                       "The date / time decoders do not agree: '%s'\n",
+                       bench_dt[ ndx ] );
+        }
+        mem_free( fmt_datetime_p );
+    }
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+}
+/****************************************************************************/
@@ -288,6 +288,9 @@ DECODE__TEST_fmt_datetime(
             //  Stop testing
             break;
         }
+
+        //  Done with the result
+        mem_free( fmt_datetime_p );
     }
 
     /************************************************************************
@@ -50,6 +50,7 @@
                                 //*******************************************
 #include "tcb_api.h"            //  API for all tcb_*               PUBLIC
 #include "rcb_api.h"            //  API for all rcb_*               PUBLIC
+#include "import_api.h"         //  API for all import_*            PUBLIC
 #include "recipe_api.h"         //  API for all recipe_*            PUBLIC
                                 //*******************************************
 #include "email_api.h"          //  API for all email_*             PUBLIC
@@ -239,6 +240,7 @@ email_is_start(
 /**
  *  Test the input text line to see if it's a multipart boundary.
  *
+ *  @param  ctx_p               Pointer to the e-Mail parse context
  *  @param  data_p              Pointer to a line of text data.
  *
  *  @return email_rc            TRUE when the text is the start of an e-Mail
@@ -250,6 +252,7 @@ email_is_start(
 
 enum    boundary_type_e
 email_is_boundary(
+    struct  email_ctx_t         *   ctx_p,
     char                        *   data_p
     )
 {
@@ -301,10 +304,10 @@ email_is_boundary(
                 if ( strlen( &start_p[ 1 ] ) <= ( EMAIL_BOUNDARY_L - 1 ) )
                 {
                     //  YES:    Save it.
-                    strcpy( email_boundary, &start_p[ 1 ] );
+                    strcpy( ctx_p->boundary, &start_p[ 1 ] );
 
                     //  Remove the ending quote ["]
-                    start_p = strchr( email_boundary, '"' );
+                    start_p = strchr( ctx_p->boundary, '"' );
                     if ( start_p != NULL )
                     {
                         start_p[ 0 ] = '\0';
@@ -334,7 +337,7 @@ email_is_boundary(
                     if ( strlen( start_p ) <= ( EMAIL_BOUNDARY_L - 1 ) )
                     {
                         //  YES:    Save it.
-                        strcpy( email_boundary, start_p );
+                        strcpy( ctx_p->boundary, start_p );
 
                         //  Found it and saved it.  All is good!
                         email_rc = BT_BOUNDARY;
@@ -366,6 +369,7 @@ email_is_boundary(
 /**
  *  Test the input text line to see if it's a multipart boundary.
  *
+ *  @param  ctx_p               Pointer to the e-Mail parse context
  *  @param  data_p              Pointer to a line of text data.
  *
  *  @return email_rc            TRUE when the text is the start of an e-Mail
@@ -377,6 +381,7 @@ email_is_boundary(
 
 enum    boundary_type_e
 email_is_boundary_identifier(
+    struct  email_ctx_t         *   ctx_p,
     char                        *   data_p
     )
 {
@@ -412,7 +417,7 @@ email_is_boundary_identifier(
                  && ( data_p[ 1 ] == '-' ) )
             {
                 //  YES:    This must be it so save it.
-                strcpy( email_boundary, &start_p[ 2 ] );
+                strcpy( ctx_p->boundary, &start_p[ 2 ] );
 
                 //  Found it and saved it.  All is good!
                 email_rc = BT_BOUNDARY;
@@ -432,6 +437,7 @@ email_is_boundary_identifier(
 /**
  *  Test the input text line to see if it is a multi-part message break
  *
+ *  @param  ctx_p               Pointer to the e-Mail parse context
  *  @param  data_p              Pointer to a line of text data.
  *
  *  @return email_rc            TRUE when the text is the start of an e-Mail
@@ -443,6 +449,7 @@ email_is_boundary_identifier(
 
 int
 email_is_multipart_break(
+    struct  email_ctx_t         *   ctx_p,
     char                        *   data_p
     )
 {
@@ -468,12 +475,12 @@ email_is_multipart_break(
      ************************************************************************/
 
     //  Does the line start with two dash [-] characters ?
-    if (    ( strlen( email_boundary ) >   0  )
+    if (    ( strlen( ctx_p->boundary ) >   0  )
          && ( start_p[ 0 ]             == '-' )
          && ( start_p[ 1 ]             == '-' ) )
     {
         //  Do we have a boundary marker match ?
-        if ( strncmp( &start_p[ 2 ], email_boundary, strlen( email_boundary ) ) == 0 )
+        if ( strncmp( &start_p[ 2 ], ctx_p->boundary, strlen( ctx_p->boundary ) ) == 0 )
         {
             //  YES:    Set a good return code.
             email_rc = true;
@@ -483,7 +490,7 @@ email_is_multipart_break(
                  && ( data_p[ strlen( data_p ) -1 ] == '-' ) )
             {
                 //  YES:    Erase the existing boundary marker
-                memset( email_boundary, '\0', EMAIL_BOUNDARY_L );
+                memset( ctx_p->boundary, '\0', EMAIL_BOUNDARY_L );
             }
         }
     }
@@ -500,6 +507,7 @@ email_is_multipart_break(
 /**
  *  Test the text line to see if it contains an e-Mail group break.
  *
+ *  @param  ctx_p               Pointer to the e-Mail parse context
  *  @param  data_p              Pointer to a line of text data
  *
  *  @return email_rc            TRUE when the text is the start of an e-Mail
@@ -515,6 +523,7 @@ email_is_multipart_break(
 
 int
 email_is_group_break(
+    struct  email_ctx_t         *   ctx_p,
     char                        *   data_p
     )
 {
@@ -557,7 +566,7 @@ email_is_group_break(
          || ( strncmp( tmp_data_p, "========================  Arch",      30 ) == 0 )
          || ( strncmp( tmp_data_p, "--------------- MESSAGE bread-",      30 ) == 0 )
          || ( strncmp( tmp_data_p, "--------------- END bread-bake",      30 ) == 0 )
-         || ( email_is_multipart_break( tmp_data_p )                           == true ) )
+         || ( email_is_multipart_break( ctx_p, tmp_data_p )                    == true ) )
     {
         //  YES:    Change the return code
         email_rc = true;
@@ -1089,6 +1098,7 @@ email_find_subject(
  *  Analyze e-Mail messages for stuff that we don't want anything to do with.
  *  When located discard it.
  *
+ *  @param  ctx_p               Pointer to the e-Mail parse context
  *  @param  data_p              Pointer to a line of text data
  *
  *  @return email_filtering     TRUE when we are processing stuff that is
@@ -1100,6 +1110,7 @@ email_find_subject(
 
 int
 email_filter(
+    struct  email_ctx_t         *   ctx_p,
     char                        *   data_p
     )
 {
@@ -1112,17 +1123,17 @@ email_filter(
      ************************************************************************/
 
     //  Was the last line from a reply message ?
-    if ( email_filter_type == EMAIL_FILTER_REPLY )
+    if ( ctx_p->filter_type == EMAIL_FILTER_REPLY )
     {
         //  YES:    Throw it in the trash
-        email_filter_type = EMAIL_FILTER_NONE;
+        ctx_p->filter_type = EMAIL_FILTER_NONE;
     }
 
     /************************************************************************
      *  Actively filtering
      ************************************************************************/
 
-    switch( email_filter_type )
+    switch( ctx_p->filter_type )
     {
         case    EMAIL_FILTER_X_YMAILISG:
         {
@@ -1130,7 +1141,7 @@ email_filter(
             if ( data_p[ 0 ] != ' ' )
             {
                 //  NO:     Set the return code.
-                email_filter_type = EMAIL_FILTER_NONE;
+                ctx_p->filter_type = EMAIL_FILTER_NONE;
             }
         }   break;
 
@@ -1140,7 +1151,7 @@ email_filter(
             if ( strstr( data_p, "--" ) != NULL )
             {
                 //  YES:    Set the return code.
-                email_filter_type = EMAIL_FILTER_NONE;
+                ctx_p->filter_type = EMAIL_FILTER_NONE;
             }
         }   break;
 
@@ -1164,7 +1175,7 @@ email_filter(
                 if ( strncmp( tmp_data, "x-ymailisg:", 11 ) == 0 )
                 {
                     //  YES:    Set the filter type.
-                    email_filter_type = EMAIL_FILTER_X_YMAILISG;
+                    ctx_p->filter_type = EMAIL_FILTER_X_YMAILISG;
                 }
             }
         }
@@ -1175,7 +1186,7 @@ email_filter(
      ************************************************************************/
 
     //  Set the return code
-    if ( email_filter_type == EMAIL_FILTER_NONE )
+    if ( ctx_p->filter_type == EMAIL_FILTER_NONE )
     {
         email_rc = false;
     }
@@ -1190,25 +1201,28 @@ email_filter(
 
 /****************************************************************************/
 /**
- *  Initialize the Translations tables.
+ *  Split an imported file into one Recipe Control Block per recipe.
  *
- *  @param  void            *   Pointer
+ *  @param  tcb_p               Pointer to a Thread Control Block
+ *  @param  void_p              Pointer to a Recipe Control Block
  *
- *  @return void                Upon successful completion TRUE is returned
- *                              else FALSE is returned.
+ *  @return void                No information is returned
  *
  *  @note
+ *      Every recipe that is found is passed on to the DECODE thread group.
+ *      A streamed file arrives one chunk at a time.  The split state is
+ *      kept on the file RCB between chunks and the RCB is only killed
+ *      after the last chunk.  Each member of an archive starts over with
+ *      a new split state, just like a file of its own.
  *
  ****************************************************************************/
 
 void
-email(
+email_rcb(
+    struct  tcb_t           *   tcb_p,
     void                    *   void_p
     )
 {
-    /**
-     *  @param  tcb_p           Pointer to a Thread Control Block           */
-    struct  tcb_t           *   tcb_p;
     /**
      *  @param  rcb_p           Pointer to a Recipe Control Block           */
     struct  rcb_t           *   rcb_p;
@@ -1222,6 +1236,9 @@ email(
     /**
      * @param list_lock_key     File list key                               */
     int                         list_lock_key;
+    /**
+     * @param line_ndx          Position in the line index (mapped files)   */
+    int                         line_ndx;
     /**
      * @param encoding_type     TRUE = encoding_type                        */
     int                         quoted_printable;
@@ -1234,320 +1251,406 @@ email(
     /**
      * @param tmp_data_p        Temporary data pointer                      */
     char                    *   tmp_data_p;
+    /**
+     * @param header            Which e-Mail header the line is             */
+    enum    email_header_e      header;
     /**
      *  @param  recipe_format   Format code for this recipe                 */
     enum    recipe_format_e     tmp_format;
+    /**
+     *  @param  email_ctx_p     Parse state for this file                   */
+    struct  email_ctx_t     *   email_ctx_p;
 #endif
+    /**
+     *  @param  chunk_last      TRUE = this is the end of the file          */
+    int                         chunk_last;
 
     /************************************************************************
      *  Function Initialization
      ************************************************************************/
 
-    //  Initialize variables
-    quoted_printable = false;
-
     //  Set the pointer
-    tcb_p = void_p;
-
-    //  Progress report.
-    log_write( MID_INFO, tcb_p->thread_name,
-               "Initialization complete.\n" );
-
-    //  Change execution state to "WAIT"ing for work.
-    tcb_p->thread_state = TS_WAIT;
+    rcb_p = void_p;
 
     /************************************************************************
      *  Function Body
      ************************************************************************/
 
-    while ( 1 )
-    {
-
-        /********************************************************************
-         *  Get a new file
-         ********************************************************************/
-
-        //  Get the current File-ID.
-        rcb_p = queue_get_payload( tcb_p->queue_id );
-
-        //  This thread is now the owner of the RCB
-        rcb_p->tcb_p = tcb_p;
-
-        //  Progress report.
-        log_write( MID_LOGONLY, tcb_p->thread_name,
-                   "SIZE: %10d - FILE-ID: %s\n",
-                   list_query_count( rcb_p->import_list_p ),
-                   rcb_p->file_path );
-
-        //  Change execution state to "INITIALIZED" for work.
-        tcb_p->thread_state = TS_WORKING;
-
 #if ! STUB
 
-        //  Clear the new RCB pointer
-        new_rcb_p = NULL;
+    //  Is this the first (or only) chunk of the file ?
+    if ( rcb_p->email_ctx_p == NULL )
+    {
+        //  YES:    Initialize the e-Mail parse state (filter type, boundary, etc.)
+        rcb_p->email_ctx_p = mem_malloc( sizeof( struct email_ctx_t ) );
+        memset( rcb_p->email_ctx_p, 0x00, sizeof( struct email_ctx_t ) );
+        rcb_p->email_ctx_p->filter_type = EMAIL_FILTER_NONE;
+        rcb_p->email_ctx_p->b64_header  = true;
+        rcb_p->email_ctx_p->pending_p   = list_new( );
+    }
+    email_ctx_p = rcb_p->email_ctx_p;
 
-        //  Initialize the e-Mail filter type
-        email_filter_type = EMAIL_FILTER_NONE;
+    //  Pick up where the last chunk left off
+    new_rcb_p        = email_ctx_p->new_rcb_p;
+    quoted_printable = email_ctx_p->quoted_printable;
+    email_start_flag = email_ctx_p->email_start_flag;
+    group_start_flag = email_ctx_p->group_start_flag;
 
-        /********************************************************************
-         *  FUNCTIONAL CODE FOR THIS THREAD GOES HERE
-         ********************************************************************/
+    /********************************************************************
+     *  FUNCTIONAL CODE FOR THIS THREAD GOES HERE
+     ********************************************************************/
+
+    //  Lock the list for fast(er) access
+    list_lock_key = list_user_lock( rcb_p->import_list_p );
 
-        //  Lock the list for fast(er) access
-        list_lock_key = list_user_lock( rcb_p->import_list_p );
+    //  Scan the file (the line index or the list)
+    line_ndx = rcb_p->line_first;
 
-        //  Scan the list
-        for( list_data_p = list_fget_first( rcb_p->import_list_p, list_lock_key );
-             list_data_p != NULL;
-             list_data_p = list_fget_next( rcb_p->import_list_p, list_data_p, list_lock_key ) )
+    while ( ( list_data_p = EMAIL__next_line( rcb_p, email_ctx_p, &line_ndx,
+                                              list_lock_key ) ) != NULL )
+    {
+        //  Is this line part of a base64 text body ?
+        if ( EMAIL__base64( tcb_p, rcb_p, email_ctx_p, list_data_p ) == true )
         {
-            //  Remove the data from the level 1 list
-            list_fdelete( rcb_p->import_list_p, list_data_p, list_lock_key );
+            //  YES:    It comes back decoded
+        }
 
-            //  Are we filtering out e-Mail junk (images etc.)
-            if ( email_filter( list_data_p ) == true )
+        //  Are we filtering out e-Mail junk (images etc.)
+        else
+        if ( email_filter( email_ctx_p, list_data_p ) == true )
+        {
+            //  YES:    Discard the data
+            import_line_free( rcb_p, list_data_p );
+        }
+        else
+        {
+            //  Test for the start of an e-Mail thread
+            if (    ( rcb_p->recipe_format == RECIPE_FORMAT_NONE )
+                 && ( EMAIL__is_start( list_data_p ) == true ) )
             {
-                //  YES:    Discard the data
-                mem_free( list_data_p );
+                //  YES:    Set the e-Mail start flag true
+                email_start_flag = true;
+
+                //  Set the group start flag false
+                group_start_flag = false;
             }
-            else
+
+            //  Are we processing an e-Mail message ?
+            if (    ( email_start_flag     ==               true )
+                 && ( rcb_p->recipe_format == RECIPE_FORMAT_NONE ) )
             {
-                //  Test for the start of an e-Mail thread
-                if (    ( rcb_p->recipe_format == RECIPE_FORMAT_NONE )
-                     && ( EMAIL__is_start( list_data_p ) == true ) )
+                //  Is this an e-Mail group break string ?
+                if ( EMAIL__is_group_break( email_ctx_p, list_data_p ) == true )
                 {
-                    //  YES:    Set the e-Mail start flag true
-                    email_start_flag = true;
-
-                    //  Set the group start flag false
-                    group_start_flag = false;
+                    //  YES:    Set the flag true
+                    group_start_flag = true;
                 }
 
-                //  Are we processing an e-Mail message ?
-                if (    ( email_start_flag     ==               true )
-                     && ( rcb_p->recipe_format == RECIPE_FORMAT_NONE ) )
+                //  Which header (if any) is this ?
+                header = EMAIL__header( list_data_p, &tmp_data_p );
+
+                //  Is it a header that is kept ?
+                if (    ( header != EMAIL_HDR_NONE     )
+                     && ( header != EMAIL_HDR_ENCODING ) )
                 {
-                    //  Is this an e-Mail group break string ?
-                    if ( EMAIL__is_group_break( list_data_p ) == true )
-                    {
-                        //  YES:    Set the flag true
-                        group_start_flag = true;
-                    }
+                    //  YES:    Recipes that were already cloned keep the
+                    //          old values
+                    rcb_info_own( rcb_p );
+                }
 
-                    //  Are we processing an e-Mail header or a group message ?
-                    if ( group_start_flag == false )
+                //  Are we processing an e-Mail header or a group message ?
+                if ( group_start_flag == false )
+                {
+                    //  E-MAIL Header:
+                    switch( header )
                     {
-                        //  E-MAIL Header:
                         //  "TRANSFER-ENCODING"
-                        if ( email_find_encoding( list_data_p ) == CTE_QUOTE_PRINT )
+                        case    EMAIL_HDR_ENCODING:
                         {
-                            //  YES:    Set the decode flag
-                            quoted_printable = true;
-                        }
+                            if ( email_find_encoding( list_data_p ) == CTE_QUOTE_PRINT )
+                            {
+                                //  YES:    Set the decode flag
+                                quoted_printable = true;
+                            }
+                        }   break;
                         //  "NEWSGROUPS:"
-                        tmp_data_p = EMAIL__find_newsgroup( list_data_p );
-                        if ( tmp_data_p != NULL )
+                        case    EMAIL_HDR_NEWSGROUPS:
                         {
-                            //  YES:    Save the information
-                            memset( rcb_p->email_info_p->g_from, '\0', FROM_L );
-                            if ( strlen( tmp_data_p ) < FROM_L )
-                                memcpy( rcb_p->email_info_p->g_from,
-                                        tmp_data_p, strlen( tmp_data_p ) );
-                            else
-                                memcpy( rcb_p->email_info_p->g_from,
-                                        tmp_data_p, FROM_L - 1 );
-                        }
+                            EMAIL__header_save( rcb_p->email_info_p->g_from,
+                                                FROM_L, tmp_data_p );
+                        }   break;
                         //  "SUBJECT:"
-                        tmp_data_p = EMAIL__find_subject( list_data_p );
-                        if ( tmp_data_p != NULL )
+                        case    EMAIL_HDR_SUBJECT:
                         {
-                            //  YES:    Save the information
-                            memset( rcb_p->email_info_p->e_subject, '\0', SUBJECT_L );
-                            if ( strlen( tmp_data_p ) < FROM_L )
-                                memcpy( rcb_p->email_info_p->e_subject,
-                                        tmp_data_p, strlen( tmp_data_p ) );
-                            else
-                                memcpy( rcb_p->email_info_p->e_subject,
-                                        tmp_data_p, SUBJECT_L - 1 );
-                        }
+                            EMAIL__header_save( rcb_p->email_info_p->e_subject,
+                                                SUBJECT_L, tmp_data_p );
+                        }   break;
                         //  "FROM:"
-                        tmp_data_p = EMAIL__find_from( list_data_p );
-                        if ( tmp_data_p != NULL )
+                        case    EMAIL_HDR_FROM:
                         {
-                            //  YES:    Save the information
-                            memset( rcb_p->email_info_p->e_from, '\0', FROM_L );
-                            if ( strlen( tmp_data_p ) < FROM_L )
-                                memcpy( rcb_p->email_info_p->e_from,
-                                        tmp_data_p, strlen( tmp_data_p ) );
-                            else
-                                memcpy( rcb_p->email_info_p->e_from,
-                                        tmp_data_p, FROM_L - 1 );
-                        }
+                            EMAIL__header_save( rcb_p->email_info_p->e_from,
+                                                FROM_L, tmp_data_p );
+                        }   break;
                         //  "DATE:"
-                        tmp_data_p = EMAIL__find_datetime( list_data_p );
-                        if ( tmp_data_p != NULL )
+                        case    EMAIL_HDR_DATETIME:
                         {
-                            //  YES:    Save the information
-                            memset( rcb_p->email_info_p->e_datetime, '\0', DATETIME_L );
-                            if ( strlen( tmp_data_p ) < FROM_L )
-                                memcpy( rcb_p->email_info_p->e_datetime,
-                                        tmp_data_p, strlen( tmp_data_p ) );
-                            else
-                                memcpy( rcb_p->email_info_p->e_datetime,
-                                        tmp_data_p, DATETIME_L - 1 );
+                            EMAIL__header_save( rcb_p->email_info_p->e_datetime,
+                                                DATETIME_L, tmp_data_p );
+                        }   break;
+                        default:
+                        {
+                            //  For the headers that aren't kept here.
                         }
                     }
-                    else
+                }
+                else
+                {
+                    //  Must be a group message
+                    switch( header )
                     {
-                        //  Must be a group message
                         //  "SUBJECT:"
-                        tmp_data_p = EMAIL__find_subject( list_data_p );
-                        if ( tmp_data_p != NULL )
+                        case    EMAIL_HDR_SUBJECT:
                         {
-                            //  YES:    Save the information
-                            memset( rcb_p->email_info_p->g_subject, '\0', SUBJECT_L );
-                            if ( strlen( tmp_data_p ) < FROM_L )
-                                memcpy( rcb_p->email_info_p->g_subject,
-                                        tmp_data_p, strlen( tmp_data_p ) );
-                            else
-                                memcpy( rcb_p->email_info_p->g_subject,
-                                        tmp_data_p, SUBJECT_L - 1 );
-                        }
+                            EMAIL__header_save( rcb_p->email_info_p->g_subject,
+                                                SUBJECT_L, tmp_data_p );
+                        }   break;
                         //  "FROM:"
-                        tmp_data_p = EMAIL__find_from( list_data_p );
-                        if ( tmp_data_p != NULL )
+                        case    EMAIL_HDR_FROM:
                         {
-                            //  YES:    Save the information
-                            memset( rcb_p->email_info_p->g_from, '\0', FROM_L );
-                            if ( strlen( tmp_data_p ) < FROM_L )
-                                memcpy( rcb_p->email_info_p->g_from,
-                                        tmp_data_p, strlen( tmp_data_p ) );
-                            else
-                                memcpy( rcb_p->email_info_p->g_from,
-                                        tmp_data_p, FROM_L - 1 );
-                        }
+                            EMAIL__header_save( rcb_p->email_info_p->g_from,
+                                                FROM_L, tmp_data_p );
+                        }   break;
                         //  "DATE:"
-                        tmp_data_p = EMAIL__find_datetime( list_data_p );
-                        if ( tmp_data_p != NULL )
+                        case    EMAIL_HDR_DATETIME:
                         {
-                            //  YES:    Save the information
-                            memset( rcb_p->email_info_p->g_datetime, '\0', DATETIME_L );
-                            if ( strlen( tmp_data_p ) < FROM_L )
-                                memcpy( rcb_p->email_info_p->g_datetime,
-                                        tmp_data_p, strlen( tmp_data_p ) );
-                            else
-                                memcpy( rcb_p->email_info_p->g_datetime,
-                                        tmp_data_p, DATETIME_L - 1 );
+                            EMAIL__header_save( rcb_p->email_info_p->g_datetime,
+                                                DATETIME_L, tmp_data_p );
+                        }   break;
+                        default:
+                        {
+                            //  For the headers that aren't kept here.
                         }
                     }
                 }
+            }
 
-                //  Is there an active recipe split ?
-                if ( rcb_p->recipe_format == RECIPE_FORMAT_NONE )
-                {
-                    //  NO:     Test for the start of a new recipe.
-                    rcb_p->recipe_format = recipe_is_start( list_data_p );
+            //  Is there an active recipe split ?
+            if ( rcb_p->recipe_format == RECIPE_FORMAT_NONE )
+            {
+                //  NO:     Test for the start of a new recipe.
+                rcb_p->recipe_format = recipe_is_start( list_data_p );
 
-                    //  Is this the start of a new recipe ?
-                    if ( rcb_p->recipe_format != RECIPE_FORMAT_NONE )
-                    {
-                        //  YES:    Clone the RCB
-                        new_rcb_p = rcb_new( rcb_p );
+                //  Is this the start of a new recipe ?
+                if ( rcb_p->recipe_format != RECIPE_FORMAT_NONE )
+                {
+                    //  YES:    Clone the RCB
+                    new_rcb_p = rcb_new( rcb_p );
 
-                        //  Add this data buffer to the new recipe list.
-                        list_put_last( new_rcb_p->import_list_p, list_data_p );
-                    }
-                    else
-                    {
-                        //  This is trash data so throw it away
-                        mem_free( list_data_p );
-                    }
+                    //  Add this data buffer to the new recipe list.
+                    list_put_last( new_rcb_p->import_list_p, list_data_p );
                 }
                 else
                 {
-                    //  Just in case this is the start of a new recipe
-                    tmp_format = recipe_is_start( list_data_p );
+                    //  This is trash data so throw it away
+                    import_line_free( rcb_p, list_data_p );
+                }
+            }
+            else
+            {
+                //  Just in case this is the start of a new recipe
+                tmp_format = recipe_is_start( list_data_p );
 
-                    //  Is this the end of the recipe
-                    if (    ( recipe_is_end( rcb_p->recipe_format, list_data_p ) == true )
-                         || ( tmp_format                           != RECIPE_FORMAT_NONE )
-                         || ( EMAIL__is_group_break( list_data_p )               == true ) )
+                //  Is this the end of the recipe
+                if (    ( recipe_is_end( rcb_p->recipe_format, list_data_p ) == true )
+                     || ( tmp_format                           != RECIPE_FORMAT_NONE )
+                     || ( EMAIL__is_group_break( email_ctx_p, list_data_p )              == true ) )
+                {
+                    //  YES:    Is this a QUOTED-PRINTABLE e-Mail ?
+                    if ( quoted_printable == true )
                     {
-                        //  YES:    Is this a QUOTED-PRINTABLE e-Mail ?
-                        if ( quoted_printable == true )
-                        {
-                            //  YES:    Decode the quoted printable text
-                            EMAIL__quoted_printable( new_rcb_p );
+                        //  YES:    Decode the quoted printable text
+                        EMAIL__quoted_printable( new_rcb_p );
 
-                            //  Set the decode flag
-                            quoted_printable = false;
-                        }
+                        //  Set the decode flag
+                        quoted_printable = false;
+                    }
 
-                        //  Put it in one of the DECODE queue
-                        queue_put_payload( decode_tcb->queue_id, new_rcb_p  );
+                    //  Add it to the batch for the DECODE queue
+                    tcb_batch_put( tcb_p, decode_tcb, new_rcb_p );
 
-                        //  Clear the current recipe format
-                        rcb_p->recipe_format = RECIPE_FORMAT_NONE;
+                    //  Clear the current recipe format
+                    rcb_p->recipe_format = RECIPE_FORMAT_NONE;
 
-                        //  Clear the new RCB pointer
-                        new_rcb_p = NULL;
+                    //  Clear the new RCB pointer
+                    new_rcb_p = NULL;
 
-                        //  Set the group start flag false
-                        group_start_flag = false;
-                    }
+                    //  Set the group start flag false
+                    group_start_flag = false;
+                }
 
 
-                    //  Is this the start of a recipe ?
-                    if ( tmp_format != RECIPE_FORMAT_NONE )
-                    {
-                       //  YES:    Set the new recipe format
-                        rcb_p->recipe_format = tmp_format;
+                //  Is this the start of a recipe ?
+                if ( tmp_format != RECIPE_FORMAT_NONE )
+                {
+                   //  YES:    Set the new recipe format
+                    rcb_p->recipe_format = tmp_format;
 
-                        //  Clone the RCB
-                        new_rcb_p = rcb_new( rcb_p );
-                    }
+                    //  Clone the RCB
+                    new_rcb_p = rcb_new( rcb_p );
+                }
 
-                    //  Is there a RCB to store the data ?
-                    if ( new_rcb_p != NULL )
-                    {
-                        //  YES:    Add this data buffer to the current recipe list.
-                        list_put_last( new_rcb_p->import_list_p, list_data_p );
-                    }
+                //  Is there a RCB to store the data ?
+                if ( new_rcb_p != NULL )
+                {
+                    //  YES:    Add this data buffer to the current recipe list.
+                    list_put_last( new_rcb_p->import_list_p, list_data_p );
                 }
             }
         }
+    }
 
-        //  End-Of-File with an active recipe ?
-        if ( new_rcb_p != NULL )
+    //  End-Of-File with an active recipe ?
+    if (    ( rcb_p->chunk_eof == true )
+         && ( new_rcb_p        != NULL ) )
+    {
+        //  YES:    Is this a QUOTED-PRINTABLE e-Mail ?
+        if ( quoted_printable == true )
         {
-            //  YES:    Is this a QUOTED-PRINTABLE e-Mail ?
-            if ( quoted_printable == true )
-            {
-                //  YES:    Decode the quoted printable text
-                EMAIL__quoted_printable( new_rcb_p );
+            //  YES:    Decode the quoted printable text
+            EMAIL__quoted_printable( new_rcb_p );
 
-                //  Set the decode flag
-                quoted_printable = false;
-            }
+            //  Set the decode flag
+            quoted_printable = false;
+        }
+
+        //  Add it to the batch for the DECODE queue
+        tcb_batch_put( tcb_p, decode_tcb, new_rcb_p );
+
+        //  Clear the new RCB pointer
+        new_rcb_p = NULL;
+    }
 
-            //  Put it in one of the DECODE queue
-            queue_put_payload( decode_tcb->queue_id, new_rcb_p  );
+    //  Release the lock on the level 3 list
+    list_user_unlock( rcb_p->import_list_p, list_lock_key );
 
-            //  Clear the new RCB pointer
-            new_rcb_p = NULL;
+    //  Is this the end of the text ?
+    if ( rcb_p->chunk_eof == true )
+    {
+        //  YES:    The next archive member (if any) starts over
+        if ( email_ctx_p->b64_p != NULL )
+        {
+            mem_free( email_ctx_p->b64_p );
         }
+        list_kill( email_ctx_p->pending_p );
+        mem_free( rcb_p->email_ctx_p );
+        rcb_p->email_ctx_p   = NULL;
+        rcb_p->recipe_format = RECIPE_FORMAT_NONE;
+    }
+    else
+    {
+        //  NO:     Save the split state for the next chunk
+        email_ctx_p->new_rcb_p        = new_rcb_p;
+        email_ctx_p->quoted_printable = quoted_printable;
+        email_ctx_p->email_start_flag = email_start_flag;
+        email_ctx_p->group_start_flag = group_start_flag;
+    }
 
-        //  Release the lock on the level 3 list
-        list_user_unlock( rcb_p->import_list_p, list_lock_key );
+    //  Hand whatever is left in the batch to the DECODE queue
+    tcb_batch_flush( tcb_p );
 
 #endif
 
-        //  Kill the Recipe Control Block
+    //  Is this the end of the file ?
+    chunk_last = rcb_p->chunk_last;
+
+    //  Give the chunk back to the streaming budget (the RCB belongs to
+    //  IMPORT again unless this was the last chunk)
+    import_chunk_done( rcb_p );
+
+    //  Was it the end of the file ?
+    if ( chunk_last == true )
+    {
+        //  YES:    Kill the Recipe Control Block
         rcb_kill( rcb_p );
+    }
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+}
+
+/****************************************************************************/
+/**
+ *  Initialize the Translations tables.
+ *
+ *  @param  void            *   Pointer
+ *
+ *  @return void                Upon successful completion TRUE is returned
+ *                              else FALSE is returned.
+ *
+ *  @note
+ *
+ ****************************************************************************/
+
+void
+email(
+    void                    *   void_p
+    )
+{
+    /**
+     *  @param  tcb_p           Pointer to a Thread Control Block           */
+    struct  tcb_t           *   tcb_p;
+    /**
+     *  @param  rcb_p           Pointer to a Recipe Control Block           */
+    struct  rcb_t           *   rcb_p;
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+    //  Set the pointer
+    tcb_p = void_p;
+
+    //  Progress report.
+    log_write( MID_INFO, tcb_p->thread_name,
+               "Initialization complete.\n" );
+
+    //  Change execution state to "WAIT"ing for work.
+    tcb_set_state( tcb_p, TS_WAIT );
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    while ( 1 )
+    {
+
+        /********************************************************************
+         *  Get a new file
+         ********************************************************************/
+
+        //  Get the current File-ID.
+        rcb_p = tcb_queue_get( tcb_p );
+
+        //  This thread is now the owner of the RCB
+        rcb_p->tcb_p = tcb_p;
+
+        //  Progress report.
+        log_write( MID_LOGONLY, tcb_p->thread_name,
+                   "SIZE: %10d - FILE-ID: %s\n",
+                   list_query_count( rcb_p->import_list_p ),
+                   rcb_p->file_path );
+
+        //  Change execution state to "INITIALIZED" for work.
+        tcb_set_state( tcb_p, TS_WORKING );
+
+        //  Process the payload
+        email_rcb( tcb_p, rcb_p );
 
         //  Change execution state to "INITIALIZED" for work.
-        tcb_p->thread_state = TS_WAIT;
+        tcb_set_state( tcb_p, TS_WAIT );
     }
 
     /************************************************************************
@@ -1556,4 +1659,87 @@ email(
 
     //  DONE!
 }
-/****************************************************************************/
\ No newline at end of file
+
+/****************************************************************************/
+/**
+ *  Run the e-Mail benchmarks.
+ *
+ *  @param  void                No parameters are passed in.
+ *
+ *  @return void                No information is returned
+ *
+ *  @note
+ *      The results are written to the log file.
+ *
+ ****************************************************************************/
+
+void
+email_benchmark(
+    void
+    )
+{
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    //  Quoted-printable decoder
+    EMAIL__BENCH_qp( );
+    EMAIL__BENCH_base64( );
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+}
+
+/****************************************************************************/
+/**
+ *  White Box Testing for the 'email' library.
+ *
+ *  @param  void                No parameters are passed in.
+ *
+ *  @return email_rc            TRUE when all tests pass, else FALSE
+ *
+ *  @note
+ *
+ ****************************************************************************/
+
+int
+email_wbt(
+    void
+    )
+{
+    /**
+     *  @param  email_rc        Return code from this function              */
+    int                         email_rc;
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+    //  Initialize variables
+    email_rc = true;
+
+    /************************************************************************
+     *  Function Code
+     ************************************************************************/
+
+    //  Verify success to this point
+    if ( email_rc == true ) email_rc = EMAIL__TEST_base64( );
+    if ( email_rc == true ) email_rc = EMAIL__TEST_base64_part( );
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+    return ( email_rc );
+}
+/****************************************************************************/
@@ -33,6 +33,9 @@
 #include <string.h>             //  Functions for managing strings
 #include <ctype.h>              //  Determine the type contained
 #include <stdlib.h>             //  ANSI standard library.
+#if defined( __SSE2__ )
+#include <emmintrin.h>          //  SSE2 intrinsics
+#endif
                                 //*******************************************
 
 /****************************************************************************
@@ -45,6 +48,7 @@
                                 //*******************************************
 #include "tcb_api.h"            //  API for all tcb_*               PUBLIC
 #include "rcb_api.h"            //  API for all rcb_*               PUBLIC
+#include "import_api.h"         //  API for all import_*            PUBLIC
                                 //*******************************************
 #include "email_api.h"          //  API for all email_*             PUBLIC
 #include "email_lib.h"          //  API for all EMAIL__*            PRIVATE
@@ -63,6 +67,8 @@
 
 //----------------------------------------------------------------------------
 #define EMAIL_BOUNDARY_L            ( 100 )
+#define EMAIL_QP_BUFFER_L           ( 1024 )
+#define EMAIL_B64_BUFFER_L          ( 4096 )
 //----------------------------------------------------------------------------
 
 /****************************************************************************
@@ -77,6 +83,41 @@
  ****************************************************************************/
 
 //----------------------------------------------------------------------------
+/**
+ *  @param  qp_hex              Value of a hex digit ( -1 = not a hex digit) */
+static
+const   signed  char            qp_hex[ 256 ] =
+{
+    [ 0 ... 255 ] = -1,
+    [ '0' ] =  0, [ '1' ] =  1, [ '2' ] =  2, [ '3' ] =  3, [ '4' ] =  4,
+    [ '5' ] =  5, [ '6' ] =  6, [ '7' ] =  7, [ '8' ] =  8, [ '9' ] =  9,
+    [ 'A' ] = 10, [ 'B' ] = 11, [ 'C' ] = 12, [ 'D' ] = 13, [ 'E' ] = 14,
+    [ 'F' ] = 15,
+    [ 'a' ] = 10, [ 'b' ] = 11, [ 'c' ] = 12, [ 'd' ] = 13, [ 'e' ] = 14,
+    [ 'f' ] = 15
+};
+/**
+ *  @param  b64_value           Value of a base64 digit ( -1 = not a digit) */
+static
+const   signed  char            b64_value[ 256 ] =
+{
+    [ 0 ... 255 ] = -1,
+    [ 'A' ] =  0, [ 'B' ] =  1, [ 'C' ] =  2, [ 'D' ] =  3, [ 'E' ] =  4,
+    [ 'F' ] =  5, [ 'G' ] =  6, [ 'H' ] =  7, [ 'I' ] =  8, [ 'J' ] =  9,
+    [ 'K' ] = 10, [ 'L' ] = 11, [ 'M' ] = 12, [ 'N' ] = 13, [ 'O' ] = 14,
+    [ 'P' ] = 15, [ 'Q' ] = 16, [ 'R' ] = 17, [ 'S' ] = 18, [ 'T' ] = 19,
+    [ 'U' ] = 20, [ 'V' ] = 21, [ 'W' ] = 22, [ 'X' ] = 23, [ 'Y' ] = 24,
+    [ 'Z' ] = 25,
+    [ 'a' ] = 26, [ 'b' ] = 27, [ 'c' ] = 28, [ 'd' ] = 29, [ 'e' ] = 30,
+    [ 'f' ] = 31, [ 'g' ] = 32, [ 'h' ] = 33, [ 'i' ] = 34, [ 'j' ] = 35,
+    [ 'k' ] = 36, [ 'l' ] = 37, [ 'm' ] = 38, [ 'n' ] = 39, [ 'o' ] = 40,
+    [ 'p' ] = 41, [ 'q' ] = 42, [ 'r' ] = 43, [ 's' ] = 44, [ 't' ] = 45,
+    [ 'u' ] = 46, [ 'v' ] = 47, [ 'w' ] = 48, [ 'x' ] = 49, [ 'y' ] = 50,
+    [ 'z' ] = 51,
+    [ '0' ] = 52, [ '1' ] = 53, [ '2' ] = 54, [ '3' ] = 55, [ '4' ] = 56,
+    [ '5' ] = 57, [ '6' ] = 58, [ '7' ] = 59, [ '8' ] = 60, [ '9' ] = 61,
+    [ '+' ] = 62, [ '/' ] = 63
+};
 //----------------------------------------------------------------------------
 
 /****************************************************************************
@@ -148,6 +189,7 @@ EMAIL__is_start(
 /**
  *  Test the input text line to see if it's a multipart boundary.
  *
+ *  @param  ctx_p               Pointer to the e-Mail parse context
  *  @param  data_p              Pointer to a line of text data.
  *
  *  @return email_rc            TRUE when the text is the start of an e-Mail
@@ -159,6 +201,7 @@ EMAIL__is_start(
 
 enum    boundary_type_e
 EMAIL__is_boundary(
+    struct  email_ctx_t         *   ctx_p,
     char                        *   data_p
     )
 {
@@ -171,10 +214,6 @@ EMAIL__is_boundary(
     /**
      * @param boundary_p        Pointer to the start of 'boundary='         */
     char                        *   boundary_p;
-    /**
-     *  @param  email_blank_count   Number of blank lines needed before
-     *                              normal processing resumes               */
-    char                            email_boundary[ EMAIL_BOUNDARY_L ];
 
     /************************************************************************
      *  Function Initialization
@@ -214,10 +253,10 @@ EMAIL__is_boundary(
                 if ( strlen( &start_p[ 1 ] ) <= ( EMAIL_BOUNDARY_L - 1 ) )
                 {
                     //  YES:    Save it.
-                    strcpy( email_boundary, &start_p[ 1 ] );
+                    strcpy( ctx_p->boundary, &start_p[ 1 ] );
 
                     //  Remove the ending quote ["]
-                    start_p = strchr( email_boundary, '"' );
+                    start_p = strchr( ctx_p->boundary, '"' );
                     if ( start_p != NULL )
                     {
                         start_p[ 0 ] = '\0';
@@ -247,7 +286,7 @@ EMAIL__is_boundary(
                     if ( strlen( start_p ) <= ( EMAIL_BOUNDARY_L - 1 ) )
                     {
                         //  YES:    Save it.
-                        strcpy( email_boundary, start_p );
+                        strcpy( ctx_p->boundary, start_p );
 
                         //  Found it and saved it.  All is good!
                         email_rc = BT_BOUNDARY;
@@ -279,6 +318,7 @@ EMAIL__is_boundary(
 /**
  *  Test the input text line to see if it's a multipart boundary.
  *
+ *  @param  ctx_p               Pointer to the e-Mail parse context
  *  @param  data_p              Pointer to a line of text data.
  *
  *  @return email_rc            TRUE when the text is the start of an e-Mail
@@ -290,6 +330,7 @@ EMAIL__is_boundary(
 
 enum    boundary_type_e
 EMAIL__is_boundary_identifier(
+    struct  email_ctx_t         *   ctx_p,
     char                        *   data_p
     )
 {
@@ -299,10 +340,6 @@ EMAIL__is_boundary_identifier(
     /**
      * @param start_p           Pointer to a temp data buffer               */
     char                        *   start_p;
-    /**
-     *  @param  email_blank_count   Number of blank lines needed before
-     *                              normal processing resumes               */
-    char                            email_boundary[ EMAIL_BOUNDARY_L ];
 
     /************************************************************************
      *  Function Initialization
@@ -329,7 +366,7 @@ EMAIL__is_boundary_identifier(
                  && ( data_p[ 1 ] == '-' ) )
             {
                 //  YES:    This must be it so save it.
-                strcpy( email_boundary, &start_p[ 2 ] );
+                strcpy( ctx_p->boundary, &start_p[ 2 ] );
 
                 //  Found it and saved it.  All is good!
                 email_rc = BT_BOUNDARY;
@@ -349,6 +386,7 @@ EMAIL__is_boundary_identifier(
 /**
  *  Test the input text line to see if it is a multi-part message break
  *
+ *  @param  ctx_p               Pointer to the e-Mail parse context
  *  @param  data_p              Pointer to a line of text data.
  *
  *  @return email_rc            TRUE when the text is the start of an e-Mail
@@ -360,6 +398,7 @@ EMAIL__is_boundary_identifier(
 
 int
 EMAIL__is_multipart_break(
+    struct  email_ctx_t         *   ctx_p,
     char                        *   data_p
     )
 {
@@ -369,10 +408,6 @@ EMAIL__is_multipart_break(
     /**
      * @param start_p           Pointer to a temp data buffer               */
     char                        *   start_p;
-    /**
-     *  @param  email_blank_count   Number of blank lines needed before
-     *                              normal processing resumes               */
-    char                            email_boundary[ EMAIL_BOUNDARY_L ];
 
     /************************************************************************
      *  Function Initialization
@@ -389,12 +424,12 @@ EMAIL__is_multipart_break(
      ************************************************************************/
 
     //  Does the line start with two dash [-] characters ?
-    if (    ( strlen( email_boundary ) >   0  )
+    if (    ( strlen( ctx_p->boundary ) >   0  )
          && ( start_p[ 0 ]             == '-' )
          && ( start_p[ 1 ]             == '-' ) )
     {
         //  Do we have a boundary marker match ?
-        if ( strncmp( &start_p[ 2 ], email_boundary, strlen( email_boundary ) ) == 0 )
+        if ( strncmp( &start_p[ 2 ], ctx_p->boundary, strlen( ctx_p->boundary ) ) == 0 )
         {
             //  YES:    Set a good return code.
             email_rc = true;
@@ -404,7 +439,7 @@ EMAIL__is_multipart_break(
                  && ( data_p[ strlen( data_p ) -1 ] == '-' ) )
             {
                 //  YES:    Erase the existing boundary marker
-                memset( email_boundary, '\0', EMAIL_BOUNDARY_L );
+                memset( ctx_p->boundary, '\0', EMAIL_BOUNDARY_L );
             }
         }
     }
@@ -421,6 +456,7 @@ EMAIL__is_multipart_break(
 /**
  *  Test the text line to see if it contains an e-Mail group break.
  *
+ *  @param  ctx_p               Pointer to the e-Mail parse context
  *  @param  data_p              Pointer to a line of text data
  *
  *  @return email_rc            TRUE when the text is the start of an e-Mail
@@ -436,6 +472,7 @@ EMAIL__is_multipart_break(
 
 int
 EMAIL__is_group_break(
+    struct  email_ctx_t         *   ctx_p,
     char                        *   data_p
     )
 {
@@ -478,7 +515,7 @@ EMAIL__is_group_break(
          || ( strncmp( tmp_data_p, "--------------- MESSAGE bread-",      30 ) == 0 )
          || ( strncmp( tmp_data_p, "--------------- END bread-bake",      30 ) == 0 )
          || ( strncmp( tmp_data_p, "Message-ID:",                         11 ) == 0 )
-         || ( EMAIL__is_multipart_break( tmp_data_p )                           == true ) )
+         || ( EMAIL__is_multipart_break( ctx_p, tmp_data_p )                    == true ) )
     {
         //  YES:    Change the return code
         email_rc = true;
@@ -841,26 +878,39 @@ EMAIL__find_source(
 
 /****************************************************************************/
 /**
- *  Test the text line to see if it contains a "Newsgroups: ' statement.
+ *  Classify an e-Mail header line in a single pass.
  *
  *  @param  data_p              Pointer to a line of text data
+ *  @param  value_pp            Where to put a pointer to the header value
  *
- *  @return email_rc            TRUE when the text is the start of an e-Mail
- *                              message, else FALSE is returned
+ *  @return header              EMAIL_HDR_NONE when the line is not one of
+ *                              the headers that are kept, else the header.
  *
  *  @note
- *      Newsgroups: rec.food.recipes
+ *      The leading whitespace is skipped once and the first character of
+ *      the header name picks the one name it can be, so a line is compared
+ *      against at most one header name.  The value has its leading
+ *      whitespace skipped as well.
+ *      Content-Transfer-Encoding: is not case sensitive, the others are.
+ *      "Newsgroups: " and "To: " both give EMAIL_HDR_NEWSGROUPS.
  *
  ****************************************************************************/
 
-char    *
-EMAIL__find_newsgroup(
-    char                        *   data_p
+enum    email_header_e
+EMAIL__header(
+    char                        *   data_p,
+    char                        **  value_pp
     )
 {
     /**
      * @param tmp_data_p        Pointer to a temp data buffer               */
     char                        *   tmp_data_p;
+    /**
+     * @param header            The header that was found                   */
+    enum    email_header_e          header;
+    /**
+     * @param name_l            Length of the header name                   */
+    size_t                          name_l;
 
     /************************************************************************
      *  Function Initialization
@@ -869,210 +919,144 @@ EMAIL__find_newsgroup(
     //  Locate the first character in the buffer
     tmp_data_p = text_skip_past_whitespace( data_p );
 
+    //  The assumption is that the line is not a header we keep
+    header = EMAIL_HDR_NONE;
+    name_l = 0;
+
     /************************************************************************
      *  Function
      ************************************************************************/
 
-    //  From: ?
-    if ( strncmp( tmp_data_p, SRCH_NEWSGREUPS, SRCH_NEWSGROUPS_L ) == 0 )
-    {
-        //  YES:    Move the pointer past the search text
-        tmp_data_p += SRCH_NEWSGROUPS_L;
-
-        //  Also move past any whitespace to eventually point to the data
-        tmp_data_p = text_skip_past_whitespace( tmp_data_p );
-    }
-    else
-    if ( strncmp( tmp_data_p, SRCH_TO, SRCH_TO_L ) == 0 )
-    {
-        //  YES:    Move the pointer past the search text
-        tmp_data_p += SRCH_TO_L;
-
-        //  Also move past any whitespace to eventually point to the data
-        tmp_data_p = text_skip_past_whitespace( tmp_data_p );
-    }
-    else
+    //  The first character picks the only header this can be
+    switch( tmp_data_p[ 0 ] )
     {
-        //  NO:     Set the pointer to 'NULL'
-        tmp_data_p = NULL;
-    }
-
-    /************************************************************************
-     *  Function Exit
-     ************************************************************************/
+        //  Content-Transfer-Encoding: ?
+        case    'C':
+        case    'c':
+        {
+            if ( strncasecmp( tmp_data_p, SRCH_ENCODING_TYPE, SRCH_ENCODING_TYPE_L ) == 0 )
+            {
+                header = EMAIL_HDR_ENCODING;
+                name_l = SRCH_ENCODING_TYPE_L;
+            }
+        }   break;
 
-    //  DONE!
-    return( tmp_data_p );
-}
+        //  Date: ?
+        case    'D':
+        {
+            if ( strncmp( tmp_data_p, SRCH_DATETIME, SRCH_DATETIME_L ) == 0 )
+            {
+                header = EMAIL_HDR_DATETIME;
+                name_l = SRCH_DATETIME_L;
+            }
+        }   break;
 
-/****************************************************************************/
-/**
- *  Test the text line to see if it contains where the e-Mail came from.
- *
- *  @param  data_p              Pointer to a line of text data
- *
- *  @return email_rc            TRUE when the text is the start of an e-Mail
- *                              message, else FALSE is returned
- *
- *  @note
- *      From: 'Jane Doe' jane.doe@server.mail (Jane Doe)
- *
- ****************************************************************************/
+        //  From: ?
+        case    'F':
+        {
+            if ( strncmp( tmp_data_p, SRCH_FROM, SRCH_FROM_L ) == 0 )
+            {
+                header = EMAIL_HDR_FROM;
+                name_l = SRCH_FROM_L;
+            }
+        }   break;
 
-char    *
-EMAIL__find_from(
-    char                        *   data_p
-    )
-{
-    /**
-     * @param tmp_data_p        Pointer to a temp data buffer               */
-    char                        *   tmp_data_p;
+        //  Newsgroups: ?
+        case    'N':
+        {
+            if ( strncmp( tmp_data_p, SRCH_NEWSGREUPS, SRCH_NEWSGROUPS_L ) == 0 )
+            {
+                header = EMAIL_HDR_NEWSGROUPS;
+                name_l = SRCH_NEWSGROUPS_L;
+            }
+        }   break;
 
-    /************************************************************************
-     *  Function Initialization
-     ************************************************************************/
+        //  Subject: ?
+        case    'S':
+        {
+            if ( strncmp( tmp_data_p, SRCH_SUBJECT, SRCH_SUBJECT_L ) == 0 )
+            {
+                header = EMAIL_HDR_SUBJECT;
+                name_l = SRCH_SUBJECT_L;
+            }
+        }   break;
 
-    //  Locate the first character in the buffer
-    tmp_data_p = text_skip_past_whitespace( data_p );
+        //  To: ?
+        case    'T':
+        {
+            if ( strncmp( tmp_data_p, SRCH_TO, SRCH_TO_L ) == 0 )
+            {
+                header = EMAIL_HDR_NEWSGROUPS;
+                name_l = SRCH_TO_L;
+            }
+        }   break;
+    }
 
     /************************************************************************
-     *  Function
+     *  Function Exit
      ************************************************************************/
 
-    //  From: ?
-    if ( strncmp( tmp_data_p, SRCH_FROM, SRCH_FROM_L ) == 0 )
-    {
-        //  YES:    Move the pointer past the search text
-        tmp_data_p += SRCH_FROM_L;
-
-        //  Also move past any whitespace to eventually point to the data
-        tmp_data_p = text_skip_past_whitespace( tmp_data_p );
-    }
-    else
+    //  Point to the value (past any whitespace)
+    if ( header != EMAIL_HDR_NONE )
     {
-        //  NO:     Set the pointer to 'NULL'
-        tmp_data_p = NULL;
+        *value_pp = text_skip_past_whitespace( tmp_data_p + name_l );
     }
 
-    /************************************************************************
-     *  Function Exit
-     ************************************************************************/
-
     //  DONE!
-    return( tmp_data_p );
+    return( header );
 }
 
 /****************************************************************************/
 /**
- *  Test the text line to see if it contains when the e-Mail was sent.
+ *  Save an e-Mail header value.
  *
- *  @param  data_p              Pointer to a line of text data
+ *  @param  field_p             Where the value is saved
+ *  @param  field_l             Size of the field
+ *  @param  value_p             The header value
  *
- *  @return email_rc            TRUE when the text is the start of an e-Mail
- *                              message, else FALSE is returned
+ *  @return void                No information is returned
  *
  *  @note
- *      Date: Tue, 7 Mar 2000 10:18:45 -0800 (PST)
+ *      A value that doesn't fit is cut short.
  *
  ****************************************************************************/
 
-char    *
-EMAIL__find_datetime(
-    char                        *   data_p
+void
+EMAIL__header_save(
+    char                        *   field_p,
+    size_t                          field_l,
+    char                        *   value_p
     )
 {
     /**
-     * @param tmp_data_p        Pointer to a temp data buffer               */
-    char                        *   tmp_data_p;
+     * @param value_l           Length of the value                         */
+    size_t                          value_l;
 
     /************************************************************************
      *  Function Initialization
      ************************************************************************/
 
-    //  Locate the first character in the buffer
-    tmp_data_p = text_skip_past_whitespace( data_p );
-
-    /************************************************************************
-     *  Function
-     ************************************************************************/
-
-    //  From: ?
-    if ( strncmp( tmp_data_p, SRCH_DATETIME, SRCH_DATETIME_L ) == 0 )
-    {
-        //  YES:    Move the pointer past the search text
-        tmp_data_p += SRCH_DATETIME_L;
+    value_l = strlen( value_p );
 
-        //  Also move past any whitespace to eventually point to the data
-        tmp_data_p = text_skip_past_whitespace( tmp_data_p );
-    }
-    else
+    //  Will it fit ?
+    if ( value_l >= field_l )
     {
-        //  NO:     Set the pointer to 'NULL'
-        tmp_data_p = NULL;
+        //  NO:     Cut it short
+        value_l = field_l - 1;
     }
 
-    /************************************************************************
-     *  Function Exit
-     ************************************************************************/
-
-    //  DONE!
-    return( tmp_data_p );
-}
-
-/****************************************************************************/
-/**
- *  Test the text line to see if it contains an e-Mail subject.
- *
- *  @param  data_p              Pointer to a line of text data
- *
- *  @return email_rc            TRUE when the text is the start of an e-Mail
- *                              message, else FALSE is returned
- *
- *  @note
- *
- ****************************************************************************/
-
-char    *
-EMAIL__find_subject(
-    char                        *   data_p
-    )
-{
-    /**
-     * @param tmp_data_p        Pointer to a temp data buffer               */
-    char                        *   tmp_data_p;
-
-    /************************************************************************
-     *  Function Initialization
-     ************************************************************************/
-
-    //  Locate the first character in the buffer
-    tmp_data_p = text_skip_past_whitespace( data_p );
-
     /************************************************************************
      *  Function
      ************************************************************************/
 
-    //  From: ?
-    if ( strncmp( tmp_data_p, SRCH_SUBJECT, SRCH_SUBJECT_L ) == 0 )
-    {
-        //  YES:    Move the pointer past the search text
-        tmp_data_p += SRCH_SUBJECT_L;
-
-        //  Also move past any whitespace to eventually point to the data
-        tmp_data_p = text_skip_past_whitespace( tmp_data_p );
-    }
-    else
-    {
-        //  NO:     Set the pointer to 'NULL'
-        tmp_data_p = NULL;
-    }
+    memcpy( field_p, value_p, value_l );
+    memset( &field_p[ value_l ], '\0', field_l - value_l );
 
     /************************************************************************
      *  Function Exit
      ************************************************************************/
 
     //  DONE!
-    return( tmp_data_p );
 }
 
 /****************************************************************************/
@@ -1080,6 +1064,7 @@ EMAIL__find_subject(
  *  Analyze e-Mail messages for stuff that we don't want anything to do with.
  *  When located discard it.
  *
+ *  @param  ctx_p               Pointer to the e-Mail parse context
  *  @param  data_p              Pointer to a line of text data
  *
  *  @return email_filtering     TRUE when we are processing stuff that is
@@ -1092,6 +1077,7 @@ EMAIL__find_subject(
 #if 1
 int
 EMAIL__filter(
+    struct  email_ctx_t         *   ctx_p,
     char                        *   data_p
     )
 {
@@ -1104,17 +1090,17 @@ EMAIL__filter(
      ************************************************************************/
 
     //  Was the last line from a reply message ?
-    if ( email_filter_type == EMAIL_FILTER_REPLY )
+    if ( ctx_p->filter_type == EMAIL_FILTER_REPLY )
     {
         //  YES:    Throw it in the trash
-        email_filter_type = EMAIL_FILTER_NONE;
+        ctx_p->filter_type = EMAIL_FILTER_NONE;
     }
 
     /************************************************************************
      *  Actively filtering
      ************************************************************************/
 
-    switch( email_filter_type )
+    switch( ctx_p->filter_type )
     {
         case    EMAIL_FILTER_X_YMAILISG:
         {
@@ -1122,7 +1108,7 @@ EMAIL__filter(
             if ( data_p[ 0 ] != ' ' )
             {
                 //  NO:     Set the return code.
-                email_filter_type = EMAIL_FILTER_NONE;
+                ctx_p->filter_type = EMAIL_FILTER_NONE;
             }
         }   break;
 
@@ -1132,7 +1118,7 @@ EMAIL__filter(
             if ( strstr( data_p, "--" ) != NULL )
             {
                 //  YES:    Set the return code.
-                email_filter_type = EMAIL_FILTER_NONE;
+                ctx_p->filter_type = EMAIL_FILTER_NONE;
             }
         }   break;
 
@@ -1156,7 +1142,7 @@ EMAIL__filter(
                 if ( strncmp( tmp_data, "x-ymailisg:", 11 ) == 0 )
                 {
                     //  YES:    Set the filter type.
-                    email_filter_type = EMAIL_FILTER_X_YMAILISG;
+                    ctx_p->filter_type = EMAIL_FILTER_X_YMAILISG;
                 }
             }
         }
@@ -1167,7 +1153,7 @@ EMAIL__filter(
      ************************************************************************/
 
     //  Set the return code
-    if ( email_filter_type == EMAIL_FILTER_NONE )
+    if ( ctx_p->filter_type == EMAIL_FILTER_NONE )
     {
         email_rc = false;
     }
@@ -1181,6 +1167,161 @@ EMAIL__filter(
 }
 #endif
 
+/****************************************************************************/
+/**
+ *  Decode one line of 'quoted-printable' text onto the end of a buffer.
+ *
+ *  @param  src_p               The encoded line
+ *  @param  out_pp              Pointer to the output buffer pointer
+ *  @param  out_size_p          Pointer to the size of the output buffer
+ *  @param  out_l_p             Pointer to the number of bytes in the buffer
+ *
+ *  @return soft_break          TRUE when the line ends with a soft line
+ *                              break (the next line continues it)
+ *
+ *  @note
+ *      One pass from the source to the buffer.  Decoding never makes the
+ *      text longer, so the buffer only grows (doubling) before the pass.
+ *      =BD, =BC and =BE are written as 1/2, 1/4 and 3/4.
+ *      An '=' that isn't followed by two hex digits is copied as it is.
+ *
+ ****************************************************************************/
+
+int
+EMAIL__qp_decode(
+    char                    *   src_p,
+    char                    **  out_pp,
+    size_t                  *   out_size_p,
+    size_t                  *   out_l_p
+    )
+{
+    /**
+     *  @param  soft_break      Return code                                 */
+    int                         soft_break;
+    /**
+     *  @param  src_l           Length of the encoded line                  */
+    size_t                      src_l;
+    /**
+     *  @param  dst_p           Where the next decoded character goes       */
+    char                    *   dst_p;
+    /**
+     *  @param  hi              Value of the first hex digit                */
+    int                         hi;
+    /**
+     *  @param  lo              Value of the second hex digit               */
+    int                         lo;
+    /**
+     *  @param  fraction_p      The text for a fraction character           */
+    char                    *   fraction_p;
+    /**
+     *  @param  grow_p          The bigger buffer                           */
+    char                    *   grow_p;
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+    soft_break = false;
+    src_l      = strlen( src_p );
+
+    //  Is there room for the whole line (and a NUL) ?
+    if ( *out_l_p + src_l + 1 > *out_size_p )
+    {
+        //  NO:     Make the buffer bigger
+        while ( *out_l_p + src_l + 1 > *out_size_p )
+        {
+            *out_size_p = ( *out_size_p == 0 ) ? EMAIL_QP_BUFFER_L
+                                               : *out_size_p * 2;
+        }
+        grow_p = mem_malloc( *out_size_p );
+
+        if ( grow_p == NULL )
+        {
+            log_write( MID_FATAL, "email",
+                       "Out of memory for a %zu byte line.\n", *out_size_p );
+        }
+
+        //  Keep the part of the line that is already decoded
+        if ( *out_pp != NULL )
+        {
+            memcpy( grow_p, *out_pp, *out_l_p );
+            mem_free( *out_pp );
+        }
+        *out_pp = grow_p;
+    }
+
+    dst_p = *out_pp + *out_l_p;
+
+    /************************************************************************
+     *  Function Code
+     ************************************************************************/
+
+    for ( ; *src_p != '\0'; src_p += 1 )
+    {
+        //  Is this an ordinary character ?
+        if ( *src_p != '=' )
+        {
+            //  YES:    Copy it
+            *dst_p++ = *src_p;
+            continue;
+        }
+
+        //  Is this a line continuation ?
+        if ( src_p[ 1 ] == '\0' )
+        {
+            //  YES:    The next line joins this one
+            soft_break = true;
+            break;
+        }
+
+        hi = qp_hex[ (unsigned char)src_p[ 1 ] ];
+        lo = ( hi < 0 ) ? -1 : qp_hex[ (unsigned char)src_p[ 2 ] ];
+
+        //  Is the format correct ?
+        if ( lo < 0 )
+        {
+            //  NO:     Copy the '=' as it is
+            *dst_p++ = *src_p;
+            continue;
+        }
+
+        //  Which character is it ?
+        switch( ( hi << 4 ) | lo )
+        {
+            case    0xBD:   fraction_p = "1/2";     break;
+            case    0xBC:   fraction_p = "1/4";     break;
+            case    0xBE:   fraction_p = "3/4";     break;
+            default:        fraction_p = NULL;      break;
+        }
+
+        //  Is it a fraction ?
+        if ( fraction_p != NULL )
+        {
+            //  YES:    Write it out (the same length as the '=XX')
+            memcpy( dst_p, fraction_p, 3 );
+            dst_p += 3;
+        }
+        else
+        {
+            //  NO:     Insert the converted character
+            *dst_p++ = (char)( ( hi << 4 ) | lo );
+        }
+
+        //  Point past the hex digits
+        src_p += 2;
+    }
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    *dst_p   = '\0';
+    *out_l_p = dst_p - *out_pp;
+
+    //  DONE!
+    return( soft_break );
+}
+
 /****************************************************************************/
 /**
  *  Scan the recipe text for 'quoted-printable' character sequences and
@@ -1191,6 +1332,8 @@ EMAIL__filter(
  *  @return void                No information is returned from this function.
  *
  *  @note
+ *      Lines joined by soft line breaks are decoded into one growing
+ *      buffer, so the whole recipe is decoded in a single pass.
  *
  ****************************************************************************/
 
@@ -1206,20 +1349,17 @@ EMAIL__quoted_printable(
      * @param import_list_p     Pointer to a list for import data           */
     struct  list_base_t     *   import_list_p;
     /**
-     * @param list_lock_key     File list key                               */
-    int                         list_lock_key;
+     *  @param  out_p           The decoded line                            */
+    char                    *   out_p;
     /**
-     *  @param  tmp_data_p      Pointer to a temporary data buffer          */
-    char                    *   tmp_data_p;
+     *  @param  out_size        Size of the decode buffer                   */
+    size_t                      out_size;
     /**
-     *  @param  join_data_p     Pointer to the join data buffer             */
-    char                    *   join_data_p;
+     *  @param  out_l           Length of the decoded line                  */
+    size_t                      out_l;
     /**
      *  @param  join_flag       TRUE = Join the next line, FALSE = Don't    */
     int                         join_flag;
-    /**
-     *  @param  xlate_char      The translated character                    */
-    long int                    xlate_char;
 
     /************************************************************************
      *  Function Initialization
@@ -1227,6 +1367,9 @@ EMAIL__quoted_printable(
 
     //  Initialize variables
     join_flag = false;
+    out_p     = NULL;
+    out_size  = 0;
+    out_l     = 0;
 
     //  Create a new import list for the decoded data
     import_list_p =  list_new( );
@@ -1235,155 +1378,810 @@ EMAIL__quoted_printable(
      *  Function Code
      ************************************************************************/
 
-    //  Lock the list for fast(er) access
-    list_lock_key = list_user_lock( rcb_p->import_list_p );
-
-    //  Scan the complete recipe
-    for( list_data_p = list_fget_first( rcb_p->import_list_p, list_lock_key );
-         list_data_p != NULL;
-         list_data_p = list_fget_next( rcb_p->import_list_p, list_data_p, list_lock_key ) )
+    //  Decode every line
+    while( ( list_data_p = list_get_first( rcb_p->import_list_p ) ) != NULL )
     {
-        //  Remove the data from the level 1 list
-        list_fdelete( rcb_p->import_list_p, list_data_p, list_lock_key );
-
-        //  Should we join this line to the previous line ?
-        if ( join_flag == true )
-        {
-            //  YES:    Reset the join flag
-            join_flag = false;
+        //  Remove the data from the old list
+        list_delete_payload( rcb_p->import_list_p, list_data_p );
 
-            //  Join the two text buffers together
-            list_data_p = text_join( join_data_p, list_data_p, true, true );
-        }
+        //  Decode it onto the end of the current line
+        join_flag = EMAIL__qp_decode( list_data_p, &out_p, &out_size, &out_l );
 
-        //  Get ready to scan the buffer
-        tmp_data_p = list_data_p;
+        //  The line may be inside a mapped input file
+        import_line_free( rcb_p, list_data_p );
 
-        //  Scan the buffer for all occurrences of quoted-printable data.
-        do
+        //  Is the decoded line complete ?
+        if ( join_flag == false )
         {
-            //  Look for the first character of a quoted printable string
-            tmp_data_p = strchr( tmp_data_p, '=' );
-
-            //  Did we find one ?
-            if ( tmp_data_p != NULL )
-            {
-                //  Is the format correct ?
-                if (    (           tmp_data_p[ 0 ] == '=' )
-                     && ( isxdigit( tmp_data_p[ 1 ] ) != 0 )
-                     && ( isxdigit( tmp_data_p[ 2 ] ) != 0 ) )
-                {
-                    /**
-                     *  @param  in_line         Temporary for HEX to ASCII  */
-                    char                            hex_data[ 3 ];
+            //  YES:    Add it to the list
+            list_put_last( import_list_p, text_copy_to_new( out_p ) );
+            out_l = 0;
+        }
+    }
 
-                    //  Clear the buffer and copy the hex data string
-                    memset( hex_data, '\0', sizeof( hex_data ) );
-                    memcpy( hex_data, &tmp_data_p[ 1 ], 2 );
+    //  Did the last line end with a soft line break ?
+    if ( join_flag == true )
+    {
+        //  YES:    Keep what there is of it
+        list_put_last( import_list_p, text_copy_to_new( out_p ) );
+    }
 
-                    //  Convert the string to a single character
-                    xlate_char = strtol( hex_data, NULL, 16 );
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
 
-                    //  Is this x'BD (1/2)
-                    if ( xlate_char == 0xBD )
-                    {
-                        //  YES:    Write it out
-                        tmp_data_p[ 0 ] = '1';
-                        tmp_data_p[ 1 ] = '/';
-                        tmp_data_p[ 2 ] = '2';
-                    }
+    //  Release the decode buffer
+    if ( out_p != NULL )
+    {
+        mem_free( out_p );
+    }
 
-                    //  Is this x'BC (1/4)
-                    else
-                    if ( xlate_char == 0xBC )
-                    {
-                        //  YES:    Write it out
-                        tmp_data_p[ 0 ] = '1';
-                        tmp_data_p[ 1 ] = '/';
-                        tmp_data_p[ 2 ] = '4';
-                    }
+    //  Replace the old list with the decoded data list
+    list_kill( rcb_p->import_list_p );
+    rcb_p->import_list_p = import_list_p;
 
-                    //  Is this x'BE (3/4)
-                    else
-                    if ( xlate_char == 0xBC )
-                    {
-                        //  YES:    Write it out
-                        tmp_data_p[ 0 ] = '3';
-                        tmp_data_p[ 1 ] = '/';
-                        tmp_data_p[ 2 ] = '4';
-                    }
+    //  DONE!
+}
 
-                    //  Everything else
-                    else
-                    {
-                        //  None of the above.  Insert the converted character
-                        tmp_data_p[ 0 ] = (char)xlate_char;
-                    }
+/****************************************************************************/
+/**
+ *  Decode base64 text one group of four characters at a time.
+ *
+ *  @param  src_p               The base64 text (no whitespace)
+ *  @param  src_l               Number of base64 characters
+ *  @param  dst_p               Where the decoded bytes go
+ *
+ *  @return dst_l               Number of decoded bytes
+ *
+ *  @note
+ *      Stops at the '=' padding or at the first character that isn't
+ *      base64.  A short last group (no padding) is decoded as well.
+ *
+ ****************************************************************************/
 
-                    //  Replace the quoted printable string with the character
-                    text_remove( tmp_data_p, 1, 2 );
+size_t
+EMAIL__base64_scalar(
+    unsigned char           *   src_p,
+    size_t                      src_l,
+    unsigned char           *   dst_p
+    )
+{
+    /**
+     *  @param  dst_l           Number of decoded bytes                     */
+    size_t                      dst_l;
+    /**
+     *  @param  value           The four digits of a group                  */
+    int                         value[ 4 ];
+    /**
+     *  @param  digit_count     Good digits in the group                    */
+    int                         digit_count;
 
-                    //  Point to the next character
-                    tmp_data_p = &tmp_data_p[ 1 ];
-                }
-                //  Is this a line continuation ?
-                else
-                if (    ( tmp_data_p[ 0 ] == '='  )
-                     && ( tmp_data_p[ 1 ] == '\0' ) )
-                {
-                    //  YES:    Set the join flag
-                    join_flag = true;
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
 
-                    //  Remove the line continuation character
-                    tmp_data_p[ 0 ] = '\0';
+    dst_l = 0;
 
-                    //  There is nothing in this buffer to look at any more.
-                    tmp_data_p = NULL;
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
 
-                    //  Save the current buffer pointer
-                    join_data_p = list_data_p;
-                }
-                else
-                {
-                    //  None of the above.  Advance the data pointer.
-                    tmp_data_p = &tmp_data_p[ 1 ];
-                }
+    while ( src_l > 0 )
+    {
+        //  Collect up to four good digits
+        for ( digit_count = 0;
+              ( digit_count < 4 ) && ( digit_count < (int)src_l );
+              digit_count += 1 )
+        {
+            value[ digit_count ] = b64_value[ src_p[ digit_count ] ];
+
+            if ( value[ digit_count ] < 0 )
+            {
+                break;
             }
+        }
 
-        }   while( tmp_data_p != NULL );
+        //  Write out what the digits hold
+        if ( digit_count >= 2 )
+        {
+            dst_p[ dst_l++ ] = ( value[ 0 ] << 2 ) | ( value[ 1 ] >> 4 );
+        }
+        if ( digit_count >= 3 )
+        {
+            dst_p[ dst_l++ ] = ( value[ 1 ] << 4 ) | ( value[ 2 ] >> 2 );
+        }
+        if ( digit_count == 4 )
+        {
+            dst_p[ dst_l++ ] = ( value[ 2 ] << 6 ) | value[ 3 ];
+        }
 
-        //  Is the join flag set ?
-        if ( join_flag == false )
+        //  Was that the end (padding, a bad character or no more text) ?
+        if ( digit_count < 4 )
         {
-            //  NO:     Add the current line to the list
-            list_put_last( import_list_p, list_data_p );
+            //  YES:    Done
+            break;
         }
+
+        src_p += 4;
+        src_l -= 4;
     }
 
-    //  Release the lock on the import list
-    list_user_unlock( rcb_p->import_list_p, list_lock_key );
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+    return( dst_l );
+}
+
+/****************************************************************************/
+/**
+ *  Decode base64 text.
+ *
+ *  @param  src_p               The base64 text (no whitespace)
+ *  @param  src_l               Number of base64 characters
+ *  @param  dst_p               Where the decoded bytes go ( >= src_l * 3 / 4 )
+ *
+ *  @return dst_l               Number of decoded bytes
+ *
+ *  @note
+ *      With SSE2 sixteen characters are checked, translated and packed to
+ *      twelve bytes at a time.  A block with padding or a bad character
+ *      (and whatever is left at the end) goes to EMAIL__base64_scalar( ).
+ *
+ ****************************************************************************/
+
+size_t
+EMAIL__base64_decode(
+    unsigned char           *   src_p,
+    size_t                      src_l,
+    unsigned char           *   dst_p
+    )
+{
+    /**
+     *  @param  dst_l           Number of decoded bytes                     */
+    size_t                      dst_l;
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+    dst_l = 0;
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+#if defined( __SSE2__ )
+    {
+        /**
+         *  @param  data        Sixteen base64 characters                   */
+        __m128i                 data;
+        /**
+         *  @param  upper       'A' - 'Z'                                   */
+        __m128i                 upper;
+        /**
+         *  @param  lower       'a' - 'z'                                   */
+        __m128i                 lower;
+        /**
+         *  @param  digit       '0' - '9'                                   */
+        __m128i                 digit;
+        /**
+         *  @param  plus        '+'                                         */
+        __m128i                 plus;
+        /**
+         *  @param  slash       '/'                                         */
+        __m128i                 slash;
+        /**
+         *  @param  shift       What to add to each character               */
+        __m128i                 shift;
+        /**
+         *  @param  packed      24 decoded bits in each 32 bit lane         */
+        uint32_t                packed[ 4 ];
+        /**
+         *  @param  ndx         Lane number                                 */
+        int                     ndx;
+
+        //  Sixteen characters at a time
+        for ( ; src_l >= 16; src_p += 16, src_l -= 16 )
+        {
+            data  = _mm_loadu_si128( (__m128i *)src_p );
+
+            //  Sort the characters into their ranges
+            upper = _mm_and_si128( _mm_cmpgt_epi8( data, _mm_set1_epi8( 'A' - 1 ) ),
+                                   _mm_cmplt_epi8( data, _mm_set1_epi8( 'Z' + 1 ) ) );
+            lower = _mm_and_si128( _mm_cmpgt_epi8( data, _mm_set1_epi8( 'a' - 1 ) ),
+                                   _mm_cmplt_epi8( data, _mm_set1_epi8( 'z' + 1 ) ) );
+            digit = _mm_and_si128( _mm_cmpgt_epi8( data, _mm_set1_epi8( '0' - 1 ) ),
+                                   _mm_cmplt_epi8( data, _mm_set1_epi8( '9' + 1 ) ) );
+            plus  = _mm_cmpeq_epi8( data, _mm_set1_epi8( '+' ) );
+            slash = _mm_cmpeq_epi8( data, _mm_set1_epi8( '/' ) );
+
+            //  Is every character a base64 digit ?
+            if ( _mm_movemask_epi8( _mm_or_si128( _mm_or_si128( upper, lower ),
+                                    _mm_or_si128( _mm_or_si128( digit, plus ),
+                                                  slash ) ) ) != 0xFFFF )
+            {
+                //  NO:     Padding or a bad character
+                break;
+            }
+
+            //  Translate to 6 bit values
+            shift = _mm_or_si128(
+                        _mm_or_si128( _mm_and_si128( upper, _mm_set1_epi8( -'A'      ) ),
+                                      _mm_and_si128( lower, _mm_set1_epi8( 26 - 'a'  ) ) ),
+                        _mm_or_si128( _mm_and_si128( digit, _mm_set1_epi8( 52 - '0'  ) ),
+                        _mm_or_si128( _mm_and_si128( plus,  _mm_set1_epi8( 62 - '+'  ) ),
+                                      _mm_and_si128( slash, _mm_set1_epi8( 63 - '/'  ) ) ) ) );
+            data  = _mm_add_epi8( data, shift );
+
+            //  Pack a b c d into ( a << 18 ) | ( b << 12 ) | ( c << 6 ) | d
+            data  = _mm_or_si128( _mm_slli_epi16( _mm_and_si128( data,
+                                                  _mm_set1_epi16( 0x00FF ) ), 6 ),
+                                  _mm_srli_epi16( data, 8 ) );
+            data  = _mm_madd_epi16( data, _mm_set1_epi32( 0x00011000 ) );
+            _mm_storeu_si128( (__m128i *)packed, data );
+
+            //  Three bytes from each lane, high byte first
+            for ( ndx = 0; ndx < 4; ndx += 1 )
+            {
+                dst_p[ dst_l++ ] = packed[ ndx ] >> 16;
+                dst_p[ dst_l++ ] = packed[ ndx ] >>  8;
+                dst_p[ dst_l++ ] = packed[ ndx ];
+            }
+        }
+    }
+#endif
+
+    //  Whatever is left (or everything without SSE2)
+    dst_l += EMAIL__base64_scalar( src_p, src_l, &dst_p[ dst_l ] );
 
     /************************************************************************
      *  Function Exit
      ************************************************************************/
 
-    //  Delete everything on the old list
-    if ( rcb_p->import_list_p != NULL )
+    //  DONE!
+    return( dst_l );
+}
+
+/****************************************************************************/
+/**
+ *  Save the multipart boundary named by a header line.
+ *
+ *  @param  ctx_p               Pointer to the e-Mail parse context
+ *  @param  data_p              Pointer to a header line
+ *
+ *  @return void                No information is returned
+ *
+ *  @note
+ *      Content-Type: multipart/mixed; boundary="b1"  and  boundary=b1
+ *      both save b1.  A nested multipart adds its boundary to the ones
+ *      of the parts around it; they are all forgotten at the next "From ".
+ *
+ ****************************************************************************/
+
+void
+EMAIL__base64_boundary(
+    struct  email_ctx_t     *   ctx_p,
+    char                    *   data_p
+    )
+{
+    /**
+     *  @param  start_p         Start of the boundary                       */
+    char                    *   start_p;
+    /**
+     *  @param  boundary_l      Length of the boundary                      */
+    size_t                      boundary_l;
+    /**
+     *  @param  ndx             Index into the saved boundaries             */
+    int                         ndx;
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+    //  Is there a boundary parameter on this line ?
+    start_p = strcasestr( data_p, SRCH_BOUNDARY );
+
+    if ( start_p == NULL )
     {
-        if ( list_query_count( rcb_p->import_list_p ) > 0 )
+        //  NO:     Nothing to save
+        return;
+    }
+
+    //  Skip past [boundary] [=]
+    start_p = text_skip_past_whitespace( &start_p[ SRCH_BOUNDARY_L ] );
+
+    if ( start_p[ 0 ] != '=' )
+    {
+        //  NO:     It's some other use of the word
+        return;
+    }
+    start_p = text_skip_past_whitespace( &start_p[ 1 ] );
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    //  Is it quoted ?
+    if ( start_p[ 0 ] == '"' )
+    {
+        //  YES:    Everything up to the closing quote
+        start_p   += 1;
+        boundary_l = strcspn( start_p, "\"" );
+    }
+    else
+    {
+        //  NO:     Everything up to a space or the next parameter
+        boundary_l = strcspn( start_p, " \t\r\n;" );
+    }
+
+    //  Is it one we can use ?
+    if (    ( boundary_l == 0                    )
+         || ( boundary_l >= EMAIL_BOUNDARY_L     ) )
+    {
+        //  NO:     Leave the saved boundaries alone
+        return;
+    }
+
+    //  Is it saved already ?
+    for ( ndx = 0; ndx < ctx_p->b64_boundary_count; ndx += 1 )
+    {
+        if (    ( strlen( ctx_p->b64_boundary[ ndx ] ) == boundary_l )
+             && ( strncmp( ctx_p->b64_boundary[ ndx ], start_p,
+                           boundary_l ) == 0 ) )
         {
-            while( ( list_data_p = list_get_first( rcb_p->import_list_p ) ) != NULL )
+            //  YES:    Nothing more to do
+            return;
+        }
+    }
+
+    //  Is there room for it ?
+    if ( ctx_p->b64_boundary_count < EMAIL_B64_BOUNDARIES )
+    {
+        //  YES:    Save it
+        memcpy( ctx_p->b64_boundary[ ctx_p->b64_boundary_count ],
+                start_p, boundary_l );
+        ctx_p->b64_boundary[ ctx_p->b64_boundary_count ][ boundary_l ] = '\0';
+        ctx_p->b64_boundary_count += 1;
+    }
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+}
+
+/****************************************************************************/
+/**
+ *  Test for the boundary line that starts a MIME part.
+ *
+ *  @param  ctx_p               Pointer to the e-Mail parse context
+ *  @param  data_p              Pointer to a line of text data
+ *
+ *  @return is_part             TRUE when the line is "--" and one of the
+ *                              message's boundaries, else FALSE
+ *
+ *  @note
+ *      The closing boundary ("--b1--") matches as well; the headers that
+ *      follow it (if any) are read the same way.
+ *
+ ****************************************************************************/
+
+int
+EMAIL__base64_is_part(
+    struct  email_ctx_t     *   ctx_p,
+    char                    *   data_p
+    )
+{
+    /**
+     *  @param  is_part         Return code                                 */
+    int                         is_part;
+    /**
+     *  @param  ndx             Index into the saved boundaries             */
+    int                         ndx;
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+    is_part = false;
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    //  Does the line start with two dash [-] characters ?
+    if ( ( data_p[ 0 ] == '-' ) && ( data_p[ 1 ] == '-' ) )
+    {
+        //  YES:    Followed by one of the boundaries ?
+        for ( ndx = 0; ndx < ctx_p->b64_boundary_count; ndx += 1 )
+        {
+            if ( strncmp( &data_p[ 2 ], ctx_p->b64_boundary[ ndx ],
+                          strlen( ctx_p->b64_boundary[ ndx ] ) ) == 0 )
             {
-                list_delete_payload( rcb_p->import_list_p, list_data_p );
-                mem_free( list_data_p );
+                //  YES:    A new part starts here
+                is_part = true;
+                break;
             }
         }
-        list_kill( rcb_p->import_list_p );
-        rcb_p->import_list_p = NULL;
     }
 
-    //  Replace the old list with the decoded data list
-    rcb_p->import_list_p = import_list_p;
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+    return( is_part );
+}
+
+/****************************************************************************/
+/**
+ *  Decode the base64 text part that was collected.
+ *
+ *  @param  ctx_p               Pointer to the e-Mail parse context
+ *
+ *  @return void                No information is returned
+ *
+ *  @note
+ *      The decoded text is split into lines (CR/LF removed) and put at
+ *      the front of the pending lines, where email_rcb( ) picks them up
+ *      just as if they had been in the file.
+ *
+ ****************************************************************************/
+
+void
+EMAIL__base64_end(
+    struct  email_ctx_t     *   ctx_p
+    )
+{
+    /**
+     *  @param  text_p          The decoded text                            */
+    unsigned char           *   text_p;
+    /**
+     *  @param  text_l          Length of the decoded text                  */
+    size_t                      text_l;
+    /**
+     *  @param  line_p          Start of a decoded line                     */
+    unsigned char           *   line_p;
+    /**
+     *  @param  end_p           End of a decoded line                       */
+    unsigned char           *   end_p;
+    /**
+     *  @param  line_l          Length of a decoded line                    */
+    size_t                      line_l;
+    /**
+     *  @param  new_line_p      A copy of the decoded line                  */
+    char                    *   new_line_p;
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+    ctx_p->b64_body = false;
+
+    //  Decode it
+    text_p = mem_malloc( ( ctx_p->b64_l / 4 + 1 ) * 3 );
+    text_l = EMAIL__base64_decode( (unsigned char *)ctx_p->b64_p,
+                                   ctx_p->b64_l, text_p );
+    ctx_p->b64_l = 0;
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    //  Split it into lines
+    for ( line_p = text_p; line_p < text_p + text_l; line_p = end_p + 1 )
+    {
+        //  Find the end of the line
+        end_p = memchr( line_p, '\n', ( text_p + text_l ) - line_p );
+        if ( end_p == NULL )
+        {
+            end_p = text_p + text_l;
+        }
+
+        //  Remove the CR
+        line_l = end_p - line_p;
+        if ( ( line_l > 0 ) && ( line_p[ line_l - 1 ] == '\r' ) )
+        {
+            line_l -= 1;
+        }
+
+        //  Copy it to the pending lines
+        new_line_p = mem_malloc( line_l + 1 );
+        memcpy( new_line_p, line_p, line_l );
+        new_line_p[ line_l ] = '\0';
+
+        list_put_last( ctx_p->pending_p, new_line_p );
+        ctx_p->pending_decoded += 1;
+    }
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    mem_free( text_p );
+
+    //  DONE!
+}
+
+/****************************************************************************/
+/**
+ *  Follow the MIME parts and collect base64 encoded text/plain bodies.
+ *
+ *  @param  tcb_p               Pointer to a Thread Control Block
+ *  @param  rcb_p               Pointer to the file's Recipe Control Block
+ *  @param  ctx_p               Pointer to the e-Mail parse context
+ *  @param  data_p              Pointer to a line of text data
+ *
+ *  @return consumed            TRUE when the line was taken (collected or
+ *                              held until the decoded text is processed),
+ *                              else FALSE and the line is processed now.
+ *
+ *  @note
+ *      A header block starts at the top of the file, at "From " and at a
+ *      line that is "--" and one of the boundaries the message's headers
+ *      named, and ends at the first empty line.  When the
+ *      block said base64 and text/plain (or nothing, which means text/plain)
+ *      the body is collected until an empty line, a boundary or anything
+ *      that isn't base64.  The line that ends the body is held, so it is
+ *      processed after the decoded text.
+ *
+ ****************************************************************************/
+
+int
+EMAIL__base64(
+    struct  tcb_t           *   tcb_p,
+    struct  rcb_t           *   rcb_p,
+    struct  email_ctx_t     *   ctx_p,
+    char                    *   data_p
+    )
+{
+    /**
+     *  @param  consumed        Return code                                 */
+    int                         consumed;
+    /**
+     *  @param  tmp_data_p      Pointer into the line                       */
+    char                    *   tmp_data_p;
+    /**
+     *  @param  digit_l         Number of base64 characters on the line     */
+    size_t                      digit_l;
+    /**
+     *  @param  grow_p          The bigger base64 buffer                    */
+    char                    *   grow_p;
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+    consumed = false;
+
+    //  Was this line decoded from base64 ?
+    if ( ctx_p->decoded_line == true )
+    {
+        //  YES:    It is text now
+        return( consumed );
+    }
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    //  Collecting a base64 body ?
+    if ( ctx_p->b64_body == true )
+    {
+        //  YES:    Count the base64 characters
+        tmp_data_p = text_skip_past_whitespace( data_p );
+        for ( digit_l = 0;
+              (    ( b64_value[ (unsigned char)tmp_data_p[ digit_l ] ] >= 0 )
+                || ( tmp_data_p[ digit_l ] == '=' ) );
+              digit_l += 1 );
+
+        //  Is it a base64 line ?
+        if (    ( digit_l > 0 )
+             && ( *text_skip_past_whitespace( &tmp_data_p[ digit_l ] ) == '\0' ) )
+        {
+            //  YES:    Collect it
+            if ( ctx_p->b64_l + digit_l > ctx_p->b64_size )
+            {
+                while ( ctx_p->b64_l + digit_l > ctx_p->b64_size )
+                {
+                    ctx_p->b64_size = ( ctx_p->b64_size == 0 )
+                                        ? EMAIL_B64_BUFFER_L
+                                        : ctx_p->b64_size * 2;
+                }
+                grow_p = mem_malloc( ctx_p->b64_size );
+
+                if ( grow_p == NULL )
+                {
+                    log_write( MID_FATAL, "email",
+                               "Out of memory for a %zu byte base64 body.\n",
+                               ctx_p->b64_size );
+                }
+
+                //  Keep what has been collected so far
+                if ( ctx_p->b64_p != NULL )
+                {
+                    memcpy( grow_p, ctx_p->b64_p, ctx_p->b64_l );
+                    mem_free( ctx_p->b64_p );
+                }
+                ctx_p->b64_p = grow_p;
+            }
+            memcpy( &ctx_p->b64_p[ ctx_p->b64_l ], tmp_data_p, digit_l );
+            ctx_p->b64_l += digit_l;
+
+            import_line_free( rcb_p, data_p );
+        }
+        else
+        {
+            //  NO:     The body is finished, decode it
+            EMAIL__base64_end( ctx_p );
+
+            //  This line comes after the decoded text
+            list_put_last( ctx_p->pending_p, data_p );
+        }
+
+        //  Either way the line has been taken
+        consumed = true;
+    }
+
+    //  A new message ?
+    else
+    if ( strncmp( data_p, SRCH_S_FROM, SRCH_S_FROM_L ) == 0 )
+    {
+        //  YES:    Start over (text/plain is the default, no boundaries)
+        ctx_p->b64_header         = true;
+        ctx_p->b64_encoded        = false;
+        ctx_p->b64_text           = true;
+        ctx_p->b64_boundary_count = 0;
+    }
+
+    //  A new MIME part ?
+    else
+    if ( EMAIL__base64_is_part( ctx_p, data_p ) == true )
+    {
+        //  YES:    Start over (text/plain is the default)
+        ctx_p->b64_header  = true;
+        ctx_p->b64_encoded = false;
+        ctx_p->b64_text    = true;
+    }
+
+    //  In a header block ?
+    else
+    if ( ctx_p->b64_header == true )
+    {
+        //  YES:    Is this the end of the headers ?
+        if ( *text_skip_past_whitespace( data_p ) == '\0' )
+        {
+            //  YES:    Is the body base64 encoded text ?
+            ctx_p->b64_header = false;
+            if (    ( ctx_p->b64_encoded == true )
+                 && ( ctx_p->b64_text    == true ) )
+            {
+                //  YES:    Collect it
+                ctx_p->b64_body = true;
+                ctx_p->b64_l    = 0;
+            }
+        }
+        else
+        {
+            //  NO:     Content-Type: ?
+            switch( EMAIL__find_content( tcb_p, data_p ) )
+            {
+                case    CT_NONE:
+                {
+                    //  Some other header
+                }   break;
+                case    CT_TEXT:
+                {
+                    ctx_p->b64_text = true;
+                }   break;
+                default:
+                {
+                    ctx_p->b64_text = false;
+                }
+            }
+
+            //  Content-Transfer-Encoding: base64 ?
+            if ( email_find_encoding( data_p ) == CTE_BASE64 )
+            {
+                ctx_p->b64_encoded = true;
+            }
 
+            //  A multipart boundary ?
+            EMAIL__base64_boundary( ctx_p, data_p );
+        }
+    }
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+    return( consumed );
 }
-/****************************************************************************/
\ No newline at end of file
+
+/****************************************************************************/
+/**
+ *  Get the next line for email_rcb( ) to process.
+ *
+ *  @param  rcb_p               Pointer to the file's Recipe Control Block
+ *  @param  ctx_p               Pointer to the e-Mail parse context
+ *  @param  line_ndx_p          Position in the line index (mapped files)
+ *  @param  list_lock_key       File list key
+ *
+ *  @return line_p              The next line or NULL at the end of the text
+ *
+ *  @note
+ *      Lines that are waiting (decoded base64 text and the line that ended
+ *      it) come before the next input line.  At the end of the file a
+ *      base64 body that is still being collected is decoded.
+ *
+ ****************************************************************************/
+
+char    *
+EMAIL__next_line(
+    struct  rcb_t           *   rcb_p,
+    struct  email_ctx_t     *   ctx_p,
+    int                     *   line_ndx_p,
+    int                         list_lock_key
+    )
+{
+    /**
+     *  @param  line_p          The next line                               */
+    char                    *   line_p;
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+    ctx_p->decoded_line = false;
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    //  Is anything waiting ?
+    line_p = list_get_first( ctx_p->pending_p );
+
+    if ( line_p == NULL )
+    {
+        //  NO:     Read the next input line
+        line_p = import_next_line( rcb_p, line_ndx_p, list_lock_key );
+
+        //  The end of the file in the middle of a base64 body ?
+        if (    ( line_p           == NULL )
+             && ( rcb_p->chunk_eof == true )
+             && ( ctx_p->b64_body  == true ) )
+        {
+            //  YES:    Decode what there is
+            EMAIL__base64_end( ctx_p );
+            line_p = list_get_first( ctx_p->pending_p );
+        }
+    }
+
+    //  Was it waiting ?
+    if (    ( line_p != NULL )
+         && ( line_p == list_get_first( ctx_p->pending_p ) ) )
+    {
+        //  YES:    Take it off the list
+        list_delete_payload( ctx_p->pending_p, line_p );
+
+        //  Was it decoded from base64 ?
+        if ( ctx_p->pending_decoded > 0 )
+        {
+            //  YES:    Don't look at it again
+            ctx_p->pending_decoded -= 1;
+            ctx_p->decoded_line     = true;
+        }
+    }
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+    return( line_p );
+}
+/****************************************************************************/
@@ -48,6 +48,7 @@
 
 //----------------------------------------------------------------------------
 #define EMAIL_BOUNDARY_L            ( 100 )
+#define EMAIL_B64_BOUNDARIES        (   4 )     //  Nested multipart levels
 //----------------------------------------------------------------------------
 #define SRCH_CONTENT_TYPE           "Content-Type:"
 #define SRCH_CONTENT_TYPE_L         strlen( SRCH_CONTENT_TYPE )
@@ -198,12 +199,84 @@ enum    email_filter_e
     EMAIL_FILTER_REPLY          =   4
 };
 //----------------------------------------------------------------------------
+enum    email_header_e
+{
+    EMAIL_HDR_NONE              =   0,      //  Not a header that is kept
+    EMAIL_HDR_ENCODING          =   1,      //  Content-Transfer-Encoding:
+    EMAIL_HDR_NEWSGROUPS        =   2,      //  Newsgroups: or To:
+    EMAIL_HDR_SUBJECT           =   3,      //  Subject:
+    EMAIL_HDR_FROM              =   4,      //  From:
+    EMAIL_HDR_DATETIME          =   5       //  Date:
+};
+//----------------------------------------------------------------------------
 
 /****************************************************************************
  * Library Private Structures
  ****************************************************************************/
 
 //----------------------------------------------------------------------------
+/**
+ *  @param  email_ctx_t         Parse state for one e-Mail file
+ *  @NOTE:  One per input file.  It rides on the file RCB so a streamed
+ *          file picks up where its last chunk left off.                   */
+struct  email_ctx_t
+{
+    /**
+     *  @param  filter_type     What (if anything) is being filtered out    */
+    enum    email_filter_e          filter_type;
+    /**
+     *  @param  boundary        e-Mail multipart boundary identifier        */
+    char                            boundary[ EMAIL_BOUNDARY_L ];
+    /**
+     *  @param  new_rcb_p       The recipe that is being collected          */
+    struct  rcb_t               *   new_rcb_p;
+    /**
+     *  @param  quoted_printable TRUE = QUOTED-PRINTABLE e-Mail             */
+    int                             quoted_printable;
+    /**
+     *  @param  email_start_flag TRUE = e-mail processing                   */
+    int                             email_start_flag;
+    /**
+     *  @param  group_start_flag TRUE = e-mail group processing             */
+    int                             group_start_flag;
+    /**
+     *  @param  b64_header      TRUE = in the headers of a MIME part        */
+    int                             b64_header;
+    /**
+     *  @param  b64_encoded     TRUE = the part is base64 encoded           */
+    int                             b64_encoded;
+    /**
+     *  @param  b64_text        TRUE = the part is text/plain               */
+    int                             b64_text;
+    /**
+     *  @param  b64_body        TRUE = collecting a base64 text body        */
+    int                             b64_body;
+    /**
+     *  @param  b64_boundary    The multipart boundaries of the message     */
+    char                            b64_boundary[ EMAIL_B64_BOUNDARIES ]
+                                                [ EMAIL_BOUNDARY_L ];
+    /**
+     *  @param  b64_boundary_count  Number of boundaries in b64_boundary    */
+    int                             b64_boundary_count;
+    /**
+     *  @param  b64_p           The base64 text that has been collected     */
+    char                        *   b64_p;
+    /**
+     *  @param  b64_l           Number of base64 characters collected       */
+    size_t                          b64_l;
+    /**
+     *  @param  b64_size        Size of the b64_p buffer                    */
+    size_t                          b64_size;
+    /**
+     *  @param  pending_p       Lines to process before the next input line */
+    struct  list_base_t         *   pending_p;
+    /**
+     *  @param  pending_decoded Decoded lines at the front of pending_p     */
+    int                             pending_decoded;
+    /**
+     *  @param  decoded_line    TRUE = the current line was base64 decoded  */
+    int                             decoded_line;
+};
 //----------------------------------------------------------------------------
 
 /****************************************************************************
@@ -211,15 +284,6 @@ enum    email_filter_e
  ****************************************************************************/
 
 //----------------------------------------------------------------------------
-/**
- *  @param  email_filtering     When TRUE we are filtering the data stream  */
-EMAIL_EXT
-    enum    email_filter_e          email_filter_type;
-//----------------------------------------------------------------------------
-/**
- *  @param  email_boundary      e-Mail boundary identifier                  */
-EMAIL_EXT
-    char                            email_boundary[ EMAIL_BOUNDARY_L ];
 //----------------------------------------------------------------------------
 
 /****************************************************************************
@@ -234,21 +298,25 @@ EMAIL__is_start(
 //----------------------------------------------------------------------------
 enum    boundary_type_e
 EMAIL__is_boundary(
+    struct  email_ctx_t     *   ctx_p,
     char                    *   data_p
     );
 //----------------------------------------------------------------------------
 enum    boundary_type_e
 EMAIL__is_boundary_identifier(
+    struct  email_ctx_t     *   ctx_p,
     char                    *   data_p
     );
 //----------------------------------------------------------------------------
 int
 EMAIL__is_multipart_break(
+    struct  email_ctx_t     *   ctx_p,
     char                    *   data_p
     );
 //----------------------------------------------------------------------------
 int
 EMAIL__is_group_break(
+    struct  email_ctx_t     *   ctx_p,
     char                    *   data_p
     );
 //----------------------------------------------------------------------------
@@ -269,34 +337,103 @@ EMAIL__find_source(
     char                    *   data_p
     );
 //----------------------------------------------------------------------------
-char    *
-EMAIL__find_from(
-    char                    *   data_p
+enum    email_header_e
+EMAIL__header(
+    char                    *   data_p,
+    char                    **  value_pp
     );
 //----------------------------------------------------------------------------
-char    *
-EMAIL__find_newsgroup(
+void
+EMAIL__header_save(
+    char                    *   field_p,
+    size_t                      field_l,
+    char                    *   value_p
+    );
+//----------------------------------------------------------------------------
+int
+EMAIL__filter(
+    struct  email_ctx_t     *   ctx_p,
     char                    *   data_p
     );
 //----------------------------------------------------------------------------
-char    *
-EMAIL__find_datetime(
+int
+EMAIL__qp_decode(
+    char                    *   src_p,
+    char                    **  out_pp,
+    size_t                  *   out_size_p,
+    size_t                  *   out_l_p
+    );
+//----------------------------------------------------------------------------
+void
+EMAIL__quoted_printable(
+    struct  rcb_t           *   rcb_p
+    );
+//----------------------------------------------------------------------------
+size_t
+EMAIL__base64_scalar(
+    unsigned char           *   src_p,
+    size_t                      src_l,
+    unsigned char           *   dst_p
+    );
+//----------------------------------------------------------------------------
+size_t
+EMAIL__base64_decode(
+    unsigned char           *   src_p,
+    size_t                      src_l,
+    unsigned char           *   dst_p
+    );
+//----------------------------------------------------------------------------
+void
+EMAIL__base64_boundary(
+    struct  email_ctx_t     *   ctx_p,
     char                    *   data_p
     );
 //----------------------------------------------------------------------------
-char    *
-EMAIL__find_subject(
+int
+EMAIL__base64_is_part(
+    struct  email_ctx_t     *   ctx_p,
     char                    *   data_p
     );
 //----------------------------------------------------------------------------
+void
+EMAIL__base64_end(
+    struct  email_ctx_t     *   ctx_p
+    );
+//----------------------------------------------------------------------------
 int
-EMAIL__filter(
+EMAIL__base64(
+    struct  tcb_t           *   tcb_p,
+    struct  rcb_t           *   rcb_p,
+    struct  email_ctx_t     *   ctx_p,
     char                    *   data_p
     );
 //----------------------------------------------------------------------------
+char    *
+EMAIL__next_line(
+    struct  rcb_t           *   rcb_p,
+    struct  email_ctx_t     *   ctx_p,
+    int                     *   line_ndx_p,
+    int                         list_lock_key
+    );
+//----------------------------------------------------------------------------
 void
-EMAIL__quoted_printable(
-    struct  rcb_t           *   rcb_p
+EMAIL__BENCH_base64(
+    void
+    );
+//----------------------------------------------------------------------------
+void
+EMAIL__BENCH_qp(
+    void
+    );
+//----------------------------------------------------------------------------
+int
+EMAIL__TEST_base64(
+    void
+    );
+//----------------------------------------------------------------------------
+int
+EMAIL__TEST_base64_part(
+    void
     );
 //----------------------------------------------------------------------------
 
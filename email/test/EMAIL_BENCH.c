@@ -0,0 +1,367 @@
+/*******************************  COPYRIGHT  ********************************/
+/**
+ *  Author? "Gregory N. Leonhardt"
+ *  License? "CC BY-NC 2.0"
+ *           "https://creativecommons.org/licenses/by-nc/2.0/"
+ *
+ ****************************************************************************/
+
+/******************************** JAVADOC ***********************************/
+/**
+ *  This file contains the benchmarks for the 'email' library.
+ *
+ *  @note
+ *      The quoted-printable decoder is run on BENCH_QP_BYTES of encoded
+ *      text.  Every 76 byte line ends with a soft line break, and the
+ *      soft breaks join 1, 10, 100 and 1000 lines into one.  A linear
+ *      decoder runs at the same speed however long the joined lines are.
+ *      The base64 decoder is run on BENCH_B64_BYTES of encoded text, once
+ *      with EMAIL__base64_decode( ) and once with EMAIL__base64_scalar( ).
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ *  Compiler directives
+ ****************************************************************************/
+
+
+/****************************************************************************
+ * System Function API
+ ****************************************************************************/
+
+                                //*******************************************
+#include <stdint.h>             //  Alternative storage types
+#include <stdbool.h>            //  TRUE, FALSE, etc.
+#include <stdio.h>              //  Standard I/O definitions
+                                //*******************************************
+#include <string.h>             //  Functions for managing strings
+#include <stdlib.h>             //  malloc( ), free( )
+#include <time.h>               //  clock_gettime( )
+                                //*******************************************
+
+/****************************************************************************
+ * Application APIs
+ ****************************************************************************/
+
+                                //*******************************************
+#include "global.h"             //  Global stuff for this application
+#include "libtools_api.h"       //  My Tools Library
+                                //*******************************************
+#include "tcb_api.h"            //  API for all tcb_*               PUBLIC
+#include "rcb_api.h"            //  API for all rcb_*               PUBLIC
+                                //*******************************************
+#include "email_api.h"          //  API for all email_*             PUBLIC
+#include "../email_lib.h"       //  API for all EMAIL__*            PRIVATE
+                                //*******************************************
+
+/****************************************************************************
+ * Enumerations local to this file
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Definitions local to this file
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+#define BENCH_QP_BYTES          ( 16 * 1024 * 1024 )
+#define BENCH_QP_LINE           "=3D=20=BDcup flour=2C =BC tsp salt=0D=0A=E2=80=93 " \
+                                "mix well =3D=3D stir="
+#define BENCH_B64_BYTES         ( 64 * 1024 * 1024 )
+#define BENCH_B64_PASSES        ( 4 )
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Structures local to this file
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Storage Allocation local to this file
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * LIB Functions
+ ****************************************************************************/
+
+/****************************************************************************/
+/**
+ *  Time one quoted-printable decode run.
+ *
+ *  @param  join_count          Encoded lines in each decoded line
+ *
+ *  @return seconds             Wall clock time for the decode
+ *
+ *  @note
+ *
+ ****************************************************************************/
+
+static
+double
+BENCH__qp_run(
+    int                         join_count
+    )
+{
+    /**
+     *  @param  rcb             Recipe Control Block for the encoded text   */
+    struct  rcb_t               rcb;
+    /**
+     *  @param  line_p          One encoded line                            */
+    char                    *   line_p;
+    /**
+     *  @param  line_count      Number of encoded lines                     */
+    int                         line_count;
+    /**
+     *  @param  ndx             Line number                                 */
+    int                         ndx;
+    /**
+     *  @param  start           Start time                                  */
+    struct  timespec            start;
+    /**
+     *  @param  stop            Stop time                                   */
+    struct  timespec            stop;
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+    //  Build the encoded text
+    memset( &rcb, '\0', sizeof( rcb ) );
+    rcb.import_list_p = list_new( );
+    line_count = BENCH_QP_BYTES / strlen( BENCH_QP_LINE );
+
+    for ( ndx = 1; ndx <= line_count; ndx += 1 )
+    {
+        line_p = text_copy_to_new( BENCH_QP_LINE );
+
+        //  Is this the last line of a joined line ?
+        if ( ( ndx % join_count ) == 0 )
+        {
+            //  YES:    No soft line break
+            line_p[ strlen( line_p ) - 1 ] = '\0';
+        }
+
+        list_put_last( rcb.import_list_p, line_p );
+    }
+
+    //  Start the clock
+    clock_gettime( CLOCK_MONOTONIC, &start );
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    EMAIL__quoted_printable( &rcb );
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  Stop the clock
+    clock_gettime( CLOCK_MONOTONIC, &stop );
+
+    //  Clean up
+    while( ( line_p = list_get_first( rcb.import_list_p ) ) != NULL )
+    {
+        list_delete_payload( rcb.import_list_p, line_p );
+        mem_free( line_p );
+    }
+    list_kill( rcb.import_list_p );
+
+    //  DONE!
+    return(   (double)( stop.tv_sec  - start.tv_sec  )
+            + (double)( stop.tv_nsec - start.tv_nsec ) / 1000000000.0 );
+}
+
+/****************************************************************************/
+/**
+ *  Time the quoted-printable decoder.
+ *
+ *  @param  void                No parameters are passed into this function.
+ *
+ *  @return void                No information is returned
+ *
+ *  @note
+ *
+ ****************************************************************************/
+
+void
+EMAIL__BENCH_qp(
+    void
+    )
+{
+    /**
+     *  @param  join_count      Encoded lines in each decoded line          */
+    static
+    int                         join_count[ ] = { 1, 10, 100, 1000 };
+    /**
+     *  @param  ndx             Index into join_count                       */
+    int                         ndx;
+    /**
+     *  @param  seconds         Run time                                    */
+    double                      seconds;
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+    log_write( MID_INFO, "EMAIL__BENCH",
+               "quoted-printable: %d MB encoded\n",
+               BENCH_QP_BYTES / ( 1024 * 1024 ) );
+    log_write( MID_INFO, "EMAIL__BENCH",
+               "JOINED LINES    SECONDS     MB/SEC\n" );
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    for ( ndx = 0;
+          ndx < (int)( sizeof( join_count ) / sizeof( join_count[ 0 ] ) );
+          ndx += 1 )
+    {
+        seconds = BENCH__qp_run( join_count[ ndx ] );
+        log_write( MID_INFO, "EMAIL__BENCH",
+                   "%12d %10.3f %10.1f\n",
+                   join_count[ ndx ], seconds,
+                   BENCH_QP_BYTES / ( 1024.0 * 1024.0 ) / seconds );
+    }
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+}
+
+/****************************************************************************/
+/**
+ *  Time the base64 decoder.
+ *
+ *  @param  void                No parameters are passed into this function.
+ *
+ *  @return void                No information is returned
+ *
+ *  @note
+ *      Both decoders must produce the same bytes.
+ *
+ ****************************************************************************/
+
+void
+EMAIL__BENCH_base64(
+    void
+    )
+{
+    /**
+     *  @param  src_p           The base64 text                             */
+    unsigned char           *   src_p;
+    /**
+     *  @param  dst_p           The decoded bytes                           */
+    unsigned char           *   dst_p;
+    /**
+     *  @param  check_p         The decoded bytes from the other decoder    */
+    unsigned char           *   check_p;
+    /**
+     *  @param  dst_l           Number of decoded bytes                     */
+    size_t                      dst_l;
+    /**
+     *  @param  check_l         Number of decoded bytes (other decoder)     */
+    size_t                      check_l;
+    /**
+     *  @param  ndx             Index into the base64 text                  */
+    size_t                      ndx;
+    /**
+     *  @param  pass            Pass number                                 */
+    int                         pass;
+    /**
+     *  @param  start           Start time                                  */
+    struct  timespec            start;
+    /**
+     *  @param  stop            Stop time                                   */
+    struct  timespec            stop;
+    /**
+     *  @param  seconds         Run time                                    */
+    double                      seconds;
+    /**
+     *  @param  digits          The base64 alphabet                         */
+    static
+    char                        digits[ ] =
+        "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+    //  Build the base64 text
+    src_p   = malloc( BENCH_B64_BYTES );
+    dst_p   = malloc( BENCH_B64_BYTES / 4 * 3 );
+    check_p = malloc( BENCH_B64_BYTES / 4 * 3 );
+
+    for ( ndx = 0; ndx < BENCH_B64_BYTES; ndx += 1 )
+    {
+        src_p[ ndx ] = digits[ ( ndx * 7 + ndx / 64 ) % 64 ];
+    }
+
+    log_write( MID_INFO, "EMAIL__BENCH",
+               "base64: %d MB encoded\n",
+               BENCH_B64_BYTES / ( 1024 * 1024 ) );
+    log_write( MID_INFO, "EMAIL__BENCH",
+               "DECODER         SECONDS     MB/SEC\n" );
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    //  SSE2 (when it is there)
+    clock_gettime( CLOCK_MONOTONIC, &start );
+    for ( pass = 0; pass < BENCH_B64_PASSES; pass += 1 )
+    {
+        dst_l = EMAIL__base64_decode( src_p, BENCH_B64_BYTES, dst_p );
+    }
+    clock_gettime( CLOCK_MONOTONIC, &stop );
+    seconds = (   (double)( stop.tv_sec  - start.tv_sec  )
+                + (double)( stop.tv_nsec - start.tv_nsec ) / 1000000000.0 );
+    log_write( MID_INFO, "EMAIL__BENCH",
+               "decode       %10.3f %10.1f\n", seconds,
+               BENCH_B64_PASSES * BENCH_B64_BYTES / ( 1024.0 * 1024.0 ) / seconds );
+
+    //  One group at a time
+    clock_gettime( CLOCK_MONOTONIC, &start );
+    for ( pass = 0; pass < BENCH_B64_PASSES; pass += 1 )
+    {
+        check_l = EMAIL__base64_scalar( src_p, BENCH_B64_BYTES, check_p );
+    }
+    clock_gettime( CLOCK_MONOTONIC, &stop );
+    seconds = (   (double)( stop.tv_sec  - start.tv_sec  )
+                + (double)( stop.tv_nsec - start.tv_nsec ) / 1000000000.0 );
+    log_write( MID_INFO, "EMAIL__BENCH",
+               "scalar       %10.3f %10.1f\n", seconds,
+               BENCH_B64_PASSES * BENCH_B64_BYTES / ( 1024.0 * 1024.0 ) / seconds );
+
+    //  Did they agree ?
+    if (    ( dst_l != check_l )
+         || ( memcmp( dst_p, check_p, dst_l ) != 0 ) )
+    {
+        //  NO:     That's a bug
+        log_write( MID_WARNING, "EMAIL__BENCH",
+                   "The base64 decoders do not agree\n" );
+    }
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  Clean up
+    free( check_p );
+    free( dst_p );
+    free( src_p );
+
+    //  DONE!
+}
+/****************************************************************************/
@@ -0,0 +1,491 @@
+/*******************************  COPYRIGHT  ********************************/
+/**
+ *  Author? "Gregory N. Leonhardt"
+ *  License? "CC BY-NC 2.0"
+ *           "https://creativecommons.org/licenses/by-nc/2.0/"
+ *
+ ****************************************************************************/
+
+/******************************** JAVADOC ***********************************/
+/**
+ *  This file contains the unit tests for the internal library components
+ *  of the 'email' library.
+ *
+ *  @note
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ *  Compiler directives
+ ****************************************************************************/
+
+
+/****************************************************************************
+ * System Function API
+ ****************************************************************************/
+
+                                //*******************************************
+#include <stdint.h>             //  Alternative storage types
+#include <stdbool.h>            //  TRUE, FALSE, etc.
+#include <stdio.h>              //  Standard I/O definitions
+                                //*******************************************
+#include <string.h>             //  Functions for managing strings
+                                //*******************************************
+
+/****************************************************************************
+ * Application APIs
+ ****************************************************************************/
+
+                                //*******************************************
+#include "global.h"             //  Global stuff for this application
+#include "libtools_api.h"       //  My Tools Library
+                                //*******************************************
+#include "tcb_api.h"            //  API for all tcb_*               PUBLIC
+#include "rcb_api.h"            //  API for all rcb_*               PUBLIC
+                                //*******************************************
+#include "email_api.h"          //  API for all email_*             PUBLIC
+#include "../email_lib.h"       //  API for all EMAIL__*            PRIVATE
+                                //*******************************************
+
+/****************************************************************************
+ * Enumerations local to this file
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Definitions local to this file
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+/**
+ *  @param  TEST_OUT_MAX        Most lines one message test can record      */
+#define TEST_OUT_MAX            (   64 )
+/**
+ *  @param  TEST_LINE_L         Longest line a message test can record      */
+#define TEST_LINE_L             (  128 )
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Structures local to this file
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+/**
+ *  @param  test_b64_t          One known answer for the base64 decoder     */
+struct  test_b64_t
+{
+    /**
+     *  @param  encoded_p       The base64 text                             */
+    char                        *   encoded_p;
+    /**
+     *  @param  decoded_p       What it decodes to                          */
+    char                        *   decoded_p;
+    /**
+     *  @param  decoded_l       Number of decoded bytes                     */
+    size_t                          decoded_l;
+};
+//----------------------------------------------------------------------------
+/**
+ *  Known answers: RFC 4648 section 10, the same without the padding,
+ *  every base64 digit, padding inside (and after) a sixteen character
+ *  block, and a bad character.                                         */
+static
+struct  test_b64_t              TEST_b64[ ] =
+{
+    {   "",                 "",             0   },
+    {   "Zg==",             "f",            1   },
+    {   "Zm8=",             "fo",           2   },
+    {   "Zm9v",             "foo",          3   },
+    {   "Zm9vYg==",         "foob",         4   },
+    {   "Zm9vYmE=",         "fooba",        5   },
+    {   "Zm9vYmFy",         "foobar",       6   },
+    {   "Zg",               "f",            1   },
+    {   "Zm8",              "fo",           2   },
+    {   "Zm9vYg",           "foob",         4   },
+    {   "+/+/++++",         "\xFB\xFF\xBF\xFB\xEF\xBE",     6   },
+    {   "MDEyMzQ1Njc4OQ==", "0123456789",   10  },
+    {   "VGhlIHF1aWNrIGJyb3duIGZveCBqdW1wcyBvdmVyIHRoZSBsYXp5IGRvZw==",
+        "The quick brown fox jumps over the lazy dog",                 43  },
+    {   "YWJjZGVmZ2hpamtsbW5vcHFyc3R1dnd4eXpBQkNERUZHSElKS0xNTk9QUVJTVFVW",
+        "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUV",            48  },
+    {   "Zm9v*mFy",         "foo",          3   },
+    {   NULL,               NULL,           0   }
+};
+//----------------------------------------------------------------------------
+/**
+ *  A multipart message.  The first part is base64 text wrapped in the
+ *  middle of a group.  The second part is plain text with a line that
+ *  starts with "--" but is not the boundary, followed by lines that
+ *  would look like the headers of a base64 part.                       */
+static
+char                        *   TEST_message[ ] =
+{
+    "From someone@example.com  Mon Jan  1 00:00:00 2024",
+    "Content-Type: multipart/mixed;",
+    "\tboundary=\"b1\"",
+    "",
+    "-- ",
+    "--b1",
+    "Content-Type: text/plain",
+    "Content-Transfer-Encoding: base64",
+    "",
+    "TGluZSBvbmUNCkx",
+    "  pbmUgdHdvDQo=  ",
+    "--b1",
+    "Content-Type: text/plain",
+    "",
+    "-----",
+    "Content-Transfer-Encoding: base64",
+    "",
+    "Zm9vYmFy",
+    "--b1--",
+    NULL
+};
+/**
+ *  The lines email_rcb( ) gets to see for TEST_message.                */
+static
+char                        *   TEST_expect[ ] =
+{
+    "From someone@example.com  Mon Jan  1 00:00:00 2024",
+    "Content-Type: multipart/mixed;",
+    "\tboundary=\"b1\"",
+    "",
+    "-- ",
+    "--b1",
+    "Content-Type: text/plain",
+    "Content-Transfer-Encoding: base64",
+    "",
+    "Line one",
+    "Line two",
+    "--b1",
+    "Content-Type: text/plain",
+    "",
+    "-----",
+    "Content-Transfer-Encoding: base64",
+    "",
+    "Zm9vYmFy",
+    "--b1--",
+    NULL
+};
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Storage Allocation local to this file
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+/**
+ *  @param  TEST_out            The lines passed on, in order               */
+static
+char                            TEST_out[ TEST_OUT_MAX ][ TEST_LINE_L ];
+/**
+ *  @param  TEST_out_count      Number of lines passed on                   */
+static
+int                             TEST_out_count;
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * LIB Functions
+ ****************************************************************************/
+
+/****************************************************************************/
+/**
+ *  Unit tests for EMAIL__base64_decode( ) and EMAIL__base64_scalar( )
+ *
+ *  @param  void                No parameters are passed into this function.
+ *
+ *  @return email_rc            TRUE if all test pass, else FALSE
+ *
+ *  @note
+ *
+ ****************************************************************************/
+
+int
+EMAIL__TEST_base64(
+    void
+    )
+{
+    /**
+     *  @param  email_rc        Return code from this function              */
+    int                         email_rc;
+    /**
+     *  @param  decoded         The decoded bytes                           */
+    unsigned char               decoded[ TEST_LINE_L ];
+    /**
+     *  @param  decoded_l       Number of decoded bytes                     */
+    size_t                      decoded_l;
+    /**
+     *  @param  scalar          TRUE = testing the scalar decoder           */
+    int                         scalar;
+    /**
+     *  @param  ndx             Index to array                              */
+    int                         ndx;
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+    //  Initialize variables
+    email_rc = true;
+
+    /************************************************************************
+     *  Function Code
+     ************************************************************************/
+
+    for( ndx = 0;
+         TEST_b64[ ndx ].encoded_p != NULL;
+         ndx += 1 )
+    {
+        for( scalar = false;
+             scalar <= true;
+             scalar += 1 )
+        {
+            memset( decoded, '\0', sizeof( decoded ) );
+
+            //  Decode it
+            if ( scalar == true )
+            {
+                decoded_l = EMAIL__base64_scalar(
+                                (unsigned char *)TEST_b64[ ndx ].encoded_p,
+                                strlen( TEST_b64[ ndx ].encoded_p ), decoded );
+            }
+            else
+            {
+                decoded_l = EMAIL__base64_decode(
+                                (unsigned char *)TEST_b64[ ndx ].encoded_p,
+                                strlen( TEST_b64[ ndx ].encoded_p ), decoded );
+            }
+
+            //  Is it the known answer ?
+            if (    ( decoded_l != TEST_b64[ ndx ].decoded_l )
+                 || ( memcmp( decoded, TEST_b64[ ndx ].decoded_p,
+                              decoded_l ) != 0 ) )
+            {
+                //  ERROR:  Write a message
+                log_write( MID_INFO, "EMAIL__TEST",
+                           "ERROR: B-%02d '%s' %s: %zu bytes '%s' "
+                           "Expected: %zu bytes '%s'\n",
+                           ndx, TEST_b64[ ndx ].encoded_p,
+                           ( scalar == true ) ? "scalar" : "decode",
+                           decoded_l, decoded,
+                           TEST_b64[ ndx ].decoded_l,
+                           TEST_b64[ ndx ].decoded_p );
+
+                //  Set a failed return code
+                email_rc = false;
+            }
+        }
+    }
+
+    /************************************************************************
+     *  Completion Message
+     ************************************************************************/
+
+    //  PASS or FAIL ?
+    if ( email_rc == true )
+    {
+        //  Completion message
+        log_write( MID_INFO, "EMAIL__TEST", "base64 decode\t\t\tPASS\n" );
+    }
+    else
+    {
+        //  Completion message
+        log_write( MID_INFO, "EMAIL__TEST", "base64 decode\t\t\tFAIL\n" );
+    }
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+    return ( email_rc );
+}
+
+/****************************************************************************/
+/**
+ *  Pass one line through EMAIL__base64( ) the way email_rcb( ) does.
+ *
+ *  @param  ctx_p               Pointer to the e-Mail parse context
+ *  @param  rcb_p               Pointer to the file's Recipe Control Block
+ *  @param  line_p              The line (it is released here)
+ *
+ *  @return void                No information is returned
+ *
+ *  @note
+ *      A line that is not taken is recorded in TEST_out.  Then the lines
+ *      that are waiting are passed through, as EMAIL__next_line( ) would.
+ *
+ ****************************************************************************/
+
+static
+void
+EMAIL__TEST_line(
+    struct  email_ctx_t     *   ctx_p,
+    struct  rcb_t           *   rcb_p,
+    char                    *   line_p
+    )
+{
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    do
+    {
+        //  Was the line taken ?
+        if ( EMAIL__base64( NULL, rcb_p, ctx_p, line_p ) == false )
+        {
+            //  NO:     Record it
+            if ( TEST_out_count < TEST_OUT_MAX )
+            {
+                snprintf( TEST_out[ TEST_out_count ], TEST_LINE_L,
+                          "%s", line_p );
+            }
+            TEST_out_count += 1;
+
+            mem_free( line_p );
+        }
+
+        //  Is anything waiting ?
+        line_p = list_get_first( ctx_p->pending_p );
+        ctx_p->decoded_line = false;
+
+        if ( line_p != NULL )
+        {
+            //  YES:    Take it off the list
+            list_delete_payload( ctx_p->pending_p, line_p );
+
+            //  Was it decoded from base64 ?
+            if ( ctx_p->pending_decoded > 0 )
+            {
+                //  YES:    Don't look at it again
+                ctx_p->pending_decoded -= 1;
+                ctx_p->decoded_line     = true;
+            }
+        }
+    }   while( line_p != NULL );
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+}
+
+/****************************************************************************/
+/**
+ *  Unit tests for EMAIL__base64( )
+ *
+ *  @param  void                No parameters are passed into this function.
+ *
+ *  @return email_rc            TRUE if all test pass, else FALSE
+ *
+ *  @note
+ *      Only a line that is "--" and the boundary starts a MIME part, and
+ *      a body wrapped in the middle of a group decodes as one.
+ *
+ ****************************************************************************/
+
+int
+EMAIL__TEST_base64_part(
+    void
+    )
+{
+    /**
+     *  @param  email_rc        Return code from this function              */
+    int                         email_rc;
+    /**
+     *  @param  ctx             The e-Mail parse context                    */
+    struct  email_ctx_t         ctx;
+    /**
+     *  @param  rcb             The file's Recipe Control Block             */
+    struct  rcb_t               rcb;
+    /**
+     *  @param  ndx             Index to array                              */
+    int                         ndx;
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+    //  Initialize variables
+    email_rc       = true;
+    TEST_out_count = 0;
+
+    //  A new file, the way email_rcb( ) starts one
+    memset( &ctx, 0x00, sizeof( ctx ) );
+    ctx.b64_header = true;
+    ctx.pending_p  = list_new( );
+
+    //  Not a mapped file, so the lines are released
+    memset( &rcb, 0x00, sizeof( rcb ) );
+
+    /************************************************************************
+     *  Function Code
+     ************************************************************************/
+
+    //  Pass the message through
+    for( ndx = 0;
+         TEST_message[ ndx ] != NULL;
+         ndx += 1 )
+    {
+        EMAIL__TEST_line( &ctx, &rcb, text_copy_to_new( TEST_message[ ndx ] ) );
+    }
+
+    //  Are the lines the expected ones ?
+    for( ndx = 0;
+         ( TEST_expect[ ndx ] != NULL ) || ( ndx < TEST_out_count );
+         ndx += 1 )
+    {
+        if (    ( TEST_expect[ ndx ] == NULL )
+             || ( ndx >= TEST_out_count )
+             || ( strcmp( TEST_out[ ndx ], TEST_expect[ ndx ] ) != 0 ) )
+        {
+            //  ERROR:  Write a message
+            log_write( MID_INFO, "EMAIL__TEST",
+                       "ERROR: L-%02d '%s' Expected: '%s'\n",
+                       ndx,
+                       ( ndx < TEST_out_count ) ? TEST_out[ ndx ] : "",
+                       ( TEST_expect[ ndx ] != NULL ) ? TEST_expect[ ndx ] : "" );
+
+            //  Set a failed return code
+            email_rc = false;
+
+            //  Stop testing
+            break;
+        }
+    }
+
+    /************************************************************************
+     *  Completion Message
+     ************************************************************************/
+
+    //  PASS or FAIL ?
+    if ( email_rc == true )
+    {
+        //  Completion message
+        log_write( MID_INFO, "EMAIL__TEST", "base64 MIME parts\t\tPASS\n" );
+    }
+    else
+    {
+        //  Completion message
+        log_write( MID_INFO, "EMAIL__TEST", "base64 MIME parts\t\tFAIL\n" );
+    }
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  Clean up
+    if ( ctx.b64_p != NULL )
+    {
+        mem_free( ctx.b64_p );
+    }
+    list_kill( ctx.pending_p );
+
+    //  DONE!
+    return ( email_rc );
+}
+/****************************************************************************/
@@ -47,6 +47,7 @@
 #include "tcb_api.h"            //  API for all tcb_*               PUBLIC
 #include "rcb_api.h"            //  API for all rcb_*               PUBLIC
 #include "dbase_api.h"          //  API for all dbase_*             PUBLIC
+#include "order_api.h"          //  API for all order_*             PUBLIC
                                 //*******************************************
 #include "encode_api.h"         //  API for all encode_*            PUBLIC
 #include "encode_lib.h"         //  API for all ENCODE__*           PRIVATE
@@ -208,6 +209,88 @@ encode_get_dir(
     return( NULL );
 }
 
+/****************************************************************************/
+/**
+ *  Encode a decoded recipe.
+ *
+ *  @param  tcb_p               Pointer to a Thread Control Block
+ *  @param  void_p              Pointer to a Recipe Control Block
+ *
+ *  @return void                No information is returned
+ *
+ *  @note
+ *      The recipe is passed on to the EXPORT thread group when there is an
+ *      output directory, otherwise it is inserted into the database.  Either
+ *      way it goes through the reorder buffer first (see order_release).
+ *
+ ****************************************************************************/
+
+void
+encode_rcb(
+    struct  tcb_t           *   tcb_p,
+    void                    *   void_p
+    )
+{
+    /**
+     *  @param  rcb_p           Pointer to a Recipe Control Block           */
+    struct  rcb_t           *   rcb_p;
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+    //  Set the pointer
+    rcb_p = void_p;
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+#if ! STUB
+
+    /********************************************************************
+     *  Use one of the following encoders
+     ********************************************************************/
+
+    //  Did we get a new recipe to encode ?
+    if ( rcb_p->recipe_p != NULL )
+    {
+        //  YES:    Are we encoding to a file ?
+        if ( out_dir_name_p != NULL )
+        {
+            //  YES:    Go encode it.
+//              encode_mmf( rcb_p );    //  @ToDo: 5 mmf encode
+//              encode_mx2( rcb_p );    //  @ToDo: 5 mx2 encode
+//              encode_mxp( rcb_p );    //  @ToDo: 5 mxp encode
+//              encode_rxf( rcb_p );    //  @ToDo: 5 rxf encode
+//              encode_ria( rcb_p );    //  @ToDo: 5 ria encode
+//              encode_txt( rcb_p );    //  @ToDo: 5 ria encode
+            encode_xml( rcb_p );    //  XML export format
+        }
+
+        //  Send it on (in order when strict ordering is active)
+        order_release( rcb_p, ENCODE__release );
+    }
+    else
+    {
+        //  NO:     Kill the Recipe Control Block
+        rcb_kill( rcb_p );
+    }
+
+#else
+
+    //  Kill the Recipe Control Block
+    rcb_kill( rcb_p );
+
+#endif
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+}
+
 /****************************************************************************/
 /**
  *  Initialize the Translations tables.
@@ -232,6 +315,15 @@ encode(
     /**
      *  @param  rcb_p           Pointer to a Recipe Control Block           */
     struct  rcb_t           *   rcb_p;
+    /**
+     *  @param  rcb_list        Batch of Recipe Control Blocks              */
+    void                    *   rcb_list[ TCB_BATCH_MAX ];
+    /**
+     *  @param  rcb_count       Number of RCBs in the batch                 */
+    int                         rcb_count;
+    /**
+     *  @param  ndx             Index into the batch                        */
+    int                         ndx;
 
     /************************************************************************
      *  Function Initialization
@@ -245,7 +337,7 @@ encode(
                "Initialization complete.\n" );
 
     //  Change execution state to "WAIT"ing for work.
-    tcb_p->thread_state = TS_WAIT;
+    tcb_set_state( tcb_p, TS_WAIT );
 
     /************************************************************************
      *  Function Body
@@ -258,63 +350,34 @@ encode(
          *  Get a new file to import
          ********************************************************************/
 
-        //  Get the current File-ID.
-        rcb_p = queue_get_payload( tcb_p->queue_id );
-
-        //  This thread is now the owner of the RCB
-        rcb_p->tcb_p = tcb_p;
-
-        //  Progress report.
-        log_write( MID_LOGONLY, tcb_p->thread_name,
-                   "FILE-ID: %s\n",
-                   rcb_p->file_path );
-
-#if ! STUB
+        //  Get everything that is waiting (up to a full batch).
+        rcb_count = tcb_queue_get_batch( tcb_p, rcb_list, TCB_BATCH_MAX );
 
         //  Change execution state to "INITIALIZED" for work.
-        tcb_p->thread_state = TS_WORKING;
+        tcb_set_state( tcb_p, TS_WORKING );
 
-        /********************************************************************
-         *  Use one of the following encoders
-         ********************************************************************/
-
-        //  Did we get a new recipe to encode ?
-        if ( rcb_p->recipe_p != NULL )
+        //  Process the batch
+        for ( ndx = 0;
+              ndx < rcb_count;
+              ndx += 1 )
         {
-            //  YES:    Are we encoding to a file ?
-            if ( out_dir_name_p != NULL )
-            {
-                //  YES:    Go encode it.
-//              encode_mmf( rcb_p );    //  @ToDo: 5 mmf encode
-//              encode_mx2( rcb_p );    //  @ToDo: 5 mx2 encode
-//              encode_mxp( rcb_p );    //  @ToDo: 5 mxp encode
-//              encode_rxf( rcb_p );    //  @ToDo: 5 rxf encode
-//              encode_ria( rcb_p );    //  @ToDo: 5 ria encode
-//              encode_txt( rcb_p );    //  @ToDo: 5 ria encode
-                encode_xml( rcb_p );    //  XML export format
-
-                //  Put it in one of the DECODE queues
-                queue_put_payload( export_tcb->queue_id, rcb_p  );
-            }
-            else
-            {
-                //  NO:     I guess we are exporting to the dBase
-                dbase_insert( rcb_p );
-
-                //  Kill the Recipe Control Block
-                rcb_kill( rcb_p );
-            }
-        }
+            //  Get the current File-ID.
+            rcb_p = rcb_list[ ndx ];
 
-#else
+            //  This thread is now the owner of the RCB
+            rcb_p->tcb_p = tcb_p;
 
-        //  Kill the Recipe Control Block
-        rcb_kill( rcb_p );
+            //  Progress report.
+            log_write( MID_LOGONLY, tcb_p->thread_name,
+                       "FILE-ID: %s\n",
+                       rcb_p->file_path );
 
-#endif
+            //  Process the payload
+            encode_rcb( tcb_p, rcb_p );
+        }
 
         //  Change execution state to "INITIALIZED" for work.
-        tcb_p->thread_state = TS_WAIT;
+        tcb_set_state( tcb_p, TS_WAIT );
     }
 
     /************************************************************************
@@ -41,6 +41,7 @@
                                 //*******************************************
 #include "tcb_api.h"            //  API for all tcb_*               PUBLIC
 #include "rcb_api.h"            //  API for all rcb_*               PUBLIC
+#include "dbase_api.h"          //  API for all dbase_*             PUBLIC
                                 //*******************************************
 #include "encode_api.h"         //  API for all encode_*            PUBLIC
 #include "encode_lib.h"         //  API for all ENCODE__*           PRIVATE
@@ -78,4 +79,54 @@
  * LIB Functions
  ****************************************************************************/
 
-/****************************************************************************/
\ No newline at end of file
+/****************************************************************************/
+/**
+ *  Output one finished recipe.
+ *
+ *  @param  rcb_p               Pointer to a Recipe Control Block
+ *
+ *  @return void                No information is returned
+ *
+ *  @note
+ *      With an output directory the recipe goes to the EXPORT thread group,
+ *      otherwise it is inserted into the database.
+ *
+ ****************************************************************************/
+
+void
+ENCODE__release(
+    struct  rcb_t           *   rcb_p
+    )
+{
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    //  Are we encoding to a file ?
+    if ( out_dir_name_p != NULL )
+    {
+        //  YES:    Put it in one of the EXPORT queues
+        tcb_queue_put( export_tcb, rcb_p );
+    }
+    else
+    {
+        //  NO:     I guess we are exporting to the dBase
+        dbase_insert( rcb_p );
+
+        //  Kill the Recipe Control Block
+        rcb_kill( rcb_p );
+    }
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+}
+/****************************************************************************/
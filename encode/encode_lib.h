@@ -77,6 +77,10 @@ int                             encode_lib;
  ****************************************************************************/
 
 //----------------------------------------------------------------------------
+void
+ENCODE__release(
+    struct  rcb_t           *   rcb_p
+    );
 //----------------------------------------------------------------------------
 
 /****************************************************************************/
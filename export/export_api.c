@@ -89,25 +89,23 @@
 
 /****************************************************************************/
 /**
- *  Initialize the Translations tables.
+ *  Write an encoded recipe to the output directory.
  *
- *  @param  void                No parameters are passed in.
+ *  @param  tcb_p               Pointer to a Thread Control Block
+ *  @param  void_p              Pointer to a Recipe Control Block
  *
- *  @return void                Upon successful completion TRUE is returned
- *                              else FALSE is returned.
+ *  @return void                No information is returned
  *
  *  @note
  *
  ****************************************************************************/
 
 void
-export(
+export_rcb(
+    struct  tcb_t           *   tcb_p,
     void                    *   void_p
     )
 {
-    /**
-     *  @param  tcb_p           Pointer to a Thread Control Block           */
-    struct  tcb_t           *   tcb_p;
     /**
      *  @param  rcb_p           Pointer to a Recipe Control Block           */
     struct  rcb_t           *   rcb_p;
@@ -129,6 +127,130 @@ export(
     int                         list_lock_key;
 #endif
 
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+    //  Set the pointer
+    rcb_p = void_p;
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+#if ! STUB
+
+    /********************************************************************
+     *  Open the output file
+     ********************************************************************/
+
+    //  Build the subdirectory name
+    snprintf( subdirectory, sizeof( subdirectory ),
+              "%s", rcb_p->recipe_p->recipe_id_p );
+
+    //  Start building the output name
+    snprintf( out_name, sizeof( out_name ),
+              "%s", out_dir_name_p );
+
+    //  If the directory does not already exist, create it.
+    file_dir_exist( out_name, true );
+
+    //  Append DIR_FORMATTED to the output name
+    snprintf( out_name, sizeof( out_name ),
+              "%s/%s", out_dir_name_p, DIR_FORMATTED );
+
+    //  If the directory does not already exist, create it.
+    file_dir_exist( out_name, true );
+
+    //  Append the subdirectory to the output name
+    snprintf( out_name, sizeof( out_name ),
+              "%s/%s/%s", out_dir_name_p, DIR_FORMATTED, subdirectory );
+
+    //  If the directory does not already exist, create it.
+    file_dir_exist( out_name, true );
+
+    //  Append the file name to the output name
+    snprintf( out_name, sizeof( out_name ),
+              "%s/%s/%s/%s.txt", out_dir_name_p, DIR_FORMATTED,
+              subdirectory, rcb_p->recipe_p->recipe_id_p );
+
+    //  Is this a recipe with no instructions ?
+    if ( strncmp( rcb_p->recipe_p->recipe_id_p, "000000000000000000000000000000", 30 ) == 0 )
+    {
+        //  YES:    Append to whatever is already there
+        out_file_fp = file_open_append( out_name );
+    }
+    else
+    {
+        //  NO:     Open a unique file for the output.
+        out_file_fp = file_open_write_no_dup( out_name, "duplicate_" );
+    }
+
+    /********************************************************************
+     *  Write the recipe file
+     ********************************************************************/
+
+    //  Lock the list for fast(er) access
+    list_lock_key = list_user_lock( rcb_p->export_list_p );
+
+    //  Scan the list
+    for( list_data_p = list_fget_first( rcb_p->export_list_p, list_lock_key );
+         list_data_p != NULL;
+         list_data_p = list_fget_next( rcb_p->export_list_p, list_data_p, list_lock_key ) )
+    {
+        //  Remove the data from the list
+        list_fdelete( rcb_p->export_list_p, list_data_p, list_lock_key );
+
+        //  Write the line of text to the output file
+        fprintf( out_file_fp, "%s", list_data_p );
+
+        //  Free the data buffer
+        mem_free( list_data_p );
+    }
+
+    //  Close the output file.
+    file_close( out_file_fp );
+
+    //  Release the lock on the level 3 list
+    list_user_unlock( rcb_p->export_list_p, list_lock_key );
+
+#endif
+
+    //  Kill the Recipe Control Block
+    rcb_kill( rcb_p );
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+}
+
+/****************************************************************************/
+/**
+ *  Initialize the Translations tables.
+ *
+ *  @param  void                No parameters are passed in.
+ *
+ *  @return void                Upon successful completion TRUE is returned
+ *                              else FALSE is returned.
+ *
+ *  @note
+ *
+ ****************************************************************************/
+
+void
+export(
+    void                    *   void_p
+    )
+{
+    /**
+     *  @param  tcb_p           Pointer to a Thread Control Block           */
+    struct  tcb_t           *   tcb_p;
+    /**
+     *  @param  rcb_p           Pointer to a Recipe Control Block           */
+    struct  rcb_t           *   rcb_p;
+
     /************************************************************************
      *  Function Initialization
      ************************************************************************/
@@ -141,7 +263,7 @@ export(
                "Initialization complete.\n" );
 
     //  Change execution state to "WAIT"ing for work.
-    tcb_p->thread_state = TS_WAIT;
+    tcb_set_state( tcb_p, TS_WAIT );
 
     /************************************************************************
      *  Function Body
@@ -155,7 +277,7 @@ export(
          ********************************************************************/
 
         //  Get the current File-ID.
-        rcb_p = queue_get_payload( tcb_p->queue_id );
+        rcb_p = tcb_queue_get( tcb_p );
 
         //  This thread is now the owner of the RCB
         rcb_p->tcb_p = tcb_p;
@@ -172,91 +294,13 @@ export(
                    rcb_p->recipe_p->name_p );
 
         //  Change execution state to "INITIALIZED" for work.
-        tcb_p->thread_state = TS_WORKING;
-
-#if ! STUB
-
-        /********************************************************************
-         *  Open the output file
-         ********************************************************************/
-
-        //  Build the subdirectory name
-        snprintf( subdirectory, sizeof( subdirectory ),
-                  "%s", rcb_p->recipe_p->recipe_id_p );
-
-        //  Start building the output name
-        snprintf( out_name, sizeof( out_name ),
-                  "%s", out_dir_name_p );
-
-        //  If the directory does not already exist, create it.
-        file_dir_exist( out_name, true );
-
-        //  Append DIR_FORMATTED to the output name
-        snprintf( out_name, sizeof( out_name ),
-                  "%s/%s", out_dir_name_p, DIR_FORMATTED );
-
-        //  If the directory does not already exist, create it.
-        file_dir_exist( out_name, true );
-
-        //  Append the subdirectory to the output name
-        snprintf( out_name, sizeof( out_name ),
-                  "%s/%s/%s", out_dir_name_p, DIR_FORMATTED, subdirectory );
-
-        //  If the directory does not already exist, create it.
-        file_dir_exist( out_name, true );
-
-        //  Append the file name to the output name
-        snprintf( out_name, sizeof( out_name ),
-                  "%s/%s/%s/%s.txt", out_dir_name_p, DIR_FORMATTED,
-                  subdirectory, rcb_p->recipe_p->recipe_id_p );
-
-        //  Is this a recipe with no instructions ?
-        if ( strncmp( rcb_p->recipe_p->recipe_id_p, "000000000000000000000000000000", 30 ) == 0 )
-        {
-            //  YES:    Append to whatever is already there
-            out_file_fp = file_open_append( out_name );
-        }
-        else
-        {
-            //  NO:     Open a unique file for the output.
-            out_file_fp = file_open_write_no_dup( out_name, "duplicate_" );
-        }
-
-        /********************************************************************
-         *  Write the recipe file
-         ********************************************************************/
-
-        //  Lock the list for fast(er) access
-        list_lock_key = list_user_lock( rcb_p->export_list_p );
-
-        //  Scan the list
-        for( list_data_p = list_fget_first( rcb_p->export_list_p, list_lock_key );
-             list_data_p != NULL;
-             list_data_p = list_fget_next( rcb_p->export_list_p, list_data_p, list_lock_key ) )
-        {
-            //  Remove the data from the list
-            list_fdelete( rcb_p->export_list_p, list_data_p, list_lock_key );
-
-            //  Write the line of text to the output file
-            fprintf( out_file_fp, "%s", list_data_p );
-
-            //  Free the data buffer
-            mem_free( list_data_p );
-        }
-
-        //  Close the output file.
-        file_close( out_file_fp );
-
-        //  Release the lock on the level 3 list
-        list_user_unlock( rcb_p->export_list_p, list_lock_key );
-
-#endif
+        tcb_set_state( tcb_p, TS_WORKING );
 
-        //  Kill the Recipe Control Block
-        rcb_kill( rcb_p );
+        //  Process the payload
+        export_rcb( tcb_p, rcb_p );
 
         //  Change execution state to "INITIALIZED" for work.
-        tcb_p->thread_state = TS_WAIT;
+        tcb_set_state( tcb_p, TS_WAIT );
     }
 
     /************************************************************************
@@ -34,6 +34,8 @@
                                 //*******************************************
 #include <string.h>             //  Functions for managing strings
 #include <unistd.h>             //  UNIX standard library.
+#include <sys/mman.h>           //  munmap( )
+#include <pthread.h>            //  POSIX threads
                                 //*******************************************
 
 /****************************************************************************
@@ -46,7 +48,11 @@
                                 //*******************************************
 #include "tcb_api.h"            //  API for all tcb_*               PUBLIC
 #include "rcb_api.h"            //  API for all rcb_*               PUBLIC
+#include "prefetch_api.h"       //  API for all prefetch_*          PUBLIC
+#include "recipe_api.h"         //  API for all recipe_*            PUBLIC
+#include "manifest_api.h"       //  API for all manifest_*          PUBLIC
                                 //*******************************************
+#include "archive_api.h"        //  API for all archive_*           PUBLIC
 #include "import_api.h"         //  API for all import_*            PUBLIC
 #include "import_lib.h"         //  API for all IMPORT__*           PRIVATE
                                 //*******************************************
@@ -77,6 +83,18 @@
  ****************************************************************************/
 
 //----------------------------------------------------------------------------
+/**
+ *  @param  stream_mutex        Protects the streaming byte count           */
+static
+pthread_mutex_t                 stream_mutex = PTHREAD_MUTEX_INITIALIZER;
+/**
+ *  @param  stream_cond         Signaled when EMAIL finishes a chunk        */
+static
+pthread_cond_t                  stream_cond  = PTHREAD_COND_INITIALIZER;
+/**
+ *  @param  stream_bytes        Bytes of streamed chunks in the pipeline    */
+static
+size_t                          stream_bytes;
 //----------------------------------------------------------------------------
 
 /****************************************************************************
@@ -85,24 +103,27 @@
 
 /****************************************************************************/
 /**
- *  Initialize the Translations tables.
+ *  Read an input file into the import list of a Recipe Control Block.
  *
- *  @param  tcb_p               Pointer to a thread control block
+ *  @param  tcb_p               Pointer to a Thread Control Block
+ *  @param  void_p              Pointer to a Recipe Control Block
  *
- *  @return void                No information is returned from this function.
+ *  @return void                No information is returned
  *
  *  @note
+ *      The RCB is passed on to the EMAIL thread group when the file was read.
+ *      A text file with the same content as one that was already imported
+ *      (a copy under another name) is dropped before it gets to EMAIL.
+ *      Streamed files and archive members are not checked.
  *
  ****************************************************************************/
 
 void
-import(
+import_rcb(
+    struct  tcb_t           *   tcb_p,
     void                    *   void_p
     )
 {
-    /**
-     *  @param  tcb_p           Pointer to a Thread Control Block           */
-    struct  tcb_t           *   tcb_p;
     /**
      *  @param  rcb_p           Pointer to a Recipe Control Block           */
     struct  rcb_t           *   rcb_p;
@@ -118,59 +139,108 @@ import(
     /**
      *  @param  file_info_p     Pointer to file information             */
     struct  file_info_t     *   file_info_p;
+    /**
+     *  @param  sniff           What the first block of the file looks like */
+    enum    import_sniff_e      sniff;
+    /**
+     *  @param  content_hash    Whole file content hash                     */
+    struct  import_hash_t       content_hash;
+    /**
+     *  @param  recipe_text     The file has the text of a recipe marker    */
+    int                         recipe_text;
+    /**
+     *  @param  manifest_p      Manifest entry to confirm once it is read   */
+    struct  manifest_entry_t *  manifest_p;
 
     /************************************************************************
      *  Function Initialization
      ************************************************************************/
 
     //  Set the pointer
-    tcb_p = void_p;
+    rcb_p = void_p;
 
-    //  Progress report.
-    log_write( MID_INFO, tcb_p->thread_name,
-               "Initialization complete.\n" );
-
-    //  Change execution state to "WAIT"ing for work.
-    tcb_p->thread_state = TS_WAIT;
+    //  The RCB may be gone by the time the file is read
+    manifest_p = rcb_p->manifest_p;
 
     /************************************************************************
      *  Function Body
      ************************************************************************/
 
-    while ( 1 )
+    //  Was the file read ahead ?
+    if ( rcb_p->prefetched == true )
     {
+        //  YES:    Let the next one start
+        prefetch_done( );
+    }
 
-        /********************************************************************
-         *  Get a new file to import
-         ********************************************************************/
+    //  Build the full path/file name
+    snprintf( file_name, sizeof( file_name ),
+              "%s/%s",
+              rcb_p->file_info_p->dir_name,
+              rcb_p->file_info_p->file_name );
 
-        //  Get the current File-ID.
-        rcb_p = queue_get_payload( tcb_p->queue_id );
+    //  Verify the file exists
+    file_info_p = file_stat( file_name, NULL );
 
-        //  This thread is now the owner of the RCB
-        rcb_p->tcb_p = tcb_p;
+    //  Does it exist ?
+    if ( file_info_p != NULL )
+    {
+        //  YES:    Release storage
+        mem_free( file_info_p );
 
-        //  Progress report.
-        log_write( MID_INFO, tcb_p->thread_name,
-                   "FILE-ID: %s\n",
-                   rcb_p->file_path );
+        //  Look at the first block before reading any further
+        sniff = IMPORT__sniff( file_name );
+    }
+    else
+    {
+        //  NO:     Nothing to look at
+        sniff = IMPORT_SNIFF_MISSING;
+    }
 
-        //  Change execution state to "INITIALIZED" for work.
-        tcb_p->thread_state = TS_WORKING;
+    //  Count it
+    __atomic_add_fetch( &import_sniff_count[ sniff ], 1, __ATOMIC_RELAXED );
+
+    //  Is it a text file in a streaming run ?
+    if (    ( sniff                == IMPORT_SNIFF_TEXT )
+         && ( import_stream_budget != 0                 ) )
+    {
+        //  YES:    Read and send the file one chunk at a time
+        IMPORT__stream( rcb_p, file_name );
 
-        //  Build the full path/file name
-        snprintf( file_name, sizeof( file_name ),
-                  "%s/%s",
-                  rcb_p->file_info_p->dir_name,
-                  rcb_p->file_info_p->file_name );
+        //  The whole file was read
+        manifest_imported( manifest_p );
+    }
+    else
+    //  Is it a text file ?
+    if ( sniff == IMPORT_SNIFF_TEXT )
+    {
+        //  YES:    Hash the content as it is read
+        IMPORT__hash_init( &content_hash );
+        recipe_text = false;
 
-        //  Verify the file exists
-        file_info_p = file_stat( file_name, NULL );
+        //  Should the file be memory mapped ?
+        if ( import_mmap == true )
+        {
+            //  YES:    Map it and build the line index
+            rcb_p->import_map_p = IMPORT__map( file_name, &content_hash );
+        }
 
-        if ( file_info_p != NULL )
+        //  Is the file mapped ?
+        if ( rcb_p->import_map_p != NULL )
         {
-            //  Release storage
-            mem_free( file_info_p );
+            //  YES:    Nothing to read
+            log_write( MID_DEBUG_0, tcb_p->thread_name,
+                          "Mapped %d lines.\n",
+                          rcb_p->import_map_p->line_count );
+
+            //  Could it hold a recipe ?
+            recipe_text = recipe_scan( rcb_p->import_map_p->base_p,
+                                       rcb_p->import_map_p->map_l );
+        }
+        else
+        {
+            //  NO:     A mapping that failed may have hashed part of it
+            IMPORT__hash_init( &content_hash );
 
             //  Open the file for reading
             rcb_p->file_p = file_open_read( file_name );
@@ -189,26 +259,22 @@ import(
                 //  Was the read successful ?
                 if ( read_data_l != -1 )
                 {
-                    //  YES:    Remove CR/LF
-                    text_remove_crlf( read_data_p );
+                    //  YES:    Hash the line as it is in the file
+                    IMPORT__hash_update( &content_hash,
+                                         (unsigned char *)read_data_p,
+                                         read_data_l );
 
-                    //  Is this a binary file ?
-                    if ( text_is_binary( read_data_p, read_data_l ) == true )
+                    //  Could it hold a recipe ?
+                    if ( recipe_text == false )
                     {
-                        //  YES:    Log the binary file
-                        log_write( MID_INFO, tcb_p->thread_name,
-                                   "Skipping binary file '%s'\n",
-                                   rcb_p->file_path );
-
-                        //  Done reading this file.
-                        read_data_l = -1;
-                        break;
-                    }
-                    else
-                    {
-                        //  NO:     Put the new line on the list
-                        list_put_last( rcb_p->import_list_p, read_data_p );
+                        recipe_text = recipe_scan( read_data_p, read_data_l );
                     }
+
+                    //  Remove CR/LF
+                    text_remove_crlf( read_data_p );
+
+                    //  Put the new line on the list
+                    list_put_last( rcb_p->import_list_p, read_data_p );
                 }
 
                 //  Keep reading until we reach the end-of-file
@@ -216,37 +282,630 @@ import(
 
             //  Close the import file
             file_close( rcb_p->file_p ); rcb_p->file_p = 0;
+        }
 
-            //  Is the delete flag set ?
-            if ( delete_flag == true )
-            {
-                //  YES:    Delete the file
-                unlink( file_name );
-            }
+        //  The whole file was read
+        manifest_imported( manifest_p );
+
+        //  Is the delete flag set ?
+        if ( delete_flag == true )
+        {
+            //  YES:    Delete the file
+            unlink( file_name );
+        }
+
+        //  Has the same content been imported already ?
+        if ( IMPORT__duplicate( rcb_p, &content_hash ) == true )
+        {
+            //  YES:    Nothing new to decode
+            rcb_kill( rcb_p );
+        }
+        else
+        //  Is there anything in it that could start a recipe ?
+        if ( recipe_text == false )
+        {
+            //  NO:     Don't bother splitting it into e-Mails
+            log_write( MID_DEBUG_0, tcb_p->thread_name,
+                          "No recipe markers in '%s'.\n", file_name );
+
+            __atomic_add_fetch( &import_scan_count, 1, __ATOMIC_RELAXED );
+            __atomic_add_fetch( &import_scan_skip,  1, __ATOMIC_RELAXED );
+            rcb_kill( rcb_p );
+        }
+        else
+        {
+            //  YES:    Count it
+            __atomic_add_fetch( &import_scan_count, 1, __ATOMIC_RELAXED );
 
 #if DEBUG_STUB
-        rcb_kill( rcb_p );
+            rcb_kill( rcb_p );
 #else
-        //  Put it in one of the IMPORT queue's
-        queue_put_payload( email_tcb->queue_id, rcb_p  );
+            //  Is it a big mailbox that can be split between the EMAIL threads ?
+            if ( IMPORT__split( rcb_p ) == false )
+            {
+                //  NO:     Put it in one of the IMPORT queue's
+                tcb_queue_put( email_tcb, rcb_p );
+            }
 #endif
         }
-        else
+    }
+    else
+    //  Is it an archive that can be read in place ?
+    if (    ( sniff                             == IMPORT_SNIFF_ARCHIVE )
+         && ( IMPORT__archive( rcb_p, file_name ) == true                 ) )
+    {
+        //  YES:    Every text member was sent to EMAIL (which owns the RCB)
+        log_write( MID_DEBUG_0, tcb_p->thread_name,
+                      "Unpacked '%s'.\n", file_name );
+
+        //  The whole file was read
+        manifest_imported( manifest_p );
+    }
+    else
+    if ( sniff == IMPORT_SNIFF_MISSING )
+    {
+        //  Where did the file go.
+        log_write( MID_INFO, "import",
+                    "MISSING-FILE: %s/%s\n",
+                    rcb_p->file_info_p->dir_name,
+                    rcb_p->file_info_p->file_name );
+
+        //  Kill the Recipe Control Block
+        rcb_kill( rcb_p );
+    }
+    else
+    {
+        //  Log the rejected file
+        log_write( MID_INFO, tcb_p->thread_name,
+                   "Skipping %s file '%s'\n",
+                   IMPORT__sniff_name( sniff ), rcb_p->file_path );
+
+        //  Is the delete flag set (and is the file there) ?
+        if (    ( delete_flag == true                    )
+             && ( sniff       != IMPORT_SNIFF_UNREADABLE ) )
         {
-            //  Where did the file go.
-            log_write( MID_INFO, "import",
-                        "MISSING-FILE: %s/%s\n",
-                        rcb_p->file_info_p->dir_name,
-                        rcb_p->file_info_p->file_name );
+            //  YES:    Delete the file
+            unlink( file_name );
         }
 
+        //  Kill the Recipe Control Block
+        rcb_kill( rcb_p );
+    }
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+}
+
+/****************************************************************************/
+/**
+ *  Initialize the Translations tables.
+ *
+ *  @param  tcb_p               Pointer to a thread control block
+ *
+ *  @return void                No information is returned from this function.
+ *
+ *  @note
+ *
+ ****************************************************************************/
+
+void
+import(
+    void                    *   void_p
+    )
+{
+    /**
+     *  @param  tcb_p           Pointer to a Thread Control Block           */
+    struct  tcb_t           *   tcb_p;
+    /**
+     *  @param  rcb_p           Pointer to a Recipe Control Block           */
+    struct  rcb_t           *   rcb_p;
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+    //  Set the pointer
+    tcb_p = void_p;
+
+    //  Progress report.
+    log_write( MID_INFO, tcb_p->thread_name,
+               "Initialization complete.\n" );
+
+    //  Change execution state to "WAIT"ing for work.
+    tcb_set_state( tcb_p, TS_WAIT );
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    while ( 1 )
+    {
+
+        /********************************************************************
+         *  Get a new file to import
+         ********************************************************************/
+
+        //  Get the current File-ID.
+        rcb_p = tcb_queue_get( tcb_p );
+
+        //  This thread is now the owner of the RCB
+        rcb_p->tcb_p = tcb_p;
+
+        //  Progress report.
+        log_write( MID_INFO, tcb_p->thread_name,
+                   "FILE-ID: %s\n",
+                   rcb_p->file_path );
+
+        //  Change execution state to "INITIALIZED" for work.
+        tcb_set_state( tcb_p, TS_WORKING );
+
+        //  Process the payload
+        import_rcb( tcb_p, rcb_p );
+
         //  Change execution state to "INITIALIZED" for work.
-        tcb_p->thread_state = TS_WAIT;
+        tcb_set_state( tcb_p, TS_WAIT );
+    }
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+}
+
+/****************************************************************************/
+/**
+ *  Get the next line of an input file.
+ *
+ *  @param  rcb_p               Pointer to the file's Recipe Control Block
+ *  @param  line_ndx_p          Position in the line index (start at zero)
+ *  @param  list_lock_key       Key from list_user_lock( ) on import_list_p
+ *
+ *  @return line_p              The next line or NULL at the end of the file
+ *
+ *  @note
+ *      A mapped file is read from its line index and nothing is copied (a
+ *      split part stops at its line_end).  A file that was read a line at
+ *      a time comes off of import_list_p.
+ *      Either way the caller owns the line and releases it with
+ *      import_line_free( ) (or passes it on to a recipe RCB).
+ *
+ ****************************************************************************/
+
+char    *
+import_next_line(
+    struct  rcb_t           *   rcb_p,
+    int                     *   line_ndx_p,
+    int                         list_lock_key
+    )
+{
+    /**
+     *  @param  line_p          The next line                               */
+    char                    *   line_p;
+    /**
+     *  @param  line_end        Line after the last one to read             */
+    int                         line_end;
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+    //  Assume the end of the file
+    line_p = NULL;
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    //  Is the file mapped ?
+    if ( rcb_p->import_map_p != NULL )
+    {
+        //  YES:    Is this a split part of the file ?
+        line_end = rcb_p->line_end;
+        if ( line_end == 0 )
+        {
+            //  NO:     Read to the end of the file
+            line_end = rcb_p->import_map_p->line_count;
+        }
+
+        //  Anything left in the index ?
+        if ( *line_ndx_p < line_end )
+        {
+            //  YES:    Point into the mapping
+            line_p = (   rcb_p->import_map_p->base_p
+                       + rcb_p->import_map_p->line_p[ *line_ndx_p ].offset );
+            *line_ndx_p += 1;
+        }
+    }
+    else
+    {
+        //  NO:     Take it off of the list
+        line_p = list_fget_first( rcb_p->import_list_p, list_lock_key );
+
+        if ( line_p != NULL )
+        {
+            list_fdelete( rcb_p->import_list_p, line_p, list_lock_key );
+        }
+    }
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+    return( line_p );
+}
+
+/****************************************************************************/
+/**
+ *  Release a line of an input file.
+ *
+ *  @param  rcb_p               Pointer to the Recipe Control Block
+ *  @param  line_p              The line
+ *
+ *  @return void                No information is returned
+ *
+ *  @note
+ *      Lines inside the RCB's mapping go away with the mapping.  Anything
+ *      else was allocated and is freed.
+ *
+ ****************************************************************************/
+
+void
+import_line_free(
+    struct  rcb_t           *   rcb_p,
+    char                    *   line_p
+    )
+{
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    //  Is the line inside the mapping ?
+    if (    ( rcb_p->import_map_p != NULL )
+         && ( line_p >= rcb_p->import_map_p->base_p )
+         && ( line_p <  (   rcb_p->import_map_p->base_p
+                          + rcb_p->import_map_p->map_l ) ) )
+    {
+        //  YES:    Nothing to do
+    }
+    else
+    {
+        //  NO:     Free it
+        mem_free( line_p );
+    }
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+}
+
+/****************************************************************************/
+/**
+ *  Another RCB now points into a mapping.
+ *
+ *  @param  import_map_p        The mapping
+ *
+ *  @return void                No information is returned
+ *
+ *  @note
+ *
+ ****************************************************************************/
+
+void
+import_map_hold(
+    struct  import_map_t    *   import_map_p
+    )
+{
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    //  One more user
+    __atomic_add_fetch( &import_map_p->ref_count, 1, __ATOMIC_RELAXED );
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+}
+
+/****************************************************************************/
+/**
+ *  An RCB no longer points into a mapping.
+ *
+ *  @param  import_map_p        The mapping
+ *
+ *  @return void                No information is returned
+ *
+ *  @note
+ *      The last one out unmaps the file and frees the line index.
+ *
+ ****************************************************************************/
+
+void
+import_map_release(
+    struct  import_map_t    *   import_map_p
+    )
+{
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    //  Was this the last user ?
+    if ( __atomic_sub_fetch( &import_map_p->ref_count, 1,
+                             __ATOMIC_ACQ_REL ) == 0 )
+    {
+        //  YES:    Release everything
+        munmap( import_map_p->base_p, import_map_p->map_l );
+        mem_free( import_map_p->line_p );
+        mem_free( import_map_p );
+    }
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+}
+
+/****************************************************************************/
+/**
+ *  Write the file classification counts to the log.
+ *
+ *  @param  void                No parameters are passed into this function.
+ *
+ *  @return void                No information is returned
+ *
+ *  @note
+ *      Called by main( ) after the last file has been imported.
+ *
+ ****************************************************************************/
+
+void
+import_report(
+    void
+    )
+{
+    /**
+     *  @param  sniff           Sniff result                                */
+    enum    import_sniff_e      sniff;
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    //  One line for every result that happened
+    for ( sniff = IMPORT_SNIFF_TEXT;
+          sniff < IMPORT_SNIFF_MAX;
+          sniff += 1 )
+    {
+        if ( import_sniff_count[ sniff ] != 0 )
+        {
+            log_write( MID_INFO, "import",
+                       "%-14s files: %8d\n",
+                       IMPORT__sniff_name( sniff ),
+                       import_sniff_count[ sniff ] );
+        }
+    }
+
+    //  What was found inside the archives
+    if (    ( import_member_count != 0 )
+         || ( import_member_skip  != 0 ) )
+    {
+        log_write( MID_INFO, "import",
+                   "Archive members imported: %d, skipped: %d\n",
+                   import_member_count, import_member_skip );
+    }
+
+    //  How many mailboxes were split
+    if ( import_split_count != 0 )
+    {
+        log_write( MID_INFO, "import",
+                   "Files split at message boundaries: %d (%d parts)\n",
+                   import_split_count, import_split_parts );
+    }
+
+    //  How many text files had a recipe marker in them
+    if ( import_scan_count != 0 )
+    {
+        log_write( MID_INFO, "import",
+                   "Files with recipe markers: %d of %d (%d%%), %d skipped\n",
+                   import_scan_count - import_scan_skip, import_scan_count,
+                   ( ( import_scan_count - import_scan_skip ) * 100 )
+                        / import_scan_count,
+                   import_scan_skip );
+    }
+
+    //  What duplicate content saved
+    if ( import_dup_count != 0 )
+    {
+        log_write( MID_INFO, "import",
+                   "Duplicate files skipped: %d (%llu MB not decoded again)\n",
+                   import_dup_count,
+                   (unsigned long long)( import_dup_bytes / ( 1024 * 1024 ) ) );
+    }
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+}
+
+/****************************************************************************/
+/**
+ *  Send the next chunk of a streamed file to EMAIL.
+ *
+ *  @param  rcb_p               Pointer to the file's Recipe Control Block
+ *  @param  list_p              The lines in the chunk
+ *  @param  chunk_l             Number of text bytes in the chunk
+ *  @param  chunk_end           What the chunk is the end of (if anything)
+ *  @param  file_path_p         New display name for the recipes that are
+ *                              found from here on ( NULL = no change )
+ *
+ *  @return void                No information is returned
+ *
+ *  @note
+ *      Waits until EMAIL has finished the file's previous chunk (so the
+ *      chunks are split in order) and until the chunk fits in the byte
+ *      budget.  A chunk always fits when nothing else is in flight.
+ *      Archives are always streamed; without -stream_mb they get the
+ *      IMPORT_STREAM_DEFAULT budget.
+ *
+ ****************************************************************************/
+
+void
+import_chunk_put(
+    struct  rcb_t           *   rcb_p,
+    struct  list_base_t     *   list_p,
+    size_t                      chunk_l,
+    enum    import_chunk_e      chunk_end,
+    char                    *   file_path_p
+    )
+{
+    /**
+     *  @param  old_list_p      The (empty) list from the previous chunk    */
+    struct  list_base_t     *   old_list_p;
+    /**
+     *  @param  budget          Bytes allowed in flight                     */
+    size_t                      budget;
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+    //  How much may be in flight ?
+    budget = import_stream_budget;
+    if ( budget == 0 )
+    {
+        budget = IMPORT_STREAM_DEFAULT;
+    }
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    pthread_mutex_lock( &stream_mutex );
+
+    //  Wait for the previous chunk and for room in the budget
+    while (    ( rcb_p->chunk_busy == true )
+            || (    ( stream_bytes != 0 )
+                 && ( ( stream_bytes + chunk_l ) > budget ) ) )
+    {
+        pthread_cond_wait( &stream_cond, &stream_mutex );
+    }
+
+    //  The chunk is now in flight
+    stream_bytes        += chunk_l;
+
+    //  Load the chunk into the file's RCB
+    old_list_p           = rcb_p->import_list_p;
+    rcb_p->import_list_p = list_p;
+    rcb_p->chunk_l       = chunk_l;
+    rcb_p->chunk_eof     = ( chunk_end != IMPORT_CHUNK_MORE );
+    rcb_p->chunk_last    = ( chunk_end == IMPORT_CHUNK_LAST );
+    rcb_p->chunk_busy    = true;
+
+    //  Is there a new display name ?
+    if ( file_path_p != NULL )
+    {
+        //  YES:    Recipes are cloned from the RCB with this name
+        rcb_info_own( rcb_p );
+        memset( rcb_p->file_path, '\0', RCB_FILE_PATH_L );
+        strncpy( rcb_p->file_path, file_path_p, RCB_FILE_PATH_L - 1 );
+    }
+
+    pthread_mutex_unlock( &stream_mutex );
+
+    //  EMAIL emptied the old list
+    list_kill( old_list_p );
+
+    //  Off it goes
+    tcb_queue_put( email_tcb, rcb_p );
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+}
+
+/****************************************************************************/
+/**
+ *  EMAIL is finished with a chunk.
+ *
+ *  @param  rcb_p               Pointer to the file's Recipe Control Block
+ *
+ *  @return void                No information is returned
+ *
+ *  @note
+ *      Does nothing for a file that was not streamed.  For a chunk that is
+ *      not the last one, the RCB belongs to IMPORT again as soon as this
+ *      returns and EMAIL must not touch it.
+ *
+ ****************************************************************************/
+
+void
+import_chunk_done(
+    struct  rcb_t           *   rcb_p
+    )
+{
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    //  Was this a streamed chunk ?
+    if ( rcb_p->chunk_busy == true )
+    {
+        //  YES:    Give its bytes back and wake IMPORT
+        pthread_mutex_lock( &stream_mutex );
+
+        stream_bytes     -= rcb_p->chunk_l;
+        rcb_p->chunk_busy = false;
+        pthread_cond_broadcast( &stream_cond );
+
+        pthread_mutex_unlock( &stream_mutex );
     }
 
     /************************************************************************
      *  Function Exit
      ************************************************************************/
 
+    //  DONE!
 }
-/****************************************************************************/
\ No newline at end of file
+/****************************************************************************/
@@ -19,6 +19,7 @@
  *  Compiler directives
  ****************************************************************************/
 
+#define _GNU_SOURCE             // See feature_test_macros(7)
 
 /****************************************************************************
  * System Function API
@@ -29,6 +30,16 @@
 #include <stdbool.h>            //  TRUE, FALSE, etc.
 #include <stdio.h>              //  Standard I/O definitions
                                 //*******************************************
+#include <stdlib.h>             //  free( )
+#include <string.h>             //  memchr( )
+#include <unistd.h>             //  close( )
+#include <fcntl.h>              //  open( )
+#include <sys/mman.h>           //  mmap( )
+#include <sys/stat.h>           //  fstat( )
+#include <pthread.h>            //  POSIX threads
+#if defined( __SSE2__ )
+#include <emmintrin.h>          //  SSE2 intrinsics
+#endif
                                 //*******************************************
 
 /****************************************************************************
@@ -42,6 +53,8 @@
 #include "tcb_api.h"            //  API for all tcb_*               PUBLIC
 #include "rcb_api.h"            //  API for all rcb_*               PUBLIC
                                 //*******************************************
+#include "archive_api.h"        //  API for all archive_*           PUBLIC
+#include "email_api.h"          //  API for all email_*             PUBLIC
 #include "import_api.h"         //  API for all import_*            PUBLIC
 #include "import_lib.h"         //  API for all IMPORT__*           PRIVATE
                                 //*******************************************
@@ -58,6 +71,11 @@
  ****************************************************************************/
 
 //----------------------------------------------------------------------------
+//-----   One XXH64 round
+#define IMPORT_HASH_ROUND( acc, input )                                     \
+    acc += ( input ) * IMPORT_HASH_P2;                                      \
+    acc  = ( acc << 31 ) | ( acc >> 33 );                                   \
+    acc *= IMPORT_HASH_P1;
 //----------------------------------------------------------------------------
 
 /****************************************************************************
@@ -72,6 +90,29 @@
  ****************************************************************************/
 
 //----------------------------------------------------------------------------
+/**
+ *  @param  sniff_name          Printable name for each sniff result        */
+static
+char                        *   sniff_name[ IMPORT_SNIFF_MAX ] =
+{
+    "text",
+    "missing",
+    "unreadable",
+    "image",
+    "PDF",
+    "MS-Office",
+    "archive",
+    "NUL byte",
+    "control byte"
+};
+/**
+ *  @param  seen_pp             Content imported so far, by hash            */
+static
+struct  import_seen_t       *   seen_pp[ IMPORT_SEEN_BUCKETS ];
+/**
+ *  @param  seen_mutex          Protects seen_pp                            */
+static
+pthread_mutex_t                 seen_mutex = PTHREAD_MUTEX_INITIALIZER;
 //----------------------------------------------------------------------------
 
 /****************************************************************************
@@ -115,4 +156,1724 @@ IMPORT__FooBar(
     //  DONE!
     return ( 0 );
 }
+
+/****************************************************************************/
+/**
+ *  Memory map an input file and build its line index.
+ *
+ *  @param  file_name_p         Full path & name of the file
+ *  @param  hash_p              Content hash to add the file to
+ *
+ *  @return import_map_p        The mapping or NULL when it failed
+ *
+ *  @note
+ *      The file is mapped private and writable.  Each line end is replaced
+ *      by a '\0' (and a CR in front of it is removed) so every line is a C
+ *      string inside the mapping; the file itself is never changed.
+ *      Nearly every page holds a line end, so nearly every page is copied
+ *      on write: the mapping costs about the size of the file in anonymous
+ *      memory, like reading it into one buffer.  What it saves over the
+ *      getline( ) import is the heap block, list node and copy per line
+ *      (a 188 MB file: 184 MB anonymous RSS mapped, 375 MB read by line).
+ *      The mapping is one byte longer than the file, backed by an anonymous
+ *      page when needed, so the last line has room for its '\0' too.
+ *      The newline search is memchr( ), which the C library vectorizes.
+ *      Each line (with its line end) is added to the content hash before
+ *      it is changed, so the hash is of the file exactly as it is on disk.
+ *
+ ****************************************************************************/
+
+struct  import_map_t    *
+IMPORT__map(
+    char                    *   file_name_p,
+    struct  import_hash_t   *   hash_p
+    )
+{
+    /**
+     *  @param  import_map_p    The mapping                                 */
+    struct  import_map_t    *   import_map_p;
+    /**
+     *  @param  file_fd         File descriptor                             */
+    int                         file_fd;
+    /**
+     *  @param  file_stat       File status                                 */
+    struct  stat                file_stat;
+    /**
+     *  @param  line_max        Number of records the index has room for    */
+    int                         line_max;
+    /**
+     *  @param  line_p          Start of the current line                   */
+    char                    *   line_p;
+    /**
+     *  @param  end_p           End of the file                             */
+    char                    *   end_p;
+    /**
+     *  @param  eol_p           End of the current line                     */
+    char                    *   eol_p;
+    /**
+     *  @param  line_l          Length of the current line                  */
+    int                         line_l;
+    /**
+     *  @param  index_p         A bigger line index                         */
+    struct  import_line_t   *   index_p;
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+    //  Open the file
+    file_fd = open( file_name_p, O_RDONLY );
+
+    //  Did it open ?
+    if ( file_fd < 0 )
+    {
+        //  NO:     The caller will fall back to reading it
+        return( NULL );
+    }
+
+    //  How big is it ?
+    if (    ( fstat( file_fd, &file_stat ) != 0 )
+         || ( file_stat.st_size            == 0 ) )
+    {
+        //  Can't (or no need to) map it
+        close( file_fd );
+        return( NULL );
+    }
+
+    //  Allocate the control structure
+    import_map_p = mem_malloc( sizeof( struct import_map_t ) );
+    import_map_p->map_l      = file_stat.st_size + 1;
+    import_map_p->line_count = 0;
+    import_map_p->ref_count  = 1;
+
+    //  Reserve room for the file and the trailing '\0' ...
+    import_map_p->base_p = mmap( NULL, import_map_p->map_l,
+                                 PROT_READ | PROT_WRITE,
+                                 MAP_PRIVATE | MAP_ANONYMOUS, -1, 0 );
+
+    //  ... and map the file over the front of it
+    if (    ( import_map_p->base_p == MAP_FAILED )
+         || ( mmap( import_map_p->base_p, file_stat.st_size,
+                    PROT_READ | PROT_WRITE,
+                    MAP_PRIVATE | MAP_FIXED, file_fd, 0 ) == MAP_FAILED ) )
+    {
+        //  Something went wrong
+        if ( import_map_p->base_p != MAP_FAILED )
+        {
+            munmap( import_map_p->base_p, import_map_p->map_l );
+        }
+        mem_free( import_map_p );
+        close( file_fd );
+        return( NULL );
+    }
+
+    //  The mapping doesn't need the file descriptor
+    close( file_fd );
+
+    //  Tell the kernel we will read it front to back
+    madvise( import_map_p->base_p, file_stat.st_size, MADV_SEQUENTIAL );
+
+    //  Start with a small index
+    line_max             = IMPORT_LINES_INITIAL;
+    import_map_p->line_p = mem_malloc( line_max * sizeof( struct import_line_t ) );
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    //  Scan the whole file
+    line_p = import_map_p->base_p;
+    end_p  = import_map_p->base_p + file_stat.st_size;
+
+    while (    ( line_p               <  end_p )
+            && ( import_map_p->line_p != NULL  ) )
+    {
+        //  Find the end of the line
+        eol_p = memchr( line_p, '\n', end_p - line_p );
+
+        //  The last line may not have a LF
+        if ( eol_p == NULL )
+        {
+            eol_p = end_p;
+        }
+
+        //  Hash the line as it is in the file
+        IMPORT__hash_update( hash_p, (unsigned char *)line_p,
+                             ( eol_p - line_p ) + ( ( eol_p < end_p ) ? 1 : 0 ) );
+
+        //  Terminate the line and drop a CR
+        *eol_p = '\0';
+        line_l = eol_p - line_p;
+
+        if (    ( line_l            >  0    )
+             && ( line_p[ line_l - 1 ] == '\r' ) )
+        {
+            line_l -= 1;
+            line_p[ line_l ] = '\0';
+        }
+
+        //  Is the index full ?
+        if ( import_map_p->line_count == line_max )
+        {
+            //  YES:    Double it
+            index_p = mem_malloc( 2 * line_max * sizeof( struct import_line_t ) );
+
+            if ( index_p != NULL )
+            {
+                memcpy( index_p, import_map_p->line_p,
+                        line_max * sizeof( struct import_line_t ) );
+                line_max *= 2;
+            }
+            mem_free( import_map_p->line_p );
+            import_map_p->line_p = index_p;
+
+            //  Did we run out of memory ?
+            if ( index_p == NULL )
+            {
+                //  YES:    Give up on mapping this file
+                break;
+            }
+        }
+
+        //  Add the line to the index
+        import_map_p->line_p[ import_map_p->line_count ].offset
+                = line_p - import_map_p->base_p;
+        import_map_p->line_p[ import_map_p->line_count ].length
+                = line_l;
+        import_map_p->line_count += 1;
+
+        //  Next line
+        line_p = eol_p + 1;
+    }
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  Is there a line index ?
+    if ( import_map_p->line_p == NULL )
+    {
+        //  NO:     The caller will fall back to reading the file
+        log_write( MID_WARNING, "import",
+                   "No memory for the line index of '%s'\n", file_name_p );
+
+        munmap( import_map_p->base_p, import_map_p->map_l );
+        mem_free( import_map_p );
+        import_map_p = NULL;
+    }
+
+    //  DONE!
+    return( import_map_p );
+}
+
+/****************************************************************************/
+/**
+ *  Read a file and send it to EMAIL one chunk at a time.
+ *
+ *  @param  rcb_p               Pointer to the file's Recipe Control Block
+ *  @param  file_name_p         Full path & name of the file
+ *
+ *  @return void                No information is returned
+ *
+ *  @note
+ *      A chunk is cut at the first line end after IMPORT_CHUNK_L bytes.
+ *      import_chunk_put( ) holds this thread back when the byte budget is
+ *      used up, so the memory used by a file no longer depends on its
+ *      size.  The last chunk (possibly empty) is always sent; EMAIL kills
+ *      the RCB when it is done with it.
+ *
+ ****************************************************************************/
+
+void
+IMPORT__stream(
+    struct  rcb_t           *   rcb_p,
+    char                    *   file_name_p
+    )
+{
+    /**
+     *  @param  file_p          The input file                              */
+    FILE                    *   file_p;
+    /**
+     *  @param  list_p          Lines in the chunk being read               */
+    struct  list_base_t     *   list_p;
+    /**
+     *  @param  chunk_l         Text bytes in the chunk being read          */
+    size_t                      chunk_l;
+    /**
+     *  @param  read_data_p     Read data buffer                            */
+    char                    *   read_data_p;
+    /**
+     *  @param  read_data_l     Size of the read data buffer                */
+    size_t                      read_data_l;
+    /**
+     *  @param  line_l          Length of the line that was read            */
+    ssize_t                     line_l;
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+    //  Open the file for reading
+    file_p  = file_open_read( file_name_p );
+
+    //  Start the first chunk
+    list_p  = list_new( );
+    chunk_l = 0;
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    do
+    {
+        //  Read a line of text
+        read_data_l = 0;
+        read_data_p = NULL;
+        line_l      = getline( &read_data_p, &read_data_l, file_p );
+
+        //  Was the read successful ?
+        if ( line_l != -1 )
+        {
+            //  YES:    Remove CR/LF
+            text_remove_crlf( read_data_p );
+
+            //  Put the new line in the chunk
+            list_put_last( list_p, read_data_p );
+            chunk_l += line_l;
+
+            //  Is the chunk full ?
+            if ( chunk_l >= IMPORT_CHUNK_L )
+            {
+                //  YES:    Send it and start the next one
+                import_chunk_put( rcb_p, list_p, chunk_l,
+                                  IMPORT_CHUNK_MORE, NULL );
+                list_p  = list_new( );
+                chunk_l = 0;
+            }
+        }
+        else
+        {
+            //  NO:     getline( ) may have allocated a buffer anyway
+            free( read_data_p );
+        }
+
+        //  Keep reading until we reach the end-of-file
+    }   while( line_l != -1 );
+
+    //  Close the import file
+    file_close( file_p );
+
+    //  Is the delete flag set ?
+    if ( delete_flag == true )
+    {
+        //  YES:    Delete the file
+        unlink( file_name_p );
+    }
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  Send whatever is left as the last chunk
+    import_chunk_put( rcb_p, list_p, chunk_l, IMPORT_CHUNK_LAST, NULL );
+
+    //  DONE!
+}
+
+/****************************************************************************/
+/**
+ *  Send one text member of an archive to EMAIL.
+ *
+ *  @param  rcb_p               Pointer to the archive's Recipe Control Block
+ *  @param  archive_p           The archive, positioned on the member
+ *  @param  member_path_p       Display name of the member
+ *  @param  data_p              The first block of the member (already read)
+ *  @param  data_l              Number of bytes in the first block
+ *
+ *  @return void                No information is returned
+ *
+ *  @note
+ *      The member is split into lines as it is decompressed and the lines
+ *      are sent as chunks, exactly like a streamed file.  Its last chunk is
+ *      marked IMPORT_CHUNK_MEMBER so EMAIL ends any open recipe there.
+ *
+ ****************************************************************************/
+
+void
+IMPORT__member(
+    struct  rcb_t           *   rcb_p,
+    struct  archive_t       *   archive_p,
+    char                    *   member_path_p,
+    unsigned char           *   data_p,
+    int                         data_l
+    )
+{
+    /**
+     *  @param  buf_p           Decompressed text not split into lines yet  */
+    char                    *   buf_p;
+    /**
+     *  @param  new_buf_p       A bigger buffer (for a very long line)      */
+    char                    *   new_buf_p;
+    /**
+     *  @param  buf_size        Size of the buffer                          */
+    size_t                      buf_size;
+    /**
+     *  @param  buf_l           Number of bytes in the buffer               */
+    size_t                      buf_l;
+    /**
+     *  @param  line_ndx        Start of the current line                   */
+    size_t                      line_ndx;
+    /**
+     *  @param  scan_ndx        Where to look for the next line end         */
+    size_t                      scan_ndx;
+    /**
+     *  @param  line_l          Length of a line                            */
+    size_t                      line_l;
+    /**
+     *  @param  eol_p           End of a line                               */
+    char                    *   eol_p;
+    /**
+     *  @param  line_p          A copy of the line                          */
+    char                    *   line_p;
+    /**
+     *  @param  read_l          Number of bytes decompressed                */
+    ssize_t                     read_l;
+    /**
+     *  @param  list_p          Lines in the chunk being built              */
+    struct  list_base_t     *   list_p;
+    /**
+     *  @param  chunk_l         Text bytes in the chunk being built         */
+    size_t                      chunk_l;
+    /**
+     *  @param  path_p          Display name to send with the next chunk    */
+    char                    *   path_p;
+    /**
+     *  @param  member_eof      TRUE when the member has been read          */
+    int                         member_eof;
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+    //  Start with the first block
+    buf_size = IMPORT_READ_L;
+    buf_p    = mem_malloc( buf_size );
+    memcpy( buf_p, data_p, data_l );
+    buf_l    = data_l;
+    line_ndx = 0;
+    scan_ndx = 0;
+
+    //  Start the first chunk
+    list_p     = list_new( );
+    chunk_l    = 0;
+    path_p     = member_path_p;
+    member_eof = false;
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    while ( true )
+    {
+        //  Is there another complete line in the buffer ?
+        eol_p = memchr( &buf_p[ scan_ndx ], '\n', buf_l - scan_ndx );
+
+        if (    ( eol_p      != NULL )
+             || (    ( member_eof == true  )
+                  && ( line_ndx   <  buf_l ) ) )
+        {
+            //  YES:    How long is it (without the CR/LF) ?
+            line_l = ( ( eol_p != NULL ) ? (size_t)( eol_p - buf_p ) : buf_l )
+                   - line_ndx;
+            chunk_l += line_l + 1;
+
+            if (    ( line_l                            >  0    )
+                 && ( buf_p[ line_ndx + line_l - 1 ] == '\r' ) )
+            {
+                line_l -= 1;
+            }
+
+            //  Put a copy of it in the chunk
+            line_p = mem_malloc( line_l + 1 );
+            memcpy( line_p, &buf_p[ line_ndx ], line_l );
+            line_p[ line_l ] = '\0';
+            list_put_last( list_p, line_p );
+
+            //  Move past it
+            line_ndx = ( eol_p != NULL ) ? (size_t)( eol_p - buf_p ) + 1 : buf_l;
+            scan_ndx = line_ndx;
+
+            //  Is the chunk full ?
+            if ( chunk_l >= IMPORT_CHUNK_L )
+            {
+                //  YES:    Send it and start the next one
+                import_chunk_put( rcb_p, list_p, chunk_l,
+                                  IMPORT_CHUNK_MORE, path_p );
+                list_p  = list_new( );
+                chunk_l = 0;
+                path_p  = NULL;
+            }
+        }
+        else
+        if ( member_eof == true )
+        {
+            //  That was the last line
+            break;
+        }
+        else
+        {
+            //  No line end in what is there
+            scan_ndx = buf_l;
+
+            //  Move the partial line to the front of the buffer
+            if ( line_ndx != 0 )
+            {
+                memmove( buf_p, &buf_p[ line_ndx ], buf_l - line_ndx );
+                buf_l    -= line_ndx;
+                scan_ndx -= line_ndx;
+                line_ndx  = 0;
+            }
+
+            //  Is the buffer full of one line ?
+            if ( buf_l == buf_size )
+            {
+                //  YES:    Make it bigger
+                new_buf_p = mem_malloc( buf_size * 2 );
+                memcpy( new_buf_p, buf_p, buf_l );
+                mem_free( buf_p );
+                buf_p     = new_buf_p;
+                buf_size *= 2;
+            }
+
+            //  Decompress some more
+            read_l = archive_read( archive_p, &buf_p[ buf_l ], buf_size - buf_l );
+
+            if ( read_l > 0 )
+            {
+                buf_l += read_l;
+            }
+            else
+            {
+                member_eof = true;
+            }
+        }
+    }
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  Send whatever is left as the end of the member
+    import_chunk_put( rcb_p, list_p, chunk_l, IMPORT_CHUNK_MEMBER, path_p );
+
+    //  Release the buffer
+    mem_free( buf_p );
+
+    //  DONE!
+}
+
+/****************************************************************************/
+/**
+ *  Import every member of an archive.
+ *
+ *  @param  rcb_p               Pointer to the archive's Recipe Control Block
+ *  @param  archive_p           The archive
+ *  @param  archive_path_p      Display name of the archive
+ *  @param  depth               How many archives this one is inside of
+ *
+ *  @return void                No information is returned
+ *
+ *  @note
+ *      Each member is sniffed like a file.  Text members are imported,
+ *      archive members are opened and imported (up to IMPORT_ARCHIVE_DEPTH
+ *      deep) and everything else is skipped.
+ *
+ ****************************************************************************/
+
+void
+IMPORT__unpack(
+    struct  rcb_t           *   rcb_p,
+    struct  archive_t       *   archive_p,
+    char                    *   archive_path_p,
+    int                         depth
+    )
+{
+    /**
+     *  @param  member_name     Name of the member                          */
+    char                        member_name[ FILENAME_MAX ];
+    /**
+     *  @param  member_path     Display name of the member                  */
+    char                        member_path[ FILENAME_MAX ];
+    /**
+     *  @param  data            The first block of the member               */
+    unsigned char               data[ IMPORT_SNIFF_L ];
+    /**
+     *  @param  data_l          Number of bytes in the block                */
+    int                         data_l;
+    /**
+     *  @param  read_l          Number of bytes decompressed                */
+    ssize_t                     read_l;
+    /**
+     *  @param  sniff           What the member looks like                  */
+    enum    import_sniff_e      sniff;
+    /**
+     *  @param  inner_p         An archive inside this one                  */
+    struct  archive_t       *   inner_p;
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    //  For every member
+    while ( archive_next( archive_p, member_name, sizeof( member_name ) ) == true )
+    {
+        //  Is it a directory ?
+        if (    ( member_name[ 0 ]                         == '\0' )
+             || ( member_name[ strlen( member_name ) - 1 ] == '/'  ) )
+        {
+            //  YES:    Nothing in it
+            continue;
+        }
+
+        //  Build the display name
+        snprintf( member_path, sizeof( member_path ),
+                  "%s/%s", archive_path_p, member_name );
+
+        //  Read the first block
+        data_l = 0;
+        while (    ( data_l < (int)sizeof( data ) )
+                && ( ( read_l = archive_read( archive_p, &data[ data_l ],
+                                              sizeof( data ) - data_l ) ) > 0 ) )
+        {
+            data_l += read_l;
+        }
+
+        //  What is it ?
+        sniff = IMPORT__sniff_data( data, data_l );
+
+        //  Is it an archive that can be opened ?
+        if (    ( sniff == IMPORT_SNIFF_ARCHIVE )
+             && ( depth <  IMPORT_ARCHIVE_DEPTH )
+             && ( ( inner_p = archive_open_member( archive_p, member_name,
+                                                   data, data_l ) ) != NULL ) )
+        {
+            //  YES:    Import what is in it
+            IMPORT__unpack( rcb_p, inner_p, member_path, depth + 1 );
+            archive_close( inner_p );
+        }
+        else
+        if (    ( sniff  == IMPORT_SNIFF_TEXT )
+             && ( data_l >  0                 ) )
+        {
+            //  Import it
+            IMPORT__member( rcb_p, archive_p, member_path, data, data_l );
+            __atomic_add_fetch( &import_member_count, 1, __ATOMIC_RELAXED );
+        }
+        else
+        {
+            //  Log the rejected member
+            log_write( MID_INFO, "import",
+                       "Skipping %s member '%s'\n",
+                       ( data_l > 0 ) ? IMPORT__sniff_name( sniff ) : "EMPTY",
+                       member_path );
+            __atomic_add_fetch( &import_member_skip, 1, __ATOMIC_RELAXED );
+        }
+    }
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+}
+
+/****************************************************************************/
+/**
+ *  Import a ZIP, GZIP, BZIP2 or XZ file without unpacking it to disk.
+ *
+ *  @param  rcb_p               Pointer to the file's Recipe Control Block
+ *  @param  file_name_p         Full path & name of the file
+ *
+ *  @return archive_rc          TRUE when the archive was read
+ *                              FALSE when it is not a kind that can be read
+ *
+ *  @note
+ *      Every text member goes to EMAIL as chunks of the archive's RCB, so
+ *      the recipes are numbered (-ordered) as if the archive were one
+ *      file.  EMAIL kills the RCB after the empty last chunk.
+ *      Each IMPORT thread reads its own archive; several archives are
+ *      decompressed at the same time.
+ *
+ ****************************************************************************/
+
+int
+IMPORT__archive(
+    struct  rcb_t           *   rcb_p,
+    char                    *   file_name_p
+    )
+{
+    /**
+     *  @param  archive_p       The archive                                 */
+    struct  archive_t       *   archive_p;
+    /**
+     *  @param  archive_path    Display name of the archive                 */
+    char                        archive_path[ FILENAME_MAX ];
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+    //  Open it
+    archive_p = archive_open( file_name_p );
+
+    //  Can it be read ?
+    if ( archive_p == NULL )
+    {
+        //  NO:     Let the caller skip it
+        return( false );
+    }
+
+    //  The member names are added to the archive name
+    strncpy( archive_path, rcb_p->file_path, sizeof( archive_path ) - 1 );
+    archive_path[ sizeof( archive_path ) - 1 ] = '\0';
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    //  Import everything in it
+    IMPORT__unpack( rcb_p, archive_p, archive_path, 0 );
+
+    //  Close it
+    archive_close( archive_p );
+
+    //  Is the delete flag set ?
+    if ( delete_flag == true )
+    {
+        //  YES:    Delete the file
+        unlink( file_name_p );
+    }
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  End of the file
+    import_chunk_put( rcb_p, list_new( ), 0, IMPORT_CHUNK_LAST, NULL );
+
+    //  DONE!
+    return( true );
+}
+
+/****************************************************************************/
+/**
+ *  Count the control bytes in a block of data.
+ *
+ *  @param  data_p              Start of the data
+ *  @param  data_l              Length of the data
+ *  @param  nul_p               Set TRUE when there is a NUL byte
+ *
+ *  @return ctl_count           Number of control bytes
+ *
+ *  @note
+ *      TAB, LF, VT, FF, CR and the DOS end-of-file (0x1A) are text.  Every
+ *      other byte below 0x20, and DEL, is a control byte.  Bytes from 0x80
+ *      up are text (8-bit character sets and UTF-8).
+ *      With SSE2 sixteen bytes are tested at a time.
+ *
+ ****************************************************************************/
+
+int
+IMPORT__control_count(
+    unsigned char           *   data_p,
+    int                         data_l,
+    int                     *   nul_p
+    )
+{
+    /**
+     *  @param  ctl_count       Number of control bytes                     */
+    int                         ctl_count;
+    /**
+     *  @param  nul_count       Number of NUL bytes                         */
+    int                         nul_count;
+    /**
+     *  @param  ndx             Index into the data                         */
+    int                         ndx;
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+    //  Nothing found yet
+    ctl_count = 0;
+    nul_count = 0;
+    ndx       = 0;
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+#if defined( __SSE2__ )
+    {
+        /**
+         *  @param  data        Sixteen bytes of data                       */
+        __m128i                 data;
+        /**
+         *  @param  low         Bytes 0x00 - 0x1F                           */
+        __m128i                 low;
+        /**
+         *  @param  white       Bytes 0x09 - 0x0D                           */
+        __m128i                 white;
+        /**
+         *  @param  ctl         Control bytes                               */
+        __m128i                 ctl;
+
+        //  Sixteen bytes at a time
+        for ( ; ndx + 16 <= data_l; ndx += 16 )
+        {
+            data  = _mm_loadu_si128( (__m128i *)&data_p[ ndx ] );
+
+            //  data <= 0x1F (unsigned)
+            low   = _mm_cmpeq_epi8( _mm_min_epu8( data, _mm_set1_epi8( 0x1F ) ),
+                                    data );
+
+            //  ( data - 0x09 ) <= 0x04 (unsigned), or the DOS end-of-file
+            white = _mm_sub_epi8( data, _mm_set1_epi8( 0x09 ) );
+            white = _mm_cmpeq_epi8( _mm_min_epu8( white, _mm_set1_epi8( 0x04 ) ),
+                                    white );
+            white = _mm_or_si128( white,
+                                  _mm_cmpeq_epi8( data, _mm_set1_epi8( 0x1A ) ) );
+
+            //  Control bytes and DEL
+            ctl   = _mm_or_si128( _mm_andnot_si128( white, low ),
+                                  _mm_cmpeq_epi8( data, _mm_set1_epi8( 0x7F ) ) );
+
+            ctl_count += __builtin_popcount( _mm_movemask_epi8( ctl ) );
+            nul_count += __builtin_popcount( _mm_movemask_epi8(
+                            _mm_cmpeq_epi8( data, _mm_setzero_si128( ) ) ) );
+        }
+    }
+#endif
+
+    //  Whatever is left (or everything without SSE2)
+    for ( ; ndx < data_l; ndx += 1 )
+    {
+        if (    (    ( data_p[ ndx ] <  0x20 )
+                  && ( ( data_p[ ndx ] < 0x09 ) || ( data_p[ ndx ] > 0x0D ) )
+                  && ( data_p[ ndx ] != 0x1A ) )
+             || ( data_p[ ndx ] == 0x7F ) )
+        {
+            ctl_count += 1;
+        }
+
+        if ( data_p[ ndx ] == 0x00 )
+        {
+            nul_count += 1;
+        }
+    }
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  Was there a NUL ?
+    *nul_p = ( nul_count != 0 ) ? true : false;
+
+    //  DONE!
+    return( ctl_count );
+}
+
+/****************************************************************************/
+/**
+ *  Decide if a file is worth importing by looking at its first block.
+ *
+ *  @param  data_p              The first block of the file
+ *  @param  data_l              Number of bytes in the block
+ *
+ *  @return sniff               IMPORT_SNIFF_TEXT or the reason to skip it
+ *
+ *  @note
+ *      Known binary formats are recognized by their magic bytes; anything
+ *      else is binary when it has a NUL or more than IMPORT_SNIFF_CTL_PCT
+ *      percent control bytes.
+ *
+ ****************************************************************************/
+
+enum    import_sniff_e
+IMPORT__sniff_data(
+    unsigned char           *   data,
+    int                         data_l
+    )
+{
+    /**
+     *  @param  sniff           What the file looks like                    */
+    enum    import_sniff_e      sniff;
+    /**
+     *  @param  nul             TRUE when the block has a NUL               */
+    int                         nul;
+    /**
+     *  @param  ctl_count       Number of control bytes in the block        */
+    int                         ctl_count;
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+    //  Assume text
+    sniff = IMPORT_SNIFF_TEXT;
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    //  Images
+    if (    (    ( data_l >= 3 )
+              && ( memcmp( data, "\xFF\xD8\xFF", 3 ) == 0 ) )
+         || (    ( data_l >= 8 )
+              && ( memcmp( data, "\x89PNG\r\n\x1A\n", 8 ) == 0 ) )
+         || (    ( data_l >= 6 )
+              && (    ( memcmp( data, "GIF87a", 6 ) == 0 )
+                   || ( memcmp( data, "GIF89a", 6 ) == 0 ) ) )
+         || (    ( data_l >= 4 )
+              && (    ( memcmp( data, "II*\x00", 4 ) == 0 )
+                   || ( memcmp( data, "MM\x00*", 4 ) == 0 ) ) )
+         || (    ( data_l >= 12 )
+              && ( memcmp( data,     "RIFF", 4 ) == 0 )
+              && ( memcmp( &data[ 8 ], "WEBP", 4 ) == 0 ) )
+         || (    ( data_l >= 10 )
+              && ( memcmp( data,     "BM", 2 ) == 0 )
+              && ( memcmp( &data[ 6 ], "\x00\x00\x00\x00", 4 ) == 0 ) ) )
+    {
+        sniff = IMPORT_SNIFF_IMAGE;
+    }
+
+    //  PDF
+    else if (    ( data_l >= 5 )
+              && ( memcmp( data, "%PDF-", 5 ) == 0 ) )
+    {
+        sniff = IMPORT_SNIFF_PDF;
+    }
+
+    //  MS-Office: OLE2 compound file or a ZIP with Office content
+    else if (    (    ( data_l >= 8 )
+                   && ( memcmp( data, "\xD0\xCF\x11\xE0\xA1\xB1\x1A\xE1", 8 ) == 0 ) )
+              || (    ( data_l >= 4 )
+                   && ( memcmp( data, "PK\x03\x04", 4 ) == 0 )
+                   && ( memmem( data, data_l, "[Content_Types].xml", 19 ) != NULL ) ) )
+    {
+        sniff = IMPORT_SNIFF_OFFICE;
+    }
+
+    //  Archives
+    else if (    (    ( data_l >= 4 )
+                   && ( memcmp( data, "PK\x03\x04", 4 ) == 0 ) )
+              || (    ( data_l >= 2 )
+                   && ( memcmp( data, "\x1F\x8B", 2 ) == 0 ) )
+              || (    ( data_l >= 3 )
+                   && ( memcmp( data, "BZh", 3 ) == 0 )
+                   && ( data[ 3 ] >= '1' ) && ( data[ 3 ] <= '9' ) )
+              || (    ( data_l >= 6 )
+                   && (    ( memcmp( data, "\xFD" "7zXZ\x00", 6 ) == 0 )
+                        || ( memcmp( data, "7z\xBC\xAF\x27\x1C", 6 ) == 0 )
+                        || ( memcmp( data, "Rar!\x1A\x07", 6 ) == 0 ) ) ) )
+    {
+        sniff = IMPORT_SNIFF_ARCHIVE;
+    }
+
+    //  Anything else: look at the bytes
+    else
+    {
+        ctl_count = IMPORT__control_count( data, data_l, &nul );
+
+        if ( nul == true )
+        {
+            sniff = IMPORT_SNIFF_NUL;
+        }
+        else if ( ( ctl_count * 100 ) > ( data_l * IMPORT_SNIFF_CTL_PCT ) )
+        {
+            sniff = IMPORT_SNIFF_CONTROL;
+        }
+    }
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+    return( sniff );
+}
+
+/****************************************************************************/
+/**
+ *  Decide if a file is worth importing by looking at its first block.
+ *
+ *  @param  file_name_p         Full path & name of the file
+ *
+ *  @return sniff               IMPORT_SNIFF_TEXT or the reason to skip it
+ *
+ *  @note
+ *      Only the first IMPORT_SNIFF_L bytes are read.
+ *
+ ****************************************************************************/
+
+enum    import_sniff_e
+IMPORT__sniff(
+    char                    *   file_name_p
+    )
+{
+    /**
+     *  @param  sniff           What the file looks like                    */
+    enum    import_sniff_e      sniff;
+    /**
+     *  @param  file_fd         File descriptor                             */
+    int                         file_fd;
+    /**
+     *  @param  data            The first block of the file                 */
+    unsigned char               data[ IMPORT_SNIFF_L ];
+    /**
+     *  @param  data_l          Number of bytes in the block                */
+    int                         data_l;
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+    //  Read the first block
+    file_fd = open( file_name_p, O_RDONLY );
+
+    if ( file_fd < 0 )
+    {
+        return( IMPORT_SNIFF_UNREADABLE );
+    }
+
+    data_l = read( file_fd, data, sizeof( data ) );
+    close( file_fd );
+
+    if ( data_l < 0 )
+    {
+        return( IMPORT_SNIFF_UNREADABLE );
+    }
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    //  Look at it
+    sniff = IMPORT__sniff_data( data, data_l );
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+    return( sniff );
+}
+
+/****************************************************************************/
+/**
+ *  Get the printable name of a sniff result.
+ *
+ *  @param  sniff               Sniff result
+ *
+ *  @return name_p              Printable name
+ *
+ *  @note
+ *
+ ****************************************************************************/
+
+char    *
+IMPORT__sniff_name(
+    enum    import_sniff_e      sniff
+    )
+{
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+    return( sniff_name[ sniff ] );
+}
+
+/****************************************************************************/
+/**
+ *  Start a whole file content hash.
+ *
+ *  @param  hash_p              Pointer to the hash state
+ *
+ *  @return void                No information is returned
+ *
+ *  @note
+ *      The hash is XXH64 with a seed of zero.  It is built as the file is
+ *      read, so the file is only read once.
+ *
+ ****************************************************************************/
+
+void
+IMPORT__hash_init(
+    struct  import_hash_t   *   hash_p
+    )
+{
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+    memset( hash_p, '\0', sizeof( struct import_hash_t ) );
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    hash_p->acc[ 0 ] = IMPORT_HASH_P1 + IMPORT_HASH_P2;
+    hash_p->acc[ 1 ] = IMPORT_HASH_P2;
+    hash_p->acc[ 2 ] = 0;
+    hash_p->acc[ 3 ] = 0 - IMPORT_HASH_P1;
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+}
+
+/****************************************************************************/
+/**
+ *  Add data to a whole file content hash.
+ *
+ *  @param  hash_p              Pointer to the hash state
+ *  @param  data_p              The data
+ *  @param  data_l              Length of the data
+ *
+ *  @return void                No information is returned
+ *
+ *  @note
+ *      The data may be split anywhere, the hash only depends on the bytes.
+ *
+ ****************************************************************************/
+
+void
+IMPORT__hash_update(
+    struct  import_hash_t   *   hash_p,
+    unsigned char           *   data_p,
+    size_t                      data_l
+    )
+{
+    /**
+     *  @param  lane            One 8 byte lane of a stripe                 */
+    uint64_t                    lane[ 4 ];
+    /**
+     *  @param  copy_l          Bytes that fill up the stripe buffer        */
+    size_t                      copy_l;
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+    hash_p->total_l += data_l;
+
+    //  Is there a partial stripe waiting ?
+    if ( hash_p->mem_l != 0 )
+    {
+        //  YES:    Fill it up
+        copy_l = 32 - hash_p->mem_l;
+        if ( copy_l > data_l )
+        {
+            copy_l = data_l;
+        }
+        memcpy( &hash_p->mem[ hash_p->mem_l ], data_p, copy_l );
+        hash_p->mem_l += copy_l;
+        data_p        += copy_l;
+        data_l        -= copy_l;
+
+        //  Is it full now ?
+        if ( hash_p->mem_l < 32 )
+        {
+            //  NO:     Wait for more data
+            return;
+        }
+
+        //  YES:    Mix it in
+        memcpy( lane, hash_p->mem, 32 );
+        IMPORT_HASH_ROUND( hash_p->acc[ 0 ], lane[ 0 ] );
+        IMPORT_HASH_ROUND( hash_p->acc[ 1 ], lane[ 1 ] );
+        IMPORT_HASH_ROUND( hash_p->acc[ 2 ], lane[ 2 ] );
+        IMPORT_HASH_ROUND( hash_p->acc[ 3 ], lane[ 3 ] );
+        hash_p->mem_l = 0;
+    }
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    //  Mix in every full stripe
+    for ( ; data_l >= 32; data_p += 32, data_l -= 32 )
+    {
+        memcpy( lane, data_p, 32 );
+        IMPORT_HASH_ROUND( hash_p->acc[ 0 ], lane[ 0 ] );
+        IMPORT_HASH_ROUND( hash_p->acc[ 1 ], lane[ 1 ] );
+        IMPORT_HASH_ROUND( hash_p->acc[ 2 ], lane[ 2 ] );
+        IMPORT_HASH_ROUND( hash_p->acc[ 3 ], lane[ 3 ] );
+    }
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  Keep what is left for the next call
+    memcpy( hash_p->mem, data_p, data_l );
+    hash_p->mem_l = data_l;
+
+    //  DONE!
+}
+
+/****************************************************************************/
+/**
+ *  Finish a whole file content hash.
+ *
+ *  @param  hash_p              Pointer to the hash state
+ *
+ *  @return hash                The content hash
+ *
+ *  @note
+ *      Assumes a little endian machine (as does the rest of the hash).
+ *
+ ****************************************************************************/
+
+uint64_t
+IMPORT__hash_final(
+    struct  import_hash_t   *   hash_p
+    )
+{
+    /**
+     *  @param  hash            The content hash                            */
+    uint64_t                    hash;
+    /**
+     *  @param  acc             One lane accumulator                        */
+    uint64_t                    acc;
+    /**
+     *  @param  lane            One 8 or 4 byte lane of the tail            */
+    uint64_t                    lane;
+    /**
+     *  @param  ndx             Index into the tail                         */
+    int                         ndx;
+    /**
+     *  @param  lane_ndx        Lane number                                 */
+    int                         lane_ndx;
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+    //  Was there at least one full stripe ?
+    if ( hash_p->total_l >= 32 )
+    {
+        //  YES:    Merge the lanes
+        hash = ( ( hash_p->acc[ 0 ] <<  1 ) | ( hash_p->acc[ 0 ] >> 63 ) )
+             + ( ( hash_p->acc[ 1 ] <<  7 ) | ( hash_p->acc[ 1 ] >> 57 ) )
+             + ( ( hash_p->acc[ 2 ] << 12 ) | ( hash_p->acc[ 2 ] >> 52 ) )
+             + ( ( hash_p->acc[ 3 ] << 18 ) | ( hash_p->acc[ 3 ] >> 46 ) );
+
+        for ( lane_ndx = 0; lane_ndx < 4; lane_ndx += 1 )
+        {
+            acc = 0;
+            IMPORT_HASH_ROUND( acc, hash_p->acc[ lane_ndx ] );
+            hash ^= acc;
+            hash  = hash * IMPORT_HASH_P1 + IMPORT_HASH_P4;
+        }
+    }
+    else
+    {
+        //  NO:     Short input
+        hash = IMPORT_HASH_P5;
+    }
+
+    hash += hash_p->total_l;
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    //  Mix in the tail, 8 bytes, then 4 bytes, then 1 byte at a time
+    for ( ndx = 0; ndx + 8 <= hash_p->mem_l; ndx += 8 )
+    {
+        memcpy( &lane, &hash_p->mem[ ndx ], 8 );
+        acc = 0;
+        IMPORT_HASH_ROUND( acc, lane );
+        hash ^= acc;
+        hash  = ( ( hash << 27 ) | ( hash >> 37 ) ) * IMPORT_HASH_P1
+              + IMPORT_HASH_P4;
+    }
+    if ( ndx + 4 <= hash_p->mem_l )
+    {
+        lane = 0;
+        memcpy( &lane, &hash_p->mem[ ndx ], 4 );
+        hash ^= lane * IMPORT_HASH_P1;
+        hash  = ( ( hash << 23 ) | ( hash >> 41 ) ) * IMPORT_HASH_P2
+              + IMPORT_HASH_P3;
+        ndx  += 4;
+    }
+    for ( ; ndx < hash_p->mem_l; ndx += 1 )
+    {
+        hash ^= hash_p->mem[ ndx ] * IMPORT_HASH_P5;
+        hash  = ( ( hash << 11 ) | ( hash >> 53 ) ) * IMPORT_HASH_P1;
+    }
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  Avalanche
+    hash ^= hash >> 33;
+    hash *= IMPORT_HASH_P2;
+    hash ^= hash >> 29;
+    hash *= IMPORT_HASH_P3;
+    hash ^= hash >> 32;
+
+    //  DONE!
+    return( hash );
+}
+
+/****************************************************************************/
+/**
+ *  Check whether a file's content has already been imported.
+ *
+ *  @param  rcb_p               Pointer to the file's Recipe Control Block
+ *  @param  hash_p              The file's content hash (not finished yet)
+ *
+ *  @return duplicate           TRUE when another file with the same content
+ *                              has already been imported, else FALSE.
+ *
+ *  @note
+ *      The first file with a given content is remembered and imported, so
+ *      two copies that are imported at the same time can't skip each other.
+ *      A match needs the same length and the same 64 bit hash.
+ *      Only whole text files that are mapped or read in one piece are
+ *      checked.  Streamed files and archive members go to EMAIL chunk by
+ *      chunk while they are read, before their hash is known, so a copy
+ *      inside an archive (a re-zipped backup) is still imported.
+ *
+ ****************************************************************************/
+
+int
+IMPORT__duplicate(
+    struct  rcb_t           *   rcb_p,
+    struct  import_hash_t   *   hash_p
+    )
+{
+    /**
+     *  @param  duplicate       Return code                                 */
+    int                         duplicate;
+    /**
+     *  @param  hash            The content hash                            */
+    uint64_t                    hash;
+    /**
+     *  @param  seen_p          Content imported so far                     */
+    struct  import_seen_t   *   seen_p;
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+    duplicate = false;
+    hash      = IMPORT__hash_final( hash_p );
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    pthread_mutex_lock( &seen_mutex );
+
+    //  Look for the content
+    for ( seen_p  = seen_pp[ hash & ( IMPORT_SEEN_BUCKETS - 1 ) ];
+          seen_p != NULL;
+          seen_p  = seen_p->next_p )
+    {
+        //  Is this the same content ?
+        if (    ( seen_p->hash   == hash             )
+             && ( seen_p->file_l == hash_p->total_l  ) )
+        {
+            //  YES:    It was imported already
+            duplicate = true;
+            break;
+        }
+    }
+
+    //  Is it new ?
+    if ( duplicate == false )
+    {
+        //  YES:    Remember it
+        seen_p = mem_malloc( sizeof( struct import_seen_t ) );
+        seen_p->hash        = hash;
+        seen_p->file_l      = hash_p->total_l;
+        seen_p->file_path_p = text_copy_to_new( rcb_p->file_path );
+        seen_p->next_p      = seen_pp[ hash & ( IMPORT_SEEN_BUCKETS - 1 ) ];
+        seen_pp[ hash & ( IMPORT_SEEN_BUCKETS - 1 ) ] = seen_p;
+    }
+    else
+    {
+        //  NO:     Log it while the first file is still known
+        log_write( MID_INFO, "import",
+                   "Skipping duplicate file '%s' (same content as '%s')\n",
+                   rcb_p->file_path, seen_p->file_path_p );
+    }
+
+    pthread_mutex_unlock( &seen_mutex );
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  Count it
+    if ( duplicate == true )
+    {
+        __atomic_add_fetch( &import_dup_count, 1, __ATOMIC_RELAXED );
+        __atomic_add_fetch( &import_dup_bytes, hash_p->total_l,
+                            __ATOMIC_RELAXED );
+    }
+
+    //  DONE!
+    return( duplicate );
+}
+
+/****************************************************************************/
+/**
+ *  Find the line that starts at or after a position in a mapped file.
+ *
+ *  @param  import_map_p        The mapping
+ *  @param  offset              Position in the mapping
+ *
+ *  @return line_ndx            The line number ( line_count = none )
+ *
+ *  @note
+ *      The line index is in file order, so this is a binary search.
+ *
+ ****************************************************************************/
+
+int
+IMPORT__line_at(
+    struct  import_map_t    *   import_map_p,
+    size_t                      offset
+    )
+{
+    /**
+     *  @param  low             First line that may be the one              */
+    int                         low;
+    /**
+     *  @param  high            Line after the last one that may be it      */
+    int                         high;
+    /**
+     *  @param  mid             Line in the middle                          */
+    int                         mid;
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+    low  = 0;
+    high = import_map_p->line_count;
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    while ( low < high )
+    {
+        mid = low + ( high - low ) / 2;
+
+        //  Does the middle line start before the position ?
+        if ( import_map_p->line_p[ mid ].offset < offset )
+        {
+            //  YES:    It's further on
+            low  = mid + 1;
+        }
+        else
+        {
+            //  NO:     It's this one or an earlier one
+            high = mid;
+        }
+    }
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+    return( low );
+}
+
+/****************************************************************************/
+/**
+ *  Find the next e-Mail message in a mapped file.
+ *
+ *  @param  import_map_p        The mapping
+ *  @param  line_ndx            Where to start looking ( >= 1 )
+ *
+ *  @return line_ndx            The line the message starts on
+ *                              ( line_count = no more messages )
+ *
+ *  @note
+ *      The lines of a mapped file end with a '\0', so a line starts after
+ *      a '\0'.  Every line that starts with 'F' ("From ", "From - ") or
+ *      'P' ("Path: ", "PGO-ID:") is checked with email_is_start( ).  With
+ *      SSE2 sixteen bytes are scanned at a time.  A message whose first
+ *      line is indented is not found, its part just gets bigger.
+ *
+ ****************************************************************************/
+
+int
+IMPORT__next_message(
+    struct  import_map_t    *   import_map_p,
+    int                         line_ndx
+    )
+{
+    /**
+     *  @param  data_p          Scan position                               */
+    char                    *   data_p;
+    /**
+     *  @param  end_p           End of the file                             */
+    char                    *   end_p;
+    /**
+     *  @param  found_ndx       The line at the scan position               */
+    int                         found_ndx;
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+    //  Past the end of the file ?
+    if ( line_ndx >= import_map_p->line_count )
+    {
+        //  YES:    No more messages
+        return( import_map_p->line_count );
+    }
+
+    //  The first line has nothing in front of it
+    if ( line_ndx < 1 )
+    {
+        line_ndx = 1;
+    }
+
+    //  Scan from the start of the line to the end of the file
+    data_p = import_map_p->base_p + import_map_p->line_p[ line_ndx ].offset;
+    end_p  = import_map_p->base_p + import_map_p->map_l - 1;
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    while ( data_p < end_p )
+    {
+#if defined( __SSE2__ )
+        {
+            /**
+             *  @param  data    Sixteen bytes of the file                   */
+            __m128i             data;
+            /**
+             *  @param  start   Bytes that follow a '\0'                    */
+            __m128i             start;
+            /**
+             *  @param  hit     Line starts with 'F' or 'P'                 */
+            int                 hit;
+
+            //  Skip to the next 'F' or 'P' at the start of a line
+            for ( ; data_p + 16 <= end_p; data_p += 16 )
+            {
+                data  = _mm_loadu_si128( (__m128i *)data_p );
+                start = _mm_cmpeq_epi8( _mm_loadu_si128( (__m128i *)( data_p - 1 ) ),
+                                        _mm_setzero_si128( ) );
+                hit   = _mm_movemask_epi8(
+                            _mm_and_si128( start,
+                                _mm_or_si128( _mm_cmpeq_epi8( data, _mm_set1_epi8( 'F' ) ),
+                                              _mm_cmpeq_epi8( data, _mm_set1_epi8( 'P' ) ) ) ) );
+
+                //  Anything in these sixteen bytes ?
+                if ( hit != 0 )
+                {
+                    //  YES:    Go and look at it
+                    data_p += __builtin_ctz( hit );
+                    break;
+                }
+            }
+        }
+#endif
+
+        //  Could this line start a message ?
+        if (    ( data_p      <  end_p )
+             && ( data_p[ -1 ] == '\0' )
+             && (    ( data_p[ 0 ] == 'F' )
+                  || ( data_p[ 0 ] == 'P' ) ) )
+        {
+            //  YES:    Is it really the start of a line (not a NUL byte) ?
+            found_ndx = IMPORT__line_at( import_map_p,
+                                         data_p - import_map_p->base_p );
+
+            if (    ( found_ndx < import_map_p->line_count )
+                 && (    import_map_p->line_p[ found_ndx ].offset
+                      == (size_t)( data_p - import_map_p->base_p ) )
+                 && ( email_is_start( data_p ) == true ) )
+            {
+                //  YES:    Found it
+                return( found_ndx );
+            }
+        }
+
+        //  Next byte
+        data_p += 1;
+    }
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+    return( import_map_p->line_count );
+}
+
+/****************************************************************************/
+/**
+ *  Split a big mapped mailbox between the EMAIL threads.
+ *
+ *  @param  rcb_p               Pointer to the file's Recipe Control Block
+ *
+ *  @return split               TRUE when the parts were sent to EMAIL (which
+ *                              now owns the file RCB), else FALSE and the
+ *                              caller sends the whole file.
+ *
+ *  @note
+ *      Each part is about import_split_bytes long and ends where the next
+ *      e-Mail message starts, so the EMAIL threads can split the parts into
+ *      recipes at the same time without sharing any state.  The parts
+ *      share the mapping and number their recipes from the file RCB.  The
+ *      file RCB is killed with its last part (rcb_kill( )), which is when
+ *      all of its recipes have been numbered.
+ *
+ ****************************************************************************/
+
+int
+IMPORT__split(
+    struct  rcb_t           *   rcb_p
+    )
+{
+    /**
+     *  @param  import_map_p    The mapping                                 */
+    struct  import_map_t    *   import_map_p;
+    /**
+     *  @param  part_list_p     The parts                                   */
+    struct  list_base_t     *   part_list_p;
+    /**
+     *  @param  part_p          RCB for one part of the file                */
+    struct  rcb_t           *   part_p;
+    /**
+     *  @param  line_first      First line of a part                        */
+    int                         line_first;
+    /**
+     *  @param  line_end        Line after the last line of a part          */
+    int                         line_end;
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+    import_map_p = rcb_p->import_map_p;
+
+    //  Is it a mapped file worth splitting ?
+    if (    ( import_split_bytes == 0                  )
+         || ( import_map_p       == NULL               )
+         || ( import_map_p->map_l <= import_split_bytes ) )
+    {
+        //  NO:     Send it the usual way
+        return( false );
+    }
+
+    //  Where does the first part end ?
+    line_end = IMPORT__next_message( import_map_p,
+                                     IMPORT__line_at( import_map_p,
+                                                      import_split_bytes ) );
+
+    //  Is the whole file one part ?
+    if ( line_end >= import_map_p->line_count )
+    {
+        //  YES:    Nothing to split
+        return( false );
+    }
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    //  Build all of the parts
+    part_list_p = list_new( );
+
+    for ( line_first = 0;
+          line_first < import_map_p->line_count;
+          line_first = line_end )
+    {
+        //  Where does this part end ?
+        if ( line_first != 0 )
+        {
+            line_end = IMPORT__next_message( import_map_p,
+                            IMPORT__line_at( import_map_p,
+                                               import_map_p->line_p[ line_first ].offset
+                                             + import_split_bytes ) );
+        }
+
+        //  A new RCB for the part (with the file's information)
+        part_p = rcb_new( NULL );
+        part_p->tcb_p = rcb_p->tcb_p;
+        rcb_info_share( part_p, rcb_p );
+
+        //  Its lines are in the file's mapping
+        part_p->import_map_p = import_map_p;
+        import_map_hold( import_map_p );
+        part_p->line_first   = line_first;
+        part_p->line_end     = line_end;
+        part_p->file_rcb_p   = rcb_p;
+
+        list_put_last( part_list_p, part_p );
+    }
+
+    //  Every part must be counted before the first one can finish
+    rcb_p->part_count = list_query_count( part_list_p );
+
+    log_write( MID_DEBUG_0, "import",
+               "Split '%s' into %d parts.\n",
+               rcb_p->file_path, rcb_p->part_count );
+
+    __atomic_add_fetch( &import_split_count, 1, __ATOMIC_RELAXED );
+    __atomic_add_fetch( &import_split_parts, rcb_p->part_count,
+                        __ATOMIC_RELAXED );
+
+    //  Send them to EMAIL
+    while ( ( part_p = list_get_first( part_list_p ) ) != NULL )
+    {
+        list_delete_payload( part_list_p, part_p );
+        tcb_queue_put( email_tcb, part_p );
+    }
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  Clean up
+    list_kill( part_list_p );
+
+    //  DONE!
+    return( true );
+}
 /****************************************************************************/
@@ -47,6 +47,23 @@
  ****************************************************************************/
 
 //----------------------------------------------------------------------------
+#define IMPORT_LINES_INITIAL    ( 4096 )
+//-----   Streaming import: text bytes per chunk
+#define IMPORT_CHUNK_L          ( 1024 * 1024 )
+#define IMPORT_STREAM_DEFAULT   ( 64 * 1024 * 1024 )
+//-----   Archives: nesting limit and read size
+#define IMPORT_ARCHIVE_DEPTH    (    8 )
+#define IMPORT_READ_L           ( 64 * 1024 )
+//-----   Upfront binary sniffing
+#define IMPORT_SNIFF_L          ( 4096 )
+#define IMPORT_SNIFF_CTL_PCT    (    5 )
+//-----   Duplicate content detection (XXH64)
+#define IMPORT_SEEN_BUCKETS     ( 64 * 1024 )
+#define IMPORT_HASH_P1          ( 0x9E3779B185EBCA87ULL )
+#define IMPORT_HASH_P2          ( 0xC2B2AE3D27D4EB4FULL )
+#define IMPORT_HASH_P3          ( 0x165667B19E3779F9ULL )
+#define IMPORT_HASH_P4          ( 0x85EBCA77C2B2AE63ULL )
+#define IMPORT_HASH_P5          ( 0x27D4EB2F165667C5ULL )
 //----------------------------------------------------------------------------
 
 /****************************************************************************
@@ -54,6 +71,21 @@
  ****************************************************************************/
 
 //----------------------------------------------------------------------------
+/**
+ *  @param  import_sniff_e      What the first block of a file looks like   */
+enum    import_sniff_e
+{
+    IMPORT_SNIFF_TEXT       =   0,      //  Import it
+    IMPORT_SNIFF_MISSING    =   1,      //  File is gone
+    IMPORT_SNIFF_UNREADABLE =   2,      //  Can't open or read it
+    IMPORT_SNIFF_IMAGE      =   3,      //  JPEG, PNG, GIF, TIFF, WEBP, BMP
+    IMPORT_SNIFF_PDF        =   4,      //  PDF document
+    IMPORT_SNIFF_OFFICE     =   5,      //  MS-Office (OLE2 or OOXML)
+    IMPORT_SNIFF_ARCHIVE    =   6,      //  ZIP, GZIP, BZIP2, XZ, 7-ZIP, RAR
+    IMPORT_SNIFF_NUL        =   7,      //  Has a NUL byte
+    IMPORT_SNIFF_CONTROL    =   8,      //  Too many control bytes
+    IMPORT_SNIFF_MAX        =   9
+};
 //----------------------------------------------------------------------------
 
 /****************************************************************************
@@ -61,6 +93,41 @@
  ****************************************************************************/
 
 //----------------------------------------------------------------------------
+/**
+ *  @param  import_hash_t       Whole file content hash (XXH64, streamed)   */
+struct  import_hash_t
+{
+    /**
+     *  @param  acc             The four lane accumulators                  */
+    uint64_t                    acc[ 4 ];
+    /**
+     *  @param  total_l         Number of bytes hashed                      */
+    uint64_t                    total_l;
+    /**
+     *  @param  mem             Bytes waiting for a full 32 byte stripe     */
+    unsigned char               mem[ 32 ];
+    /**
+     *  @param  mem_l           Number of bytes in mem                      */
+    int                         mem_l;
+};
+//----------------------------------------------------------------------------
+/**
+ *  @param  import_seen_t       Content that has already been imported      */
+struct  import_seen_t
+{
+    /**
+     *  @param  next_p          Next entry in the hash chain                */
+    struct  import_seen_t   *   next_p;
+    /**
+     *  @param  hash            Content hash                                */
+    uint64_t                    hash;
+    /**
+     *  @param  file_l          Content length                              */
+    uint64_t                    file_l;
+    /**
+     *  @param  file_path_p     The first file with this content            */
+    char                    *   file_path_p;
+};
 //----------------------------------------------------------------------------
 
 /****************************************************************************
@@ -70,6 +137,43 @@
 //----------------------------------------------------------------------------
 IMPORT_EXT
 int                             import_lib;
+/**
+ *  @param  import_sniff_count  Files per sniff result (ATOMIC access)      */
+IMPORT_EXT
+int                             import_sniff_count[ IMPORT_SNIFF_MAX ];
+/**
+ *  @param  import_member_count Archive members imported (ATOMIC access)    */
+IMPORT_EXT
+int                             import_member_count;
+/**
+ *  @param  import_member_skip  Archive members skipped (ATOMIC access)     */
+IMPORT_EXT
+int                             import_member_skip;
+/**
+ *  @param  import_dup_count    Duplicate files skipped (ATOMIC access)     */
+IMPORT_EXT
+int                             import_dup_count;
+/**
+ *  @param  import_dup_bytes    Bytes not decoded again (ATOMIC access)     */
+IMPORT_EXT
+uint64_t                        import_dup_bytes;
+/**
+ *  @param  import_split_count  Files split at message boundaries (ATOMIC)  */
+IMPORT_EXT
+int                             import_split_count;
+/**
+ *  @param  import_split_parts  Parts the split files became (ATOMIC)       */
+IMPORT_EXT
+int                             import_split_parts;
+/**
+ *  @param  import_scan_count   Text files scanned for recipe markers
+ *                              (ATOMIC access)                             */
+IMPORT_EXT
+int                             import_scan_count;
+/**
+ *  @param  import_scan_skip    Text files without a recipe marker (ATOMIC) */
+IMPORT_EXT
+int                             import_scan_skip;
 //----------------------------------------------------------------------------
 
 /****************************************************************************
@@ -77,6 +181,103 @@ int                             import_lib;
  ****************************************************************************/
 
 //----------------------------------------------------------------------------
+struct  import_map_t    *
+IMPORT__map(
+    char                    *   file_name_p,
+    struct  import_hash_t   *   hash_p
+    );
+//----------------------------------------------------------------------------
+int
+IMPORT__control_count(
+    unsigned char           *   data_p,
+    int                         data_l,
+    int                     *   nul_p
+    );
+//----------------------------------------------------------------------------
+void
+IMPORT__stream(
+    struct  rcb_t           *   rcb_p,
+    char                    *   file_name_p
+    );
+//----------------------------------------------------------------------------
+void
+IMPORT__member(
+    struct  rcb_t           *   rcb_p,
+    struct  archive_t       *   archive_p,
+    char                    *   member_path_p,
+    unsigned char           *   data_p,
+    int                         data_l
+    );
+//----------------------------------------------------------------------------
+void
+IMPORT__unpack(
+    struct  rcb_t           *   rcb_p,
+    struct  archive_t       *   archive_p,
+    char                    *   archive_path_p,
+    int                         depth
+    );
+//----------------------------------------------------------------------------
+int
+IMPORT__archive(
+    struct  rcb_t           *   rcb_p,
+    char                    *   file_name_p
+    );
+//----------------------------------------------------------------------------
+enum    import_sniff_e
+IMPORT__sniff_data(
+    unsigned char           *   data,
+    int                         data_l
+    );
+//----------------------------------------------------------------------------
+enum    import_sniff_e
+IMPORT__sniff(
+    char                    *   file_name_p
+    );
+//----------------------------------------------------------------------------
+void
+IMPORT__hash_init(
+    struct  import_hash_t   *   hash_p
+    );
+//----------------------------------------------------------------------------
+void
+IMPORT__hash_update(
+    struct  import_hash_t   *   hash_p,
+    unsigned char           *   data_p,
+    size_t                      data_l
+    );
+//----------------------------------------------------------------------------
+uint64_t
+IMPORT__hash_final(
+    struct  import_hash_t   *   hash_p
+    );
+//----------------------------------------------------------------------------
+int
+IMPORT__duplicate(
+    struct  rcb_t           *   rcb_p,
+    struct  import_hash_t   *   hash_p
+    );
+//----------------------------------------------------------------------------
+int
+IMPORT__line_at(
+    struct  import_map_t    *   import_map_p,
+    size_t                      offset
+    );
+//----------------------------------------------------------------------------
+int
+IMPORT__next_message(
+    struct  import_map_t    *   import_map_p,
+    int                         line_ndx
+    );
+//----------------------------------------------------------------------------
+int
+IMPORT__split(
+    struct  rcb_t           *   rcb_p
+    );
+//----------------------------------------------------------------------------
+char    *
+IMPORT__sniff_name(
+    enum    import_sniff_e      sniff
+    );
 //----------------------------------------------------------------------------
 
 /****************************************************************************/
@@ -0,0 +1,131 @@
+/*******************************  COPYRIGHT  ********************************/
+/**
+ *  Author? "Gregory N. Leonhardt"
+ *  License? "CC BY-NC 2.0"
+ *           "https://creativecommons.org/licenses/by-nc/2.0/"
+ *
+ ****************************************************************************/
+
+#ifndef ARCHIVE_API_H
+#define ARCHIVE_API_H
+
+/******************************** JAVADOC ***********************************/
+/**
+ *  This file contains public definitions (etc.) that apply to external
+ *  library components of the 'archive' library.
+ *
+ *  @note
+ *      An archive is read front to back as a stream of members.  A ZIP
+ *      file has one member per entry, a GZIP, BZIP2 or XZ file has exactly
+ *      one member.  Nothing is ever written to disk.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ *  Compiler directives
+ ****************************************************************************/
+
+
+/****************************************************************************
+ * System APIs
+ ****************************************************************************/
+
+                                //*******************************************
+#include <sys/types.h>          //  ssize_t
+                                //*******************************************
+
+/****************************************************************************
+ * Application APIs
+ ****************************************************************************/
+
+                                //*******************************************
+                                //*******************************************
+
+/****************************************************************************
+ * Library Public Definitions
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Library Public Enumerations
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+/**
+ *  @param  archive_type_e      Archive formats that can be read            */
+enum    archive_type_e
+{
+    ARCHIVE_TYPE_NONE       =   0,      //  Not an archive (that we can read)
+    ARCHIVE_TYPE_ZIP        =   1,      //  PKZIP
+    ARCHIVE_TYPE_GZIP       =   2,      //  GNU zip
+    ARCHIVE_TYPE_BZIP2      =   3,      //  bzip2
+    ARCHIVE_TYPE_XZ         =   4       //  xz (LZMA2)
+};
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Library Public Structures
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+/**
+ *  @param  archive_t           An open archive ( see archive_lib.h )       */
+struct  archive_t;
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Library Public Storage Allocation
+ ****************************************************************************/
+
+//---------------------------------------------------------------------------
+//---------------------------------------------------------------------------
+
+/****************************************************************************
+ * Library Public Prototypes
+ ****************************************************************************/
+
+//---------------------------------------------------------------------------
+enum    archive_type_e
+archive_type(
+    unsigned char           *   data_p,
+    int                         data_l
+    );
+//---------------------------------------------------------------------------
+struct  archive_t       *
+archive_open(
+    char                    *   file_name_p
+    );
+//---------------------------------------------------------------------------
+struct  archive_t       *
+archive_open_member(
+    struct  archive_t       *   parent_p,
+    char                    *   member_name_p,
+    unsigned char           *   data_p,
+    int                         data_l
+    );
+//---------------------------------------------------------------------------
+int
+archive_next(
+    struct  archive_t       *   archive_p,
+    char                    *   member_name_p,
+    int                         member_name_l
+    );
+//---------------------------------------------------------------------------
+ssize_t
+archive_read(
+    struct  archive_t       *   archive_p,
+    void                    *   data_p,
+    size_t                      data_l
+    );
+//---------------------------------------------------------------------------
+void
+archive_close(
+    struct  archive_t       *   archive_p
+    );
+//---------------------------------------------------------------------------
+
+/****************************************************************************/
+
+#endif                      //    ARCHIVE_API_H
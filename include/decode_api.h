@@ -60,6 +60,10 @@
 #define CATEGORY                "Category:"
 #define CATEGORY_L              strlen( CATEGORY )
 //----------------------------------------------------------------------------
+#define DECODE_FORMAT_MAX       ( RECIPE_FORMAT_TXT + 1 )
+//----------------------------------------------------------------------------
+#define DECODE_FORMAT_KEYS      (    2 )
+//----------------------------------------------------------------------------
 
 /****************************************************************************
  * Library Public Enumerations
@@ -73,6 +77,38 @@
  ****************************************************************************/
 
 //----------------------------------------------------------------------------
+/**
+ *  @param  decode_format_t     Everything needed to find & decode a format */
+struct  decode_format_t
+{
+    /**
+     *  @param  recipe_format   The format                                  */
+    enum    recipe_format_e     recipe_format;
+    /**
+     *  @param  name_p          Short name ( "MMF" )                        */
+    char                    *   name_p;
+    /**
+     *  @param  is_start_p      Test for the start of a recipe (or NULL)    */
+    int                     ( * is_start_p )( char * );
+    /**
+     *  @param  is_end_p        Test for the end of a recipe (or NULL)      */
+    int                     ( * is_end_p )( char * );
+    /**
+     *  @param  decode_p        Decode a recipe (NULL = not available)      */
+    void                    ( * decode_p )( struct rcb_t * );
+    /**
+     *  @param  start_first_p   Every first non-blank character that can
+     *                          begin a start marker                        */
+    char                    *   start_first_p;
+    /**
+     *  @param  end_first_p     Every first non-blank character that can
+     *                          begin an end marker                         */
+    char                    *   end_first_p;
+    /**
+     *  @param  key_list        Lower case text that every start marker
+     *                          contains at least one of                    */
+    char                    *   key_list[ DECODE_FORMAT_KEYS ];
+};
 //----------------------------------------------------------------------------
 
 /****************************************************************************
@@ -80,6 +116,22 @@
  ****************************************************************************/
 
 //---------------------------------------------------------------------------
+/**
+ *  @param  mmf_format          Meal-Master                                 */
+extern
+struct  decode_format_t         mmf_format;
+/**
+ *  @param  mxp_format          MasterCook eXport                           */
+extern
+struct  decode_format_t         mxp_format;
+/**
+ *  @param  bof_format          Big-Oven                                    */
+extern
+struct  decode_format_t         bof_format;
+/**
+ *  @param  rxf_format          Recipe eXchange Format                      */
+extern
+struct  decode_format_t         rxf_format;
 //---------------------------------------------------------------------------
 
 /****************************************************************************
@@ -92,6 +144,11 @@ decode_wbt(
     void
     );
 //---------------------------------------------------------------------------
+void
+decode_benchmark(
+    void
+    );
+//---------------------------------------------------------------------------
 char  *
 decode_fmt_datetime(
     char                    *   src_datetime_p
@@ -145,6 +202,17 @@ decode_save_chapter(
     struct   recipe_t       *   recipe_p
     );
 //---------------------------------------------------------------------------
+struct  decode_format_t     *
+decode_format(
+    enum    recipe_format_e     recipe_format
+    );
+//---------------------------------------------------------------------------
+void
+decode_rcb(
+    struct  tcb_t           *   tcb_p,
+    void                    *   void_p
+    );
+//---------------------------------------------------------------------------
 void
 decode(
     void                    *   void_p
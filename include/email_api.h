@@ -59,6 +59,10 @@
  * Library Public Structures
  ****************************************************************************/
 
+//----------------------------------------------------------------------------
+/**
+ *  @param  email_ctx_t         Parse state for one e-Mail file (PRIVATE)   */
+struct  email_ctx_t;
 //----------------------------------------------------------------------------
 struct  email_info_t
 {
@@ -105,21 +109,25 @@ email_is_start(
 //---------------------------------------------------------------------------
 enum    boundary_type_e
 email_is_boundary(
+    struct  email_ctx_t         *   ctx_p,
     char                        *   data_p
     );
 //---------------------------------------------------------------------------
 enum    boundary_type_e
 email_is_boundary_identifier(
+    struct  email_ctx_t         *   ctx_p,
     char                        *   data_p
     );
 //---------------------------------------------------------------------------
 int
 email_is_multipart_break(
+    struct  email_ctx_t         *   ctx_p,
     char                        *   data_p
     );
 //---------------------------------------------------------------------------
 int
 email_is_group_break(
+    struct  email_ctx_t         *   ctx_p,
     char                        *   data_p
     );
 //---------------------------------------------------------------------------
@@ -155,19 +163,37 @@ email_find_subject(
 //---------------------------------------------------------------------------
 int
 email_filter(
+    struct  email_ctx_t         *   ctx_p,
     char                        *   data_p
     );
 //---------------------------------------------------------------------------
 int
 email_is_group_break(
+    struct  email_ctx_t         *   ctx_p,
     char                        *   data_p
     );
 //---------------------------------------------------------------------------
 void
+email_rcb(
+    struct  tcb_t           *   tcb_p,
+    void                    *   void_p
+    );
+//---------------------------------------------------------------------------
+void
 email(
     void                    *   void_p
     );
 //---------------------------------------------------------------------------
+void
+email_benchmark(
+    void
+    );
+//---------------------------------------------------------------------------
+int
+email_wbt(
+    void
+    );
+//---------------------------------------------------------------------------
 
 /****************************************************************************/
 
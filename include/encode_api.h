@@ -71,6 +71,12 @@
 
 //---------------------------------------------------------------------------
 void
+encode_rcb(
+    struct  tcb_t           *   tcb_p,
+    void                    *   void_p
+    );
+//---------------------------------------------------------------------------
+void
 encode(
     void                    *   void_p
     );
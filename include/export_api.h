@@ -71,6 +71,12 @@
 
 //---------------------------------------------------------------------------
 void
+export_rcb(
+    struct  tcb_t           *   tcb_p,
+    void                    *   void_p
+    );
+//---------------------------------------------------------------------------
+void
 export(
     void                    *   void_p
     );
@@ -56,19 +56,25 @@
 #define THREAD_NAME_DECODE      "DECODE:"
 #define THREAD_NAME_ENCODE      "ENCODE:"
 #define THREAD_NAME_EXPORT      "EXPORT:"
-//-----
+//-----   Default worker threads per group     (-{group}_threads {n|auto})
 #define THREAD_COUNT_IMPORT     (    1 )
 #define THREAD_COUNT_EMAIL      (    1 )
 #define THREAD_COUNT_DECODE     (    1 )
 #define THREAD_COUNT_ENCODE     (    1 )
 #define THREAD_COUNT_EXPORT     (    1 )
+#define THREAD_COUNT_WALK       (    4 )
 //----------------------------------------------------------------------------
 #define MAX_QUEUE_DEPTH         (    0 )
 #define QUEUE_DEPTH_IMPORT      (    1 )
 #define QUEUE_DEPTH_EMAIL       (    1 )
-#define QUEUE_DEPTH_DECODE      (    1 )
-#define QUEUE_DEPTH_ENCODE      (   10 )
+//-----   Batched handoff: room for two batches     (TCB_BATCH_MAX)
+#define QUEUE_DEPTH_DECODE      (   64 )
+#define QUEUE_DEPTH_ENCODE      (   64 )
 #define QUEUE_DEPTH_EXPORT      (  100 )
+//-----   Stage queues: ( 1 ) = ring buffer, ( 0 ) = libtools queue
+#define QUEUE_RING              (    1 )
+//-----   Strict output order: files in flight past the oldest   (-ordered)
+#define ORDER_DEPTH_FILES       (   16 )
 //----------------------------------------------------------------------------
 
 /****************************************************************************
@@ -142,14 +148,14 @@ MAIN_EXT
 struct  tcb_t           *   export_tcb;
 //---------------------------------------------------------------------------
 /**
- *  @param  store_value_p       ID number for the DECODE queue              */
+ *  @param  recipe_id_count     Last ID number handed out (ATOMIC access)   */
 MAIN_EXT
-char                    *   recipe_id_p;
+int                         recipe_id_count;
 //----------------------------------------------------------------------------
 /**
- *  @param  file_list           Pointer to a list of files                  */
+ *  @param  file_count          Files queued to IMPORT so far (ATOMIC)      */
 MAIN_EXT
-struct  list_base_t         *   file_list_p;
+int                             file_count;
 //----------------------------------------------------------------------------
 /**
  * @param in_file_name_p        Pointer to the input file name              */
@@ -171,6 +177,20 @@ char                        *   out_dir_name_p;
 MAIN_EXT
 int                             delete_flag;
 //----------------------------------------------------------------------------
+/**
+ * @param import_mmap           Memory map the input files when true        */
+MAIN_EXT
+int                             import_mmap;
+/**
+ * @param import_stream_budget  Streamed bytes allowed in flight (0 = off)  */
+MAIN_EXT
+size_t                          import_stream_budget;
+/**
+ * @param import_split_bytes    Split mapped files bigger than this between
+ *                              the EMAIL threads ( 0 = off )               */
+MAIN_EXT
+size_t                          import_split_bytes;
+//----------------------------------------------------------------------------
 
 /****************************************************************************
  * Global Prototypes
@@ -15,6 +15,12 @@
  *  library components of the 'import' library.
  *
  *  @note
+ *      With -mmap the input file is memory mapped instead of being read a
+ *      line at a time.  Every line end is replaced by a '\0' in the (copy
+ *      on write) mapping, which copies about every page of the file, and
+ *      an index of ( offset, length ) records is kept in an import_map_t.  Lines are handed down the pipeline as pointers
+ *      into the mapping, so they must be released with import_line_free( )
+ *      and never with mem_free( ).
  *
  ****************************************************************************/
 
@@ -28,6 +34,7 @@
  ****************************************************************************/
 
                                 //*******************************************
+#include <stddef.h>             //  size_t
                                 //*******************************************
 
 /****************************************************************************
@@ -49,6 +56,14 @@
  ****************************************************************************/
 
 //----------------------------------------------------------------------------
+/**
+ *  @param  import_chunk_e      Where a chunk of a streamed file ends       */
+enum    import_chunk_e
+{
+    IMPORT_CHUNK_MORE       =   0,      //  More of the same text follows
+    IMPORT_CHUNK_MEMBER     =   1,      //  End of an archive member
+    IMPORT_CHUNK_LAST       =   2       //  End of the file
+};
 //----------------------------------------------------------------------------
 
 /****************************************************************************
@@ -56,6 +71,38 @@
  ****************************************************************************/
 
 //----------------------------------------------------------------------------
+/**
+ *  @param  import_line_t       One line in a memory mapped file            */
+struct  import_line_t
+{
+    /**
+     *  @param  offset          Offset of the line from the start of the map*/
+    size_t                      offset;
+    /**
+     *  @param  length          Line length without the CR/LF               */
+    int                         length;
+};
+//----------------------------------------------------------------------------
+/**
+ *  @param  import_map_t        A memory mapped input file                  */
+struct  import_map_t
+{
+    /**
+     *  @param  base_p          Start of the mapping                        */
+    char                    *   base_p;
+    /**
+     *  @param  map_l           Length of the mapping                       */
+    size_t                      map_l;
+    /**
+     *  @param  line_p          Line index                                  */
+    struct  import_line_t   *   line_p;
+    /**
+     *  @param  line_count      Number of lines in the index                */
+    int                         line_count;
+    /**
+     *  @param  ref_count       RCBs that still point into the mapping      */
+    int                         ref_count;
+};
 //----------------------------------------------------------------------------
 
 /****************************************************************************
@@ -71,10 +118,58 @@
 
 //---------------------------------------------------------------------------
 void
+import_rcb(
+    struct  tcb_t           *   tcb_p,
+    void                    *   void_p
+    );
+//---------------------------------------------------------------------------
+void
 import(
     void                    *   void_p
     );
 //---------------------------------------------------------------------------
+void
+import_chunk_put(
+    struct  rcb_t           *   rcb_p,
+    struct  list_base_t     *   list_p,
+    size_t                      chunk_l,
+    enum    import_chunk_e      chunk_end,
+    char                    *   file_path_p
+    );
+//---------------------------------------------------------------------------
+void
+import_chunk_done(
+    struct  rcb_t           *   rcb_p
+    );
+//---------------------------------------------------------------------------
+void
+import_report(
+    void
+    );
+//---------------------------------------------------------------------------
+char    *
+import_next_line(
+    struct  rcb_t           *   rcb_p,
+    int                     *   line_ndx_p,
+    int                         list_lock_key
+    );
+//---------------------------------------------------------------------------
+void
+import_line_free(
+    struct  rcb_t           *   rcb_p,
+    char                    *   line_p
+    );
+//---------------------------------------------------------------------------
+void
+import_map_hold(
+    struct  import_map_t    *   import_map_p
+    );
+//---------------------------------------------------------------------------
+void
+import_map_release(
+    struct  import_map_t    *   import_map_p
+    );
+//---------------------------------------------------------------------------
 
 /****************************************************************************/
 
@@ -0,0 +1,106 @@
+/*******************************  COPYRIGHT  ********************************/
+/**
+ *  Author? "Gregory N. Leonhardt"
+ *  License? "CC BY-NC 2.0"
+ *           "https://creativecommons.org/licenses/by-nc/2.0/"
+ *
+ ****************************************************************************/
+
+#ifndef MANIFEST_API_H
+#define MANIFEST_API_H
+
+/******************************** JAVADOC ***********************************/
+/**
+ *  This file contains public definitions (etc.) that apply to external
+ *  library components of the 'manifest' library.
+ *
+ *  @note
+ *      The manifest lists every input file of the last complete run with
+ *      its size, modification time and content hash.  A file that has not
+ *      changed since then is not imported again.  A new or changed file
+ *      only goes into the manifest once IMPORT has read it.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ *  Compiler directives
+ ****************************************************************************/
+
+
+/****************************************************************************
+ * System APIs
+ ****************************************************************************/
+
+                                //*******************************************
+                                //*******************************************
+
+/****************************************************************************
+ * Application APIs
+ ****************************************************************************/
+
+                                //*******************************************
+                                //*******************************************
+
+/****************************************************************************
+ * Library Public Definitions
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+#define MANIFEST_FILE_NAME      "ria.manifest"
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Library Public Enumerations
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Library Public Structures
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+/**
+ *  @param  manifest_entry_t    One input file ( see manifest_lib.h )       */
+struct  manifest_entry_t;
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Library Public Storage Allocation
+ ****************************************************************************/
+
+//---------------------------------------------------------------------------
+//---------------------------------------------------------------------------
+
+/****************************************************************************
+ * Library Public Prototypes
+ ****************************************************************************/
+
+//---------------------------------------------------------------------------
+void
+manifest_init(
+    char                    *   manifest_name_p,
+    int                         rebuild
+    );
+//---------------------------------------------------------------------------
+int
+manifest_unchanged(
+    struct  file_info_t     *   file_info_p,
+    struct  manifest_entry_t **  entry_pp
+    );
+//---------------------------------------------------------------------------
+void
+manifest_imported(
+    struct  manifest_entry_t *  entry_p
+    );
+//---------------------------------------------------------------------------
+void
+manifest_save(
+    void
+    );
+//---------------------------------------------------------------------------
+
+/****************************************************************************/
+
+#endif                      //    MANIFEST_API_H
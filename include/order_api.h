@@ -0,0 +1,102 @@
+/*******************************  COPYRIGHT  ********************************/
+/**
+ *  Author? "Gregory N. Leonhardt"
+ *  License? "CC BY-NC 2.0"
+ *           "https://creativecommons.org/licenses/by-nc/2.0/"
+ *
+ ****************************************************************************/
+
+#ifndef ORDER_API_H
+#define ORDER_API_H
+
+/******************************** JAVADOC ***********************************/
+/**
+ *  This file contains public definitions (etc.) that apply to external
+ *  library components of the 'order' library.
+ *
+ *  @note
+ *      Every input file gets a sequence number when main( ) queues it and
+ *      every recipe cloned from it gets the next recipe number for that
+ *      file.  When strict ordering is on, finished recipes are held until
+ *      every recipe ahead of them has been released or discarded so the
+ *      output order matches a single threaded run.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ *  Compiler directives
+ ****************************************************************************/
+
+
+/****************************************************************************
+ * System APIs
+ ****************************************************************************/
+
+                                //*******************************************
+                                //*******************************************
+
+/****************************************************************************
+ * Application APIs
+ ****************************************************************************/
+
+                                //*******************************************
+                                //*******************************************
+
+/****************************************************************************
+ * Library Public Definitions
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Library Public Enumerations
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Library Public Structures
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Library Public Storage Allocation
+ ****************************************************************************/
+
+//---------------------------------------------------------------------------
+//---------------------------------------------------------------------------
+
+/****************************************************************************
+ * Library Public Prototypes
+ ****************************************************************************/
+
+//---------------------------------------------------------------------------
+void
+order_init(
+    int                         max_files
+    );
+//---------------------------------------------------------------------------
+int
+order_next_file(
+    void
+    );
+//---------------------------------------------------------------------------
+void
+order_release(
+    struct  rcb_t           *   rcb_p,
+    void                    ( * release_p )( struct rcb_t * )
+    );
+//---------------------------------------------------------------------------
+void
+order_discard(
+    struct  rcb_t           *   rcb_p
+    );
+//---------------------------------------------------------------------------
+
+/****************************************************************************/
+
+#endif                      //    ORDER_API_H
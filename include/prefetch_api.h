@@ -0,0 +1,98 @@
+/*******************************  COPYRIGHT  ********************************/
+/**
+ *  Author? "Gregory N. Leonhardt"
+ *  License? "CC BY-NC 2.0"
+ *           "https://creativecommons.org/licenses/by-nc/2.0/"
+ *
+ ****************************************************************************/
+
+#ifndef PREFETCH_API_H
+#define PREFETCH_API_H
+
+/******************************** JAVADOC ***********************************/
+/**
+ *  This file contains public definitions (etc.) that apply to external
+ *  library components of the 'prefetch' library.
+ *
+ *  @note
+ *      The prefetcher reads the next few input files into the page cache
+ *      while IMPORT is still busy with the current one.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ *  Compiler directives
+ ****************************************************************************/
+
+
+/****************************************************************************
+ * System APIs
+ ****************************************************************************/
+
+                                //*******************************************
+                                //*******************************************
+
+/****************************************************************************
+ * Application APIs
+ ****************************************************************************/
+
+                                //*******************************************
+                                //*******************************************
+
+/****************************************************************************
+ * Library Public Definitions
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Library Public Enumerations
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Library Public Structures
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Library Public Storage Allocation
+ ****************************************************************************/
+
+//---------------------------------------------------------------------------
+//---------------------------------------------------------------------------
+
+/****************************************************************************
+ * Library Public Prototypes
+ ****************************************************************************/
+
+//---------------------------------------------------------------------------
+void
+prefetch_init(
+    int                         depth
+    );
+//---------------------------------------------------------------------------
+int
+prefetch_file(
+    char                    *   file_name_p
+    );
+//---------------------------------------------------------------------------
+void
+prefetch_done(
+    void
+    );
+//---------------------------------------------------------------------------
+void
+prefetch_report(
+    void
+    );
+//---------------------------------------------------------------------------
+
+/****************************************************************************/
+
+#endif                      //    PREFETCH_API_H
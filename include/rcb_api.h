@@ -42,6 +42,7 @@
  ****************************************************************************/
 
 //----------------------------------------------------------------------------
+#define RCB_FILE_PATH_L         ( FILENAME_MAX )
 //----------------------------------------------------------------------------
 
 /****************************************************************************
@@ -67,14 +68,45 @@ struct  rcb_t
      *  @param  file_info_p     Pointer to a file information structure     */
     struct  file_info_t     *   file_info_p;
     /**
-     *  @param  file_path       File path & name                            */
-    char                        file_path[ FILENAME_MAX ];
+     *  @param  file_path       File path & name ( RCB_FILE_PATH_L )        */
+    char                    *   file_path;
     /**
      *  @param  destination     Destination Thread                          */
     enum    destination_e       dst_thread;
     /**
      * @param import_list_p     Pointer to a list for import data           */
     struct  list_base_t     *   import_list_p;
+    /**
+     * @param import_map_p      Memory mapped input file ( NULL = none )    */
+    struct  import_map_t    *   import_map_p;
+    /**
+     * @param chunk_l           Bytes in this chunk ( 0 = not streamed )    */
+    size_t                      chunk_l;
+    /**
+     * @param chunk_eof         TRUE = the chunk ends the text (the file or
+     *                          an archive member)                          */
+    int                         chunk_eof;
+    /**
+     * @param chunk_last        TRUE = the chunk ends the file              */
+    int                         chunk_last;
+    /**
+     * @param chunk_busy        TRUE = EMAIL has not finished the chunk     */
+    int                         chunk_busy;
+    /**
+     * @param email_ctx_p       e-Mail split state kept between chunks      */
+    struct  email_ctx_t     *   email_ctx_p;
+    /**
+     * @param line_first        First line of a split part of a mapped file */
+    int                         line_first;
+    /**
+     * @param line_end          Line after a split part ( 0 = end of file ) */
+    int                         line_end;
+    /**
+     * @param file_rcb_p        File RCB of a split part ( NULL = not split)*/
+    struct  rcb_t           *   file_rcb_p;
+    /**
+     * @param part_count        Split parts not finished yet (ATOMIC access)*/
+    int                         part_count;
     /**
      * @param export_list_p     Pointer to a list for export data           */
     struct  list_base_t     *   export_list_p;
@@ -87,12 +119,36 @@ struct  rcb_t
     /**
      *  @param  email_info_p    e-Mail from, date, time etc                 */
     struct  email_info_t    *   email_info_p;
+    /**
+     *  @param  info_p          Where file_info_p, email_info_p and
+     *                          file_path point (shared with the file and
+     *                          the other recipes from the same message)    */
+    struct  rcb_info_t      *   info_p;
     /**
      *  @param  recipe_format   Format code for this recipe                 */
     enum    recipe_format_e     recipe_format;
     /**
      *  @param  db_recipe_p     Pointer to the database recipe buffer       */
     char                    *   db_recipe_p;
+    /**
+     *  @param  file_seq        Input file sequence number ( 0 = none )     */
+    int                         file_seq;
+    /**
+     *  @param  recipe_seq      Recipe number in the file  ( 0 = the file ) */
+    int                         recipe_seq;
+    /**
+     *  @param  recipe_count    Number of recipes cloned from this file     */
+    int                         recipe_count;
+    /**
+     *  @param  order_released  TRUE once the reorder buffer let it go      */
+    int                         order_released;
+    /**
+     *  @param  prefetched      TRUE = the file is being read ahead         */
+    int                         prefetched;
+    /**
+     *  @param  manifest_p      Manifest entry to confirm once the file is
+     *                          read ( NULL = none )                        */
+    struct  manifest_entry_t *  manifest_p;
 };
 //----------------------------------------------------------------------------
 
@@ -117,6 +173,17 @@ struct  rcb_t   *
 rcb_new(
     struct  rcb_t           *   rcb_p
     );
+//---------------------------------------------------------------------------
+void
+rcb_info_share(
+    struct  rcb_t           *   rcb_p,
+    struct  rcb_t           *   from_rcb_p
+    );
+//---------------------------------------------------------------------------
+void
+rcb_info_own(
+    struct  rcb_t           *   rcb_p
+    );
 //----------------------------------------------------------------------------
 
 /****************************************************************************/
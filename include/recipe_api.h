@@ -94,6 +94,16 @@ enum    direction_state_e
     DSS_COMPLETE                =   2
 };
 //----------------------------------------------------------------------------
+enum    mxp_note_state_e
+{
+    MXP_NS_IDLE                 =    0,
+    MXP_NS_PER_SERVING          =    1,
+    MXP_NS_WINE                 =    2,
+    MXP_NS_SERVING_IDEAS        =    3,
+    MXP_NS_NOTES                =    4,
+    MXP_NS_NUTR_ASSOC           =    5
+};
+//----------------------------------------------------------------------------
 
 /****************************************************************************
  * Library Public Structures
@@ -231,6 +241,24 @@ struct   recipe_t
     /**
      *  @param  direction_scan_state                                        */
     enum    direction_state_e   direction_scan_state;
+    /**
+     *  @param  note_scan_state MXP: which notes section is being read      */
+    enum    mxp_note_state_e    note_scan_state;
+    /**
+     *  @param  notes_parsing   RXF: set TRUE when parsing the notes        */
+    int                         notes_parsing;
+    /**
+     *  @param  notes_fwos      Notes: First Word of Sentence               */
+    int                         notes_fwos;
+    /**
+     *  @param  notes_fwol      Notes: First Word of Line                   */
+    int                         notes_fwol;
+    /**
+     *  @param  directions_fwos Directions: First Word of Sentence          */
+    int                         directions_fwos;
+    /**
+     *  @param  directions_fwol Directions: First Word of Line              */
+    int                         directions_fwol;
 };
 //----------------------------------------------------------------------------
 struct  auip_t
@@ -280,6 +308,12 @@ recipe_is_end(
     char                    *   data_p
     );
 //---------------------------------------------------------------------------
+int
+recipe_scan(
+    char                    *   data_p,
+    size_t                      data_l
+    );
+//---------------------------------------------------------------------------
 
 /****************************************************************************/
 
@@ -0,0 +1,202 @@
+/*******************************  COPYRIGHT  ********************************/
+/**
+ *  Author? "Gregory N. Leonhardt"
+ *  License? "CC BY-NC 2.0"
+ *           "https://creativecommons.org/licenses/by-nc/2.0/"
+ *
+ ****************************************************************************/
+
+#ifndef RING_API_H
+#define RING_API_H
+
+/******************************** JAVADOC ***********************************/
+/**
+ *  This file contains public definitions (etc.) that apply to external
+ *  library components of the 'ring' library.
+ *
+ *  @note
+ *      A ring is a bounded, lock-free, multi-producer / multi-consumer
+ *      queue of payload pointers.  A NULL payload is not allowed.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ *  Compiler directives
+ ****************************************************************************/
+
+
+/****************************************************************************
+ * System APIs
+ ****************************************************************************/
+
+                                //*******************************************
+#include <stddef.h>             //  size_t
+#include <pthread.h>            //  POSIX threads
+                                //*******************************************
+
+/****************************************************************************
+ * Application APIs
+ ****************************************************************************/
+
+                                //*******************************************
+                                //*******************************************
+
+/****************************************************************************
+ * Library Public Definitions
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+#define RING_CACHE_LINE         (   64 )
+#define RING_DEPTH_DEFAULT      ( 4096 )
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Library Public Enumerations
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+/**
+ *  @param  ring_wait_e         What to do when the ring is full or empty   */
+enum    ring_wait_e
+{
+    RING_WAIT_SPIN          =   0,      //  Spin (and yield) until ready
+    RING_WAIT_BLOCK         =   1       //  Spin briefly, then sleep
+};
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Library Public Structures
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+/**
+ *  @param  ring_cell_t         One slot in the ring                        */
+struct  ring_cell_t
+{
+    /**
+     *  @param  sequence        Sequence number that owns this slot         */
+    size_t                      sequence;
+    /**
+     *  @param  payload_p       Pointer to the payload                      */
+    void                    *   payload_p;
+};
+//----------------------------------------------------------------------------
+/**
+ *  @param  ring_t              Ring Buffer Control Block                   */
+struct  ring_t
+{
+    /**
+     *  @param  mask            Number of slots - 1 (a power of two - 1)    */
+    size_t                      mask;
+    /**
+     *  @param  cell_p          The slots                                   */
+    struct  ring_cell_t     *   cell_p;
+    /**
+     *  @param  wait            Full / empty wait strategy                  */
+    enum    ring_wait_e         wait;
+    /**
+     *  @param  pad_1           Keep the producers on their own cache line  */
+    char                        pad_1[ RING_CACHE_LINE ];
+    /**
+     *  @param  put_ndx         Next sequence number to be written          */
+    size_t                      put_ndx;
+    /**
+     *  @param  pad_2           Keep the consumers on their own cache line  */
+    char                        pad_2[ RING_CACHE_LINE - sizeof( size_t ) ];
+    /**
+     *  @param  get_ndx         Next sequence number to be read             */
+    size_t                      get_ndx;
+    /**
+     *  @param  pad_3           Keep the wait state on its own cache line   */
+    char                        pad_3[ RING_CACHE_LINE - sizeof( size_t ) ];
+    /**
+     *  @param  put_waiters     Producers sleeping on a full ring           */
+    int                         put_waiters;
+    /**
+     *  @param  get_waiters     Consumers sleeping on an empty ring         */
+    int                         get_waiters;
+    /**
+     *  @param  wait_mutex      Protects the sleeping producers / consumers */
+    pthread_mutex_t             wait_mutex;
+    /**
+     *  @param  not_full        Signaled when a slot is released            */
+    pthread_cond_t              not_full;
+    /**
+     *  @param  not_empty       Signaled when a payload is added            */
+    pthread_cond_t              not_empty;
+};
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Library Public Storage Allocation
+ ****************************************************************************/
+
+//---------------------------------------------------------------------------
+//---------------------------------------------------------------------------
+
+/****************************************************************************
+ * Library Public Prototypes
+ ****************************************************************************/
+
+//---------------------------------------------------------------------------
+struct  ring_t  *
+ring_new(
+    int                         max_depth,
+    enum    ring_wait_e         wait
+    );
+//---------------------------------------------------------------------------
+void
+ring_kill(
+    struct  ring_t          *   ring_p
+    );
+//---------------------------------------------------------------------------
+int
+ring_try_put(
+    struct  ring_t          *   ring_p,
+    void                    *   payload_p
+    );
+//---------------------------------------------------------------------------
+void    *
+ring_try_get(
+    struct  ring_t          *   ring_p
+    );
+//---------------------------------------------------------------------------
+void
+ring_put(
+    struct  ring_t          *   ring_p,
+    void                    *   payload_p
+    );
+//---------------------------------------------------------------------------
+void    *
+ring_get(
+    struct  ring_t          *   ring_p
+    );
+//---------------------------------------------------------------------------
+void
+ring_put_batch(
+    struct  ring_t          *   ring_p,
+    void                    **  payload_pp,
+    int                         payload_count
+    );
+//---------------------------------------------------------------------------
+int
+ring_get_batch(
+    struct  ring_t          *   ring_p,
+    void                    **  payload_pp,
+    int                         max_count
+    );
+//---------------------------------------------------------------------------
+int
+ring_get_count(
+    struct  ring_t          *   ring_p
+    );
+//---------------------------------------------------------------------------
+void
+ring_benchmark(
+    void
+    );
+//---------------------------------------------------------------------------
+
+/****************************************************************************/
+
+#endif                      //    RING_API_H
@@ -0,0 +1,96 @@
+/*******************************  COPYRIGHT  ********************************/
+/**
+ *  Author? "Gregory N. Leonhardt"
+ *  License? "CC BY-NC 2.0"
+ *           "https://creativecommons.org/licenses/by-nc/2.0/"
+ *
+ ****************************************************************************/
+
+#ifndef SCHEDULE_API_H
+#define SCHEDULE_API_H
+
+/******************************** JAVADOC ***********************************/
+/**
+ *  This file contains public definitions (etc.) that apply to external
+ *  library components of the 'schedule' library.
+ *
+ *  @note
+ *      Holds the input files until the directory walk is finished, then
+ *      queues them largest first so a big file found late doesn't leave
+ *      one thread working long after the others are idle.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ *  Compiler directives
+ ****************************************************************************/
+
+
+/****************************************************************************
+ * System APIs
+ ****************************************************************************/
+
+                                //*******************************************
+                                //*******************************************
+
+/****************************************************************************
+ * Application APIs
+ ****************************************************************************/
+
+                                //*******************************************
+                                //*******************************************
+
+/****************************************************************************
+ * Library Public Definitions
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Library Public Enumerations
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Library Public Structures
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+/**
+ *  @param  manifest_entry_t    A manifest entry ( see manifest_lib.h )     */
+struct  manifest_entry_t;
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Library Public Storage Allocation
+ ****************************************************************************/
+
+//---------------------------------------------------------------------------
+//---------------------------------------------------------------------------
+
+/****************************************************************************
+ * Library Public Prototypes
+ ****************************************************************************/
+
+//---------------------------------------------------------------------------
+void
+schedule_add(
+    struct  file_info_t     *   file_info_p,
+    struct  manifest_entry_t *  manifest_p
+    );
+//---------------------------------------------------------------------------
+void
+schedule_run(
+    int                         worker_count,
+    uint64_t                    split_bytes,
+    void                    ( * queue_p )( struct file_info_t *,
+                                           struct manifest_entry_t * )
+    );
+//---------------------------------------------------------------------------
+
+/****************************************************************************/
+
+#endif                      //    SCHEDULE_API_H
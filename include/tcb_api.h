@@ -28,6 +28,8 @@
  ****************************************************************************/
 
                                 //*******************************************
+#include <pthread.h>            //  POSIX threads
+#include <time.h>               //  struct timespec
                                 //*******************************************
 
 /****************************************************************************
@@ -35,6 +37,7 @@
  ****************************************************************************/
 
                                 //*******************************************
+#include "ring_api.h"           //  API for all ring_*              PUBLIC
                                 //*******************************************
 
 /****************************************************************************
@@ -42,6 +45,8 @@
  ****************************************************************************/
 
 //----------------------------------------------------------------------------
+#define TCB_BATCH_MAX           (   32 )    //  Payloads per batched handoff
+#define TCB_BATCH_USEC          ( 2000 )    //  Oldest payload in a batch
 //----------------------------------------------------------------------------
 
 /****************************************************************************
@@ -55,6 +60,24 @@
  * Library Public Structures
  ****************************************************************************/
 
+//----------------------------------------------------------------------------
+/**
+ *  @param  tcb_batch_t         Payloads waiting to be handed to a group    */
+struct  tcb_batch_t
+{
+    /**
+     *  @param  group_tcb_p     Group the payloads are going to             */
+    struct  tcb_t           *   group_tcb_p;
+    /**
+     *  @param  payload_count   Number of payloads in the batch             */
+    int                         payload_count;
+    /**
+     *  @param  start_time      When the first payload was added            */
+    struct  timespec            start_time;
+    /**
+     *  @param  payload_p       The payloads                                */
+    void                    *   payload_p[ TCB_BATCH_MAX ];
+};
 //----------------------------------------------------------------------------
 /**
  *  @param  tcb                 Thread Control Block                        */
@@ -63,6 +86,9 @@ struct  tcb_t
     /**
      *  @param  queue_id        Data queue id                               */
     int                         queue_id;
+    /**
+     *  @param  ring_p          Data ring buffer (when QUEUE_RING)          */
+    struct  ring_t          *   ring_p;
     /**
      *  @param  thread_id       Identifies the thread                       */
     int                         thread_id;
@@ -72,6 +98,39 @@ struct  tcb_t
     /**
      *  @param  thread_state    State of the thread                         */
     enum    thread_stat_e       thread_state;
+    /**
+     *  @param  group_tcb_p     TCB of the group that owns the queue        */
+    struct  tcb_t           *   group_tcb_p;
+    /**
+     *  @param  group_name      Name shared by all threads in the group     */
+    char                        group_name[ THREAD_NAME_SIZE ];
+    /**
+     *  @param  thread_count    Number of worker threads in the group       */
+    int                         thread_count;
+    /**
+     *  @param  ready_count     Workers that have completed initialization  */
+    int                         ready_count;
+    /**
+     *  @param  working_count   Workers currently in the TS_WORKING state   */
+    int                         working_count;
+    /**
+     *  @param  inflight_count  Payloads queued or being worked on          */
+    int                         inflight_count;
+    /**
+     *  @param  group_mutex     Protects the group start-up signal          */
+    pthread_mutex_t             group_mutex;
+    /**
+     *  @param  group_cond      Signaled when a worker becomes ready        */
+    pthread_cond_t              group_cond;
+    /**
+     *  @param  inline_p        Work function when the group runs inline    */
+    void                    ( * inline_p )( struct tcb_t *, void * );
+    /**
+     *  @param  payload_count   Payloads this worker took off the queue     */
+    int                         payload_count;
+    /**
+     *  @param  batch           Payloads this worker is passing downstream  */
+    struct  tcb_batch_t         batch;
 };
 //----------------------------------------------------------------------------
 
@@ -99,6 +158,89 @@ tcb_new(
     int                         max_depth
     );
 //---------------------------------------------------------------------------
+struct  tcb_t   *
+tcb_new_worker(
+    struct  tcb_t           *   group_tcb_p,
+    int                         group_thread_num
+    );
+//---------------------------------------------------------------------------
+void
+tcb_set_state(
+    struct  tcb_t           *   tcb_p,
+    enum    thread_stat_e       thread_state
+    );
+//---------------------------------------------------------------------------
+void
+tcb_group_start(
+    struct  tcb_t           *   group_tcb_p,
+    void                    ( * thread_p )( void * ),
+    int                         thread_count
+    );
+//---------------------------------------------------------------------------
+void
+tcb_group_inline(
+    struct  tcb_t           *   group_tcb_p,
+    void                    ( * work_p )( struct tcb_t *, void * )
+    );
+//---------------------------------------------------------------------------
+void
+tcb_group_wait_ready(
+    struct  tcb_t           *   group_tcb_p
+    );
+//---------------------------------------------------------------------------
+int
+tcb_group_is_done(
+    struct  tcb_t           *   group_tcb_p
+    );
+//---------------------------------------------------------------------------
+void
+tcb_queue_put(
+    struct  tcb_t           *   group_tcb_p,
+    void                    *   payload_p
+    );
+//---------------------------------------------------------------------------
+void    *
+tcb_queue_get(
+    struct  tcb_t           *   tcb_p
+    );
+//---------------------------------------------------------------------------
+void
+tcb_queue_put_batch(
+    struct  tcb_t           *   group_tcb_p,
+    void                    **  payload_pp,
+    int                         payload_count
+    );
+//---------------------------------------------------------------------------
+int
+tcb_queue_get_batch(
+    struct  tcb_t           *   tcb_p,
+    void                    **  payload_pp,
+    int                         max_count
+    );
+//---------------------------------------------------------------------------
+void
+tcb_batch_put(
+    struct  tcb_t           *   tcb_p,
+    struct  tcb_t           *   group_tcb_p,
+    void                    *   payload_p
+    );
+//---------------------------------------------------------------------------
+void
+tcb_batch_flush(
+    struct  tcb_t           *   tcb_p
+    );
+//---------------------------------------------------------------------------
+int
+tcb_queue_count(
+    struct  tcb_t           *   tcb_p
+    );
+//---------------------------------------------------------------------------
+void
+tcb_wait_idle(
+    struct  tcb_t           *   group_tcb_list[ ],
+    int                         group_count
+    );
+//---------------------------------------------------------------------------
 
 /****************************************************************************/
 
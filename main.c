@@ -13,9 +13,9 @@
  *  @note
  *      Basic data flow within the program.
  *      *   main( )
- *          Scans the source directory for files and makes a list of them.
- *          One by one files are removed from the file list and queues them
- *          to one of the IMPORT threads as a job.
+ *          Walks the source directory with several threads.  Each file is
+ *          queued to one of the IMPORT threads as a job as soon as it is
+ *          found, so importing starts before the scan is finished.
  *          After all files are queued it begins to monitor its input queue.
  *          When something is detected it queries the job to determine where
  *          the job should go next and places it on the DECODE, ENCODE, or
@@ -34,6 +34,14 @@
  *      *   encode( )
  *          The job data is encoded and returned back to main with a
  *          destination of export.
+ *      With -rtc (Run-To-Completion) the EMAIL, DECODE and ENCODE groups
+ *      have no threads.  Each IMPORT thread carries its file through all
+ *      of them inline and only hands finished recipes to EXPORT.
+ *      With -ordered every file and every recipe in it is numbered and the
+ *      finished recipes pass through a reorder buffer before the export or
+ *      the database insert, so the output order does not depend on the
+ *      number of threads.  The files are numbered in the order one walker
+ *      finds them with every directory sorted by name.
  *
  ****************************************************************************/
 
@@ -51,6 +59,9 @@
 //  White Box Testing
 #define WBT                     ( 1 )
 
+//  Benchmarks
+#define BENCHMARK               ( 0 )
+
 //  Version Numbers
 #define VER_MAJ                 6
 #define VER_MIN                 8
@@ -66,6 +77,8 @@
                                 //*******************************************
 #include <unistd.h>             //  UNIX standard library.
 #include <string.h>             //  Functions for managing strings
+#include <strings.h>            //  Case insensitive string compares
+#include <stdlib.h>             //  ANSI standard library.
                                 //*******************************************
 
 /****************************************************************************
@@ -79,6 +92,12 @@
 #include "tcb_api.h"            //  API for all tcb_*               PUBLIC
 #include "rcb_api.h"            //  API for all rcb_*               PUBLIC
 #include "monitor_api.h"        //  API for all monitor_*           PUBLIC
+#include "ring_api.h"           //  API for all ring_*              PUBLIC
+#include "order_api.h"          //  API for all order_*             PUBLIC
+#include "walk_api.h"           //  API for all walk_*              PUBLIC
+#include "prefetch_api.h"       //  API for all prefetch_*          PUBLIC
+#include "manifest_api.h"       //  API for all manifest_*          PUBLIC
+#include "schedule_api.h"       //  API for all schedule_*          PUBLIC
 #include "xlate_api.h"          //  API for all xlate_*             PUBLIC
                                 //*******************************************
 #include "dbase_api.h"          //  API for all dbase_*             PUBLIC
@@ -117,6 +136,54 @@
  ****************************************************************************/
 
 //----------------------------------------------------------------------------
+/**
+ * @param threads_import        Number of IMPORT worker threads             */
+static
+int                             threads_import;
+/**
+ * @param threads_email         Number of EMAIL worker threads              */
+static
+int                             threads_email;
+/**
+ * @param threads_decode        Number of DECODE worker threads             */
+static
+int                             threads_decode;
+/**
+ * @param threads_encode        Number of ENCODE worker threads             */
+static
+int                             threads_encode;
+/**
+ * @param threads_export        Number of EXPORT worker threads             */
+static
+int                             threads_export;
+/**
+ * @param threads_walk          Number of directory walker threads          */
+static
+int                             threads_walk;
+/**
+ * @param run_to_completion     TRUE = one thread takes a file all the way  */
+static
+int                             run_to_completion;
+/**
+ * @param ordered               TRUE = output in the same order every run   */
+static
+int                             ordered;
+/**
+ * @param read_ahead            Input files to read ahead ( 0 = off )       */
+static
+int                             read_ahead;
+/**
+ * @param manifest_name_p       Input file manifest ( NULL = off )          */
+static
+char                        *   manifest_name_p;
+/**
+ * @param rebuild               TRUE = import every file, changed or not    */
+static
+int                             rebuild;
+/**
+ * @param largest_first         TRUE = queue the biggest input files first  */
+static
+int                             largest_first;
 //----------------------------------------------------------------------------
 
 /****************************************************************************
@@ -175,6 +242,56 @@ help(
                   "-if {file_name}          Input file name\n" );
     log_write( MID_INFO, "main: help",
                   "-id {directory_name}     Input directory name\n" );
+    log_write( MID_INFO, "main: help",
+                  "-import_threads {n|auto} IMPORT worker threads\n" );
+    log_write( MID_INFO, "main: help",
+                  "-email_threads {n|auto}  EMAIL worker threads\n" );
+    log_write( MID_INFO, "main: help",
+                  "-decode_threads {n|auto} DECODE worker threads\n" );
+    log_write( MID_INFO, "main: help",
+                  "-encode_threads {n|auto} ENCODE worker threads\n" );
+    log_write( MID_INFO, "main: help",
+                  "-export_threads {n|auto} EXPORT worker threads\n" );
+    log_write( MID_INFO, "main: help",
+                  "-walk_threads {n|auto}   Directory walker threads\n" );
+    log_write( MID_INFO, "main: help",
+                  "-mmap                    Memory map the input files\n" );
+    log_write( MID_INFO, "main: help",
+                  "-stream_mb {n}           Stream the input files in chunks\n" );
+    log_write( MID_INFO, "main: help",
+                  "                         with at most n MB in flight\n" );
+    log_write( MID_INFO, "main: help",
+                  "-split_mb {n}            Split mailboxes bigger than n MB\n" );
+    log_write( MID_INFO, "main: help",
+                  "                         at message boundaries between the\n" );
+    log_write( MID_INFO, "main: help",
+                  "                         EMAIL threads (implies -mmap)\n" );
+    log_write( MID_INFO, "main: help",
+                  "-prefetch {n}            Read up to n input files ahead\n" );
+    log_write( MID_INFO, "main: help",
+                  "                         of IMPORT\n" );
+    log_write( MID_INFO, "main: help",
+                  "-rtc                     Run each file to completion on one\n" );
+    log_write( MID_INFO, "main: help",
+                  "                         IMPORT thread (EMAIL, DECODE and\n" );
+    log_write( MID_INFO, "main: help",
+                  "                         ENCODE run inline)\n" );
+    log_write( MID_INFO, "main: help",
+                  "-ordered                 Export / insert recipes in the same\n" );
+    log_write( MID_INFO, "main: help",
+                  "                         order as a single threaded run\n" );
+    log_write( MID_INFO, "main: help",
+                  "-manifest {file_name}    Skip input files that have not\n" );
+    log_write( MID_INFO, "main: help",
+                  "                         changed since the last run\n" );
+    log_write( MID_INFO, "main: help",
+                  "                         (default: {od}/" MANIFEST_FILE_NAME ")\n" );
+    log_write( MID_INFO, "main: help",
+                  "-rebuild                 Import every input file\n" );
+    log_write( MID_INFO, "main: help",
+                  "-largest_first           Queue the biggest input files first\n" );
+    log_write( MID_INFO, "main: help",
+                  "                         (after the directory walk)\n" );
     log_write( MID_FATAL, "main: help",
                   "-od {directory_name}     Output directory name\n" );
 
@@ -185,6 +302,73 @@ help(
     //  DONE!
 }
 
+/****************************************************************************/
+/**
+ *  Decode the number of worker threads requested for a thread group.
+ *
+ *  @param  parm_p              Pointer to the command line value or NULL
+ *  @param  default_count       Thread count when nothing was requested
+ *
+ *  @return count               Number of worker threads for the group
+ *
+ *  @note
+ *      The value may be a number or the word "auto".  When "auto" is used
+ *      the thread count is the number of processors that are online.
+ *
+ ****************************************************************************/
+
+static
+int
+thread_count(
+    char                        *   parm_p,
+    int                             default_count
+    )
+{
+    /**
+     *  @param  count           Number of worker threads                    */
+    int                         count;
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+    //  Assume the default thread count
+    count = default_count;
+
+    /************************************************************************
+     *  Decode the parameter
+     ************************************************************************/
+
+    //  Was a thread count requested ?
+    if ( parm_p != NULL )
+    {
+        //  YES:    Auto size from the number of processors ?
+        if ( strcasecmp( parm_p, "auto" ) == 0 )
+        {
+            //  YES:    One worker per online processor
+            count = (int)sysconf( _SC_NPROCESSORS_ONLN );
+        }
+        else
+        {
+            //  NO:     Use the requested number
+            count = atoi( parm_p );
+        }
+    }
+
+    //  There must be at least one worker thread
+    if ( count < 1 )
+    {
+        count = 1;
+    }
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+    return( count );
+}
+
 /****************************************************************************/
 /**
  *  Scan the command line and extract parameters for the application.
@@ -231,6 +415,76 @@ command_line(
     //  Scan for        DELETE input file after processing.
     delete_flag = is_cmd_line_parm( argc, argv, "delete" );
 
+    //  Scan for        Memory mapped input files
+    import_mmap = is_cmd_line_parm( argc, argv, "mmap" );
+
+    //  Scan for        Streaming import byte budget (MB)
+    if ( get_cmd_line_parm( argc, argv, "stream_mb" ) != NULL )
+    {
+        /**
+         *  @param  budget_mb       Requested budget in MB                  */
+        int                         budget_mb;
+
+        //  At least one MB
+        budget_mb = atoi( get_cmd_line_parm( argc, argv, "stream_mb" ) );
+        if ( budget_mb < 1 )
+        {
+            budget_mb = 1;
+        }
+        import_stream_budget = (size_t)budget_mb * 1024 * 1024;
+    }
+
+    //  Scan for        Mailbox split size (MB)
+    if ( get_cmd_line_parm( argc, argv, "split_mb" ) != NULL )
+    {
+        /**
+         *  @param  split_mb        Requested split size in MB              */
+        int                         split_mb;
+
+        //  At least one MB
+        split_mb = atoi( get_cmd_line_parm( argc, argv, "split_mb" ) );
+        if ( split_mb < 1 )
+        {
+            split_mb = 1;
+        }
+        import_split_bytes = (size_t)split_mb * 1024 * 1024;
+    }
+
+    //  Scan for        Input file read-ahead depth
+    if ( get_cmd_line_parm( argc, argv, "prefetch" ) != NULL )
+    {
+        read_ahead = atoi( get_cmd_line_parm( argc, argv, "prefetch" ) );
+    }
+
+    //  Scan for        Run-To-Completion mode
+    run_to_completion = is_cmd_line_parm( argc, argv, "rtc" );
+
+    //  Scan for        Strict output ordering
+    ordered = is_cmd_line_parm( argc, argv, "ordered" );
+
+    //  Scan for        Input file manifest
+    manifest_name_p = get_cmd_line_parm( argc, argv, "manifest" );
+
+    //  Scan for        Full rebuild
+    rebuild = is_cmd_line_parm( argc, argv, "rebuild" );
+
+    //  Scan for        Largest-first scheduling
+    largest_first = is_cmd_line_parm( argc, argv, "largest_first" );
+
+    //  Scan for        Worker thread counts for each thread group
+    threads_import  = thread_count( get_cmd_line_parm( argc, argv, "import_threads" ),
+                                    THREAD_COUNT_IMPORT );
+    threads_email   = thread_count( get_cmd_line_parm( argc, argv, "email_threads" ),
+                                    THREAD_COUNT_EMAIL );
+    threads_decode  = thread_count( get_cmd_line_parm( argc, argv, "decode_threads" ),
+                                    THREAD_COUNT_DECODE );
+    threads_encode  = thread_count( get_cmd_line_parm( argc, argv, "encode_threads" ),
+                                    THREAD_COUNT_ENCODE );
+    threads_export  = thread_count( get_cmd_line_parm( argc, argv, "export_threads" ),
+                                    THREAD_COUNT_EXPORT );
+    threads_walk    = thread_count( get_cmd_line_parm( argc, argv, "walk_threads" ),
+                                    THREAD_COUNT_WALK );
+
 #if DEBUG_CMD_LINE
     in_dir_name_p        = "/home/greg/work/RecipeSourceFiles";
     out_dir_name_p       = "/home/greg/work/RecipeOutputFiles";
@@ -240,6 +494,55 @@ command_line(
      *  Verify everything is good
      ************************************************************************/
 
+    //  Run-To-Completion without an IMPORT thread count ?
+    if (    ( run_to_completion == true )
+         && ( get_cmd_line_parm( argc, argv, "import_threads" ) == NULL ) )
+    {
+        //  YES:    Scale across files with one worker per processor
+        threads_import = thread_count( "auto", THREAD_COUNT_IMPORT );
+    }
+
+    //  Strict ordering with more than one EXPORT thread ?
+    if (    ( ordered        == true )
+         && ( threads_export != 1    ) )
+    {
+        //  YES:    The EXPORT queue is in order, keep it that way
+        log_write( MID_INFO, "main",
+                   "-ordered: using one EXPORT thread\n" );
+        threads_export = 1;
+    }
+
+    //  Strict ordering of the files as they are found by several walkers ?
+    if (    ( ordered       == true )
+         && ( largest_first != true )
+         && ( threads_walk  != 1    ) )
+    {
+        //  YES:    The files are numbered in the order they are found
+        log_write( MID_INFO, "main",
+                   "-ordered: using one directory walker\n" );
+        threads_walk = 1;
+    }
+
+    //  Strict ordering with split mailboxes ?
+    if (    ( ordered            == true )
+         && ( import_split_bytes != 0    ) )
+    {
+        //  YES:    The parts would number their recipes in any order
+        log_write( MID_INFO, "main",
+                   "-ordered: not splitting mailboxes\n" );
+        import_split_bytes = 0;
+    }
+
+    //  Split mailboxes without memory mapped files ?
+    if (    ( import_split_bytes != 0    )
+         && ( import_mmap        != true ) )
+    {
+        //  YES:    The split needs the line index of a mapped file
+        log_write( MID_INFO, "main",
+                   "-split_mb: memory mapping the input files\n" );
+        import_mmap = true;
+    }
+
     //  Is there an Input File name or an Input Directory name ?
     if (    ( in_file_name_p == NULL )
          && ( in_dir_name_p  == NULL ) )
@@ -265,162 +568,213 @@ command_line(
 
 /****************************************************************************/
 /**
- *  Return the queue depth for a thread group
+ *  Create a thread group, launch the workers and wait for them to start.
  *
- *  @param  void                No information is passed to this function.
+ *  @param  group_name          Group thread name
+ *  @param  thread_p            Thread function for every worker
+ *  @param  count               Number of worker threads
+ *  @param  max_depth           MAXIMUM queue depth before blocking.
  *
- *  @return rc                  TRUE when the import thread group is done
- *                              FALSE when still working
+ *  @return tcb_p               Pointer to the group Thread Control Block
  *
  *  @note
  *
  ****************************************************************************/
 
 static
-int
-is_import_done(
-    void
+struct  tcb_t   *
+start_group(
+    char                        *   group_name,
+    void                        ( * thread_p )( void * ),
+    int                             count,
+    int                             max_depth
     )
 {
     /**
-     *  @param  func_rc         Function return code                        */
-    int                         func_rc;
+     *  @param  tcb_p           Pointer to the group Thread Control Block   */
+    struct  tcb_t           *   tcb_p;
 
     /************************************************************************
      *  Function Initialization
      ************************************************************************/
 
-    //  Assume everything is complete
-    func_rc = true;
+    //  Allocate storage for a Thread Control Block
+    tcb_p = tcb_new( group_name, 0, max_depth );
 
     /************************************************************************
-     *  Check for complete
+     *  Launch the workers
      ************************************************************************/
 
-    //  Anything in the input queue ?
-    if ( queue_get_count( import_tcb->queue_id ) != 0 )
-    {
-        //  YES:    It's still working
-        func_rc = false;
-    }
-    else
-    //  NO:     Is the thread working on something
-    if ( import_tcb->thread_state == TS_WORKING )
-    {
-        //  YES:    It's still working
-        func_rc = false;
-    }
+    //  Launch the worker threads
+    tcb_group_start( tcb_p, thread_p, count );
+
+    //  Wait for every thread to be 'WAIT'ing for work
+    tcb_group_wait_ready( tcb_p );
 
     /************************************************************************
      *  Function Exit
      ************************************************************************/
 
     //  DONE!
-    return( func_rc );
+    return( tcb_p );
 }
 
 /****************************************************************************/
 /**
- *  Return the queue depth for a thread group
+ *  Create a thread group that runs inline on the thread that feeds it.
  *
- *  @param  void                No information is passed to this function.
+ *  @param  group_name          Group thread name
+ *  @param  work_p              Work function for one payload
  *
- *  @return rc                  TRUE when the email thread group is done
- *                              FALSE when still working
+ *  @return tcb_p               Pointer to the group Thread Control Block
  *
  *  @note
  *
  ****************************************************************************/
 
 static
-int
-is_email_done(
-    void
+struct  tcb_t   *
+start_inline(
+    char                        *   group_name,
+    void                        ( * work_p )( struct tcb_t *, void * )
     )
 {
     /**
-     *  @param  func_rc         Function return code                        */
-    int                         func_rc;
+     *  @param  tcb_p           Pointer to the group Thread Control Block   */
+    struct  tcb_t           *   tcb_p;
 
     /************************************************************************
      *  Function Initialization
      ************************************************************************/
 
-    //  Assume everything is complete
-    func_rc = true;
+    //  Allocate storage for a Thread Control Block
+    tcb_p = tcb_new( group_name, 0, MAX_QUEUE_DEPTH );
 
     /************************************************************************
-     *  Check for complete
+     *  Function Body
      ************************************************************************/
 
-    //  Anything in the input queue ?
-    if ( queue_get_count( email_tcb->queue_id ) != 0 )
-    {
-        //  YES:    It's still working
-        func_rc = false;
-    }
-    else
-    //  NO:     Is the thread working on something
-    if ( email_tcb->thread_state == TS_WORKING )
-    {
-        //  YES:    It's still working
-        func_rc = false;
-    }
+    //  Work for this group is done by whoever queues it
+    tcb_group_inline( tcb_p, work_p );
 
     /************************************************************************
      *  Function Exit
      ************************************************************************/
 
     //  DONE!
-    return( func_rc );
+    return( tcb_p );
 }
+/****************************************************************************/
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
 
 /****************************************************************************/
 /**
- *  Return the queue depth for a thread group
+ *  Decide whether an input file is worth importing.
  *
- *  @param  void                No information is passed to this function.
+ *  @param  file_info_p         Pointer to a file information structure
+ *  @param  manifest_pp         Where to put the manifest entry of a new
+ *                              or changed file
  *
- *  @return rc                  TRUE when the decode thread group is done
- *                              FALSE when still working
+ *  @return want_rc             TRUE when the file should be imported, else
+ *                              FALSE and the file information is released.
  *
  *  @note
+ *      Empty and small files are dropped here instead of in a separate
+ *      pass, before the manifest check can spend time hashing them.
+ *      manifest_unchanged( ) counts and records the file, so it is only
+ *      asked once for each file.
  *
  ****************************************************************************/
 
 static
 int
-is_decode_done(
-    void
+want_file(
+    struct  file_info_t     *   file_info_p,
+    struct  manifest_entry_t ** manifest_pp
     )
 {
     /**
-     *  @param  func_rc         Function return code                        */
-    int                         func_rc;
+     *  @param  want_rc         Return code from this function              */
+    int                         want_rc;
+    /**
+     *  @param  file_path       File path & name                            */
+    char                        file_path[ FILENAME_MAX ];
 
     /************************************************************************
      *  Function Initialization
      ************************************************************************/
 
-    //  Assume everything is complete
-    func_rc = true;
+    //  Initialize variables
+    want_rc = false;
+
+    //  Build the file path & name
+    memset( file_path, '\0', sizeof( file_path ) );
+
+    //  Are we in the input directory root ?
+    if (    ( in_dir_name_p != NULL )
+         && ( strlen( file_info_p->dir_name ) != strlen( in_dir_name_p ) ) )
+    {
+        snprintf( file_path, sizeof( file_path ), "%s/%s",
+                  &file_info_p->dir_name[ strlen( in_dir_name_p ) + 1 ],
+                  file_info_p->file_name );
+    }
+    else
+    {
+        strncpy( file_path, file_info_p->file_name, sizeof( file_path ) );
+    }
 
     /************************************************************************
-     *  Check for complete
+     *  Function Body
      ************************************************************************/
 
-    //  Anything in the input queue ?
-    if ( queue_get_count( decode_tcb->queue_id ) != 0 )
+    //  Is the file too small to hold a recipe ?
+    if ( text_to_long( file_info_p->file_size ) < 100 )
+    {
+        //  YES:    Log the Empty or small file
+        log_write( MID_INFO, "main",
+                   "Skipping empty or small file: '%s'\n",
+                   file_path );
+
+#if 0
+        //  Full dir/filename
+        snprintf( file_path, sizeof( file_path ), "%s/%s/%s",
+                  in_dir_name_p,
+                  &file_info_p->dir_name[ strlen( in_dir_name_p ) + 1 ],
+                  file_info_p->file_name );
+#endif
+
+        //  Log
+        log_write( MID_INFO, "main", "Deleting: %s\n", file_path );
+
+        //  Is the delete flag set ?
+        if ( delete_flag == true )
+        {
+            //  YES:    Delete the file
+            unlink( file_path );
+        }
+
+        //  Release the storage for this file
+        mem_free( file_info_p );
+    }
+
+    //  Has the file changed since the last run ?
+    else if ( manifest_unchanged( file_info_p, manifest_pp ) == true )
     {
-        //  YES:    It's still working
-        func_rc = false;
+        //  NO:     Nothing new to import
+        log_write( MID_LOGONLY, "main",
+                   "Skipping unchanged file: '%s'\n",
+                   file_path );
+
+        mem_free( file_info_p );
     }
+
     else
-    //  NO:     Is the thread working on something
-    if ( decode_tcb->thread_state == TS_WORKING )
     {
-        //  YES:    It's still working
-        func_rc = false;
+        //  YES:    Import it
+        want_rc = true;
     }
 
     /************************************************************************
@@ -428,111 +782,191 @@ is_decode_done(
      ************************************************************************/
 
     //  DONE!
-    return( func_rc );
+    return( want_rc );
 }
 
 /****************************************************************************/
 /**
- *  Return the queue depth for a thread group
+ *  Queue one wanted input file to the IMPORT threads.
  *
- *  @param  void                No information is passed to this function.
+ *  @param  file_info_p         Pointer to a file information structure
+ *  @param  manifest_p          Manifest entry for a new or changed file
  *
- *  @return rc                  TRUE when the encode thread group is done
- *                              FALSE when still working
+ *  @return void                Nothing is returned from this function
  *
  *  @note
+ *      The file has already passed want_file( ).
  *
  ****************************************************************************/
 
 static
-int
-is_encode_done(
-    void
+void
+queue_wanted(
+    struct  file_info_t     *   file_info_p,
+    struct  manifest_entry_t *  manifest_p
     )
 {
     /**
-     *  @param  func_rc         Function return code                        */
-    int                         func_rc;
+     *  @param  file_path       File path & name                            */
+    char                        file_path[ FILENAME_MAX ];
+    /**
+     *  @param  full_name       Full path & name of the file               */
+    char                        full_name[ FILENAME_MAX ];
+    /**
+     *  @param  rcb_p           Recipe Control block                        */
+    struct  rcb_t           *   rcb_p;
 
     /************************************************************************
      *  Function Initialization
      ************************************************************************/
 
-    //  Assume everything is complete
-    func_rc = true;
+    //  Build the file path & name
+    memset( file_path, '\0', sizeof( file_path ) );
+
+    //  Are we in the input directory root ?
+    if (    ( in_dir_name_p != NULL )
+         && ( strlen( file_info_p->dir_name ) != strlen( in_dir_name_p ) ) )
+    {
+        snprintf( file_path, sizeof( file_path ), "%s/%s",
+                  &file_info_p->dir_name[ strlen( in_dir_name_p ) + 1 ],
+                  file_info_p->file_name );
+    }
+    else
+    {
+        strncpy( file_path, file_info_p->file_name, sizeof( file_path ) );
+    }
 
     /************************************************************************
-     *  Check for complete
+     *  Function Body
      ************************************************************************/
 
-    //  Anything in the input queue ?
-    if ( queue_get_count( encode_tcb->queue_id ) != 0 )
+    //  Allocate a new recipe control block
+    rcb_p = rcb_new( NULL );
+
+    //  Number the file (may wait for room in the reorder buffer)
+    rcb_p->file_seq = order_next_file( );
+
+    //  IMPORT confirms the manifest entry once the file is read
+    rcb_p->manifest_p = manifest_p;
+
+    //  Copy the file info into the recipe control block
+    memcpy( rcb_p->file_info_p, file_info_p, sizeof( struct file_info_t ) );
+    mem_free( file_info_p );
+
+    //  Set the display file name
+    memset( rcb_p->file_path, '\0', RCB_FILE_PATH_L );
+    if ( RCB_FILE_PATH_L > strlen( file_path ) )
     {
-        //  YES:    It's still working
-        func_rc = false;
+        memcpy( rcb_p->file_path, file_path, strlen( file_path ) );
     }
     else
-    //  NO:     Is the thread working on something
-    if ( encode_tcb->thread_state == TS_WORKING )
     {
-        //  YES:    It's still working
-        func_rc = false;
+        log_write( MID_FATAL, "FATAL-ERROR:",
+                   "%s @ line %d (D:%d < S:%d)\n",
+                   __FILE__, __LINE__,
+                   RCB_FILE_PATH_L,
+                   strlen( file_path ) );
     }
 
+    //  Start reading it (may wait until IMPORT catches up)
+    snprintf( full_name, sizeof( full_name ), "%s/%s",
+              rcb_p->file_info_p->dir_name, rcb_p->file_info_p->file_name );
+    rcb_p->prefetched = prefetch_file( full_name );
+
+    //  Put it in one of the IMPORT queue's
+    tcb_queue_put( import_tcb, rcb_p );
+
+    //  Count it
+    __atomic_add_fetch( &file_count, 1, __ATOMIC_RELAXED );
+
+    //  Progress report.
+    log_write( MID_LOGONLY, "main",
+               "Snd: FILE-ID: %s\n",
+               rcb_p->file_path );
+
     /************************************************************************
      *  Function Exit
      ************************************************************************/
 
     //  DONE!
-    return( func_rc );
 }
 
 /****************************************************************************/
 /**
- *  Return the queue depth for a thread group
+ *  Queue one input file to the IMPORT threads.
  *
- *  @param  void                No information is passed to this function.
+ *  @param  file_info_p         Pointer to a file information structure
  *
- *  @return rc                  TRUE when the export thread group is done
- *                              FALSE when still working
+ *  @return void                Nothing is returned from this function
  *
  *  @note
+ *      Called by the directory walker threads as each file is found, so
+ *      it may run on several threads at the same time.
  *
  ****************************************************************************/
 
 static
-int
-is_export_done(
-    void
+void
+queue_file(
+    struct  file_info_t     *   file_info_p
     )
 {
     /**
-     *  @param  func_rc         Function return code                        */
-    int                         func_rc;
+     *  @param  manifest_p      Manifest entry for a new or changed file    */
+    struct  manifest_entry_t *  manifest_p;
 
     /************************************************************************
-     *  Function Initialization
+     *  Function Body
      ************************************************************************/
 
-    //  Assume everything is complete
-    func_rc = true;
+    //  Is it worth importing ?
+    if ( want_file( file_info_p, &manifest_p ) == true )
+    {
+        //  YES:    Queue it
+        queue_wanted( file_info_p, manifest_p );
+    }
 
     /************************************************************************
-     *  Check for complete
+     *  Function Exit
      ************************************************************************/
 
-    //  Anything in the input queue ?
-    if ( queue_get_count( export_tcb->queue_id ) != 0 )
-    {
-        //  YES:    It's still working
-        func_rc = false;
-    }
-    else
-    //  NO:     Is the thread working on something
-    if ( export_tcb->thread_state == TS_WORKING )
+    //  DONE!
+}
+
+/****************************************************************************/
+/**
+ *  Hold one input file for the largest first schedule.
+ *
+ *  @param  file_info_p         Pointer to a file information structure
+ *
+ *  @return void                Nothing is returned from this function
+ *
+ *  @note
+ *      Called by the directory walker threads in place of queue_file( ).
+ *      The files queue_file( ) would skip are dropped here, so they are
+ *      not part of the schedule or its makespan estimate.
+ *
+ ****************************************************************************/
+
+static
+void
+schedule_file(
+    struct  file_info_t     *   file_info_p
+    )
+{
+    /**
+     *  @param  manifest_p      Manifest entry for a new or changed file    */
+    struct  manifest_entry_t *  manifest_p;
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    //  Is it worth importing ?
+    if ( want_file( file_info_p, &manifest_p ) == true )
     {
-        //  YES:    It's still working
-        func_rc = false;
+        //  YES:    Hold it until the walk is finished
+        schedule_add( file_info_p, manifest_p );
     }
 
     /************************************************************************
@@ -540,13 +974,7 @@ is_export_done(
      ************************************************************************/
 
     //  DONE!
-    return( func_rc );
 }
-/****************************************************************************/
-
-/****************************************************************************
- * Public Functions
- ****************************************************************************/
 
 /****************************************************************************/
 /**
@@ -577,6 +1005,9 @@ main(
     /**
      *  @param  file_info_p     Pointer to a file information structure     */
     struct  file_info_t     *   file_info_p;
+    /**
+     *  @param  group_tcb_list  Thread groups in pipeline order             */
+    struct  tcb_t           *   group_tcb_list[ 5 ];
 
     /************************************************************************
      *  Application Initialization
@@ -623,7 +1054,9 @@ main(
     log_write( MID_INFO, "main", "Strarting White Box Testing (WBT)\n" );
 
     //  Did all the tests PASS
-    if ( decode_wbt( ) != true )
+    if (    ( decode_wbt( ) != true )
+         || ( email_wbt( )  != true )
+         || ( walk_wbt( )   != true ) )
     {
         //  NO:     Message
         log_write( MID_FATAL, "main", "Terminating!\n" );
@@ -639,9 +1072,6 @@ main(
     //  Process the command line parameters
     command_line( argc, argv );
 
-    //  Create the file-list
-    file_list_p = list_new( );
-
     /************************************************************************
      *  Initialize the database
      ************************************************************************/
@@ -675,6 +1105,73 @@ main(
                       "Queue initialization complete.\n" );
     }
 
+    /************************************************************************
+     *  Benchmarks
+     ************************************************************************/
+#if BENCHMARK
+    log_write( MID_INFO, "main", "Starting benchmarks\n" );
+
+    //  Stage queues
+    ring_benchmark( );
+
+    //  Quoted-printable decoder
+    email_benchmark( );
+
+    //  Date / time decoder
+    decode_benchmark( );
+
+    log_write( MID_INFO, "main", "Benchmarks are complete.\n" );
+#endif
+
+    /************************************************************************
+     *  Initialize the reorder buffer
+     ************************************************************************/
+
+    //  Was strict output ordering requested ?
+    if ( ordered == true )
+    {
+        //  YES:    Turn it on
+        order_init( ORDER_DEPTH_FILES );
+    }
+
+    /************************************************************************
+     *  Initialize the input file read-ahead
+     ************************************************************************/
+
+    //  Was read-ahead requested ?
+    if ( read_ahead > 0 )
+    {
+        //  YES:    Turn it on
+        prefetch_init( read_ahead );
+    }
+
+    /************************************************************************
+     *  Initialize the input file manifest
+     ************************************************************************/
+
+    {
+        /**
+         *  @param  default_name    Manifest kept with the output files     */
+        char                        default_name[ FILENAME_MAX ];
+
+        //  Is there an output directory to keep it in ?
+        if (    ( manifest_name_p == NULL )
+             && ( out_dir_name_p  != NULL ) )
+        {
+            //  YES:    Keep it with the output
+            snprintf( default_name, sizeof( default_name ), "%s/%s",
+                      out_dir_name_p, MANIFEST_FILE_NAME );
+            manifest_name_p = default_name;
+        }
+
+        //  Is there a manifest ?
+        if ( manifest_name_p != NULL )
+        {
+            //  YES:    Load it
+            manifest_init( manifest_name_p, rebuild );
+        }
+    }
+
     /************************************************************************
      *  Initialize the translation process
      ************************************************************************/
@@ -700,123 +1197,75 @@ main(
      *  IMPORT      Thread and Queue Initialization
      ************************************************************************/
 
-    //  Allocate storage for a Thread Control Block
-    import_tcb = tcb_new( THREAD_NAME_IMPORT, 0, QUEUE_DEPTH_IMPORT );
-
-    //  Launch the import thread
-    thread_new( import, import_tcb );
-
-    //  Wait for the thread to be initialized
-    do
-    {
-        usleep( 100 );
-
-        //  Loop until the thread is 'WAIT'ing for work
-    }   while( import_tcb->thread_state != TS_WAIT );
+    //  Launch the import thread group
+    import_tcb = start_group( THREAD_NAME_IMPORT, import,
+                              threads_import, QUEUE_DEPTH_IMPORT );
 
     /************************************************************************
      *  EMAIL       Thread and Queue Initialization
      ************************************************************************/
 
-    //  Allocate storage for a Thread Control Block
-    email_tcb = tcb_new( THREAD_NAME_EMAIL, 0, QUEUE_DEPTH_EMAIL );
-
-    //  Launch the EMAIL thread
-    thread_new( email, email_tcb );
-
-    //  Wait for the thread to be initialized
-    do
+    //  Is this a Run-To-Completion run ?
+    if ( run_to_completion == true )
     {
-        usleep( 100 );
-
-        //  Loop until the thread is 'WAIT'ing for work
-    }   while( email_tcb->thread_state != TS_WAIT );
+        //  YES:    EMAIL runs on the IMPORT thread
+        email_tcb  = start_inline( THREAD_NAME_EMAIL,  email_rcb );
+    }
+    else
+    {
+        //  NO:     Launch the EMAIL thread group
+        email_tcb  = start_group( THREAD_NAME_EMAIL,  email,
+                                  threads_email,  QUEUE_DEPTH_EMAIL );
+    }
 
     /************************************************************************
      *  DECODE      Thread and Queue Initialization
      ************************************************************************/
 
-    //  Allocate storage for a Thread Control Block
-    decode_tcb = tcb_new( THREAD_NAME_DECODE, 0, QUEUE_DEPTH_DECODE );
-
-    //  Launch the decode thread
-    thread_new( decode, decode_tcb );
-
-    //  Wait for the thread to be initialized
-    do
+    //  Is this a Run-To-Completion run ?
+    if ( run_to_completion == true )
     {
-        usleep( 100 );
-
-        //  Loop until the thread is 'WAIT'ing for work
-    }   while( decode_tcb->thread_state != TS_WAIT );
+        //  YES:    DECODE runs on the IMPORT thread
+        decode_tcb = start_inline( THREAD_NAME_DECODE, decode_rcb );
+    }
+    else
+    {
+        //  NO:     Launch the decode thread group
+        decode_tcb = start_group( THREAD_NAME_DECODE, decode,
+                                  threads_decode, QUEUE_DEPTH_DECODE );
+    }
 
     /************************************************************************
      *  ENCODE      Thread and Queue Initialization
      ************************************************************************/
 
-    //  Allocate storage for a Thread Control Block
-    encode_tcb = tcb_new( THREAD_NAME_ENCODE, 0, QUEUE_DEPTH_ENCODE );
-
-    //  Launch the encode thread
-    thread_new( encode, encode_tcb );
-
-    //  Wait for the thread to be initialized
-    do
+    //  Is this a Run-To-Completion run ?
+    if ( run_to_completion == true )
     {
-        usleep( 100 );
-
-        //  Loop until the thread is 'WAIT'ing for work
-    }   while( encode_tcb->thread_state != TS_WAIT );
+        //  YES:    ENCODE runs on the IMPORT thread
+        encode_tcb = start_inline( THREAD_NAME_ENCODE, encode_rcb );
+    }
+    else
+    {
+        //  NO:     Launch the encode thread group
+        encode_tcb = start_group( THREAD_NAME_ENCODE, encode,
+                                  threads_encode, QUEUE_DEPTH_ENCODE );
+    }
 
     /************************************************************************
      *  EXPORT      Thread and Queue Initialization
      ************************************************************************/
 
-    //  Allocate storage for a Thread Control Block
-    export_tcb = tcb_new( THREAD_NAME_EXPORT, 0, QUEUE_DEPTH_EXPORT );
+    //  Launch the export thread group
+    export_tcb = start_group( THREAD_NAME_EXPORT, export,
+                              threads_export, QUEUE_DEPTH_EXPORT );
 
-    //  Launch the export thread
-    thread_new( export, export_tcb );
-
-    //  Wait for the thread to be initialized
-    do
-    {
-        usleep( 100 );
-
-        //  Loop until the thread is 'WAIT'ing for work
-    }   while( export_tcb->thread_state != TS_WAIT );
-
-    /************************************************************************
-     *  Prepare input files for processing
-     ************************************************************************/
-
-    //  Are we processing a directory ?
-    if ( in_dir_name_p != NULL )
-    {
-        /**
-         *  @param  count           Number of files unzipped                */
-        int                         count;
-
-        do
-        {
-
-            //  Unzip all "*.zip" files
-            count = file_unzip( in_dir_name_p );
-
-            //  Loop until there aren't any more files to unzip
-        }   while( count != 0 );
-
-        //  Now that all 'ZIP' files are extracted, build the file list
-        file_ls( file_list_p, in_dir_name_p, NULL );
-    }
-    else
-    {
-        //  Get the file information for the input file
-        file_info_p = file_stat( in_file_name_p, in_file_name_p );
-
-        //  Add the new file to the list
-        list_put_last( file_list_p, file_info_p );
-    }
+    //  Build the pipeline list used for completion
+    group_tcb_list[ 0 ] = import_tcb;
+    group_tcb_list[ 1 ] = email_tcb;
+    group_tcb_list[ 2 ] = decode_tcb;
+    group_tcb_list[ 3 ] = encode_tcb;
+    group_tcb_list[ 4 ] = export_tcb;
 
     /************************************************************************
      *  MONITOR     Track all queue depths
@@ -832,138 +1281,55 @@ main(
      *  IMPORT  everything on the list
      ************************************************************************/
 
-    //  Scan the list
-    for( file_info_p = list_get_first( file_list_p );
-         file_info_p != NULL;
-         file_info_p = list_get_next( file_list_p, file_info_p ) )
+    //  Are we processing a directory largest file first ?
+    if (    ( in_dir_name_p != NULL )
+         && ( largest_first == true ) )
     {
-        /**
-         *  @param  file_path       File path & name                        */
-        char                        file_path[ FILENAME_MAX ];
-
-        //  Remove this file from the list.
-        list_delete_payload( file_list_p, file_info_p );
-
-        //  Build the file path & name
-        memset( file_path, '\0', sizeof( file_path ) );
-
-        //  Are we in the input directory root ?
-        if ( strlen( file_info_p->dir_name ) != strlen( in_dir_name_p ) )
-        {
-            snprintf( file_path, sizeof( file_path ), "%s/%s",
-                      &file_info_p->dir_name[ strlen( in_dir_name_p ) + 1 ],
-                      file_info_p->file_name );
-        }
-        else
-        {
-            strncpy( file_path, file_info_p->file_name, sizeof( file_path ) );
-        }
-
-        //  Is there anything in the file ?
-        if ( text_to_long( file_info_p->file_size ) >= 100 )
-        {
-            /**
-             *  @param  rcb_p           Recipe Control block                */
-            struct  rcb_t           *   rcb_p;
-
-            //  YES:    Allocate a new recipe control block
-            rcb_p = rcb_new( NULL );
-
-            //  Put the file info pointer into the recipe control block
-            rcb_p->file_info_p = file_info_p;
-
-            //  Set the display file name
-            memset( rcb_p->file_path, '\0', sizeof( rcb_p->file_path ) );
-            if ( sizeof( rcb_p->file_path ) > strlen( file_path ) )
-            {
-                memcpy( rcb_p->file_path, file_path, strlen( file_path ) );
-            }
-            else
-            {
-                log_write( MID_FATAL, "FATAL-ERROR:",
-                           "%s @ line %d (D:%d < S:%d)\n",
-                           __FILE__, __LINE__,
-                           sizeof( rcb_p->file_path ),
-                           strlen( file_path ) );
-            }
-
-            //  Put it in one of the IMPORT queue's
-            queue_put_payload( import_tcb->queue_id, rcb_p  );
-
-            //  Progress report.
-            log_write( MID_LOGONLY, "main",
-                       "Snd: FILE-ID: %s\n",
-                       rcb_p->file_path );
-        }
-        else
-        {
-            //  NO:     Log the Empty or small file
-            log_write( MID_INFO, "main",
-                       "Skipping empty or small file: '%s'\n",
-                       file_path );
-
-#if 0
-            //  Full dir/filename
-            snprintf( file_path, sizeof( file_path ), "%s/%s/%s",
-                      in_dir_name_p,
-                      &file_info_p->dir_name[ strlen( in_dir_name_p ) + 1 ],
-                      file_info_p->file_name );
-#endif
-
-            //  Log
-            log_write( MID_INFO, "main", "Deleting: %s\n", file_path );
-
-            //  Is the delete flag set ?
-            if ( delete_flag == true )
-            {
-                //  YES:    Delete the file
-                unlink( file_path );
-            }
+        //  YES:    Find every file, then queue them biggest first.  A file
+        //          is taken by one IMPORT thread (-rtc) or one EMAIL thread.
+        //          The sort fixes the file order, so the walkers don't have to.
+        //          Only EMAIL threads share the parts of a split mailbox.
+        walk_dir( in_dir_name_p, threads_walk, false, schedule_file );
+        schedule_run( ( run_to_completion == true ) ? threads_import
+                                                    : threads_email,
+                      ( run_to_completion == true ) ? 0
+                                                    : import_split_bytes,
+                      queue_wanted );
+    }
+    else
+    //  Are we processing a directory ?
+    if ( in_dir_name_p != NULL )
+    {
+        //  YES:    Queue every file as the walkers find it
+        walk_dir( in_dir_name_p, threads_walk, ordered, queue_file );
+    }
+    else
+    {
+        //  NO:     Get the file information for the input file
+        file_info_p = file_stat( in_file_name_p, in_file_name_p );
 
-            //  Release the storage for this file
-            mem_free( file_info_p );
-        }
+        //  Queue it
+        queue_file( file_info_p );
     }
 
     /************************************************************************
      *  Wait for all threads to complete
      ************************************************************************/
 
-    //  Wait for all threads to get started
-    sleep( 10 );
-
-    //  DO - WHILE any thread is still working
-    while( 1 )
-    {
-        /**
-         *  @param  done_flag       TRUE when threads are done              */
-        int                         done_flag;
-
-        //  Sleep a few seconds before trying again.
-        usleep( 500 );
-
-        //  Check the threads to see if they are ALL done.
-        done_flag = is_import_done( );
+    //  Wait for the last recipe to leave the pipeline
+    tcb_wait_idle( group_tcb_list,
+                   sizeof( group_tcb_list ) / sizeof( group_tcb_list[ 0 ] ) );
 
-        if ( done_flag == true )
-            done_flag = is_email_done( );
-
-        if ( done_flag == true )
-            done_flag = is_decode_done( );
-
-        if ( done_flag == true )
-            done_flag = is_encode_done( );
-
-        if ( done_flag == true )
-            done_flag = is_export_done( );
+    //  Progress report.
+    log_write( MID_INFO, "main",
+               "All thread groups are idle.\n" );
 
-        //  DONE_FLAG can only be TRUE when EVERYTHING is done.
-        if ( done_flag == true )
-            break;
-    }
+    //  Which files were imported and which were skipped (and why)
+    import_report( );
+    prefetch_report( );
 
-    //  Wait for another monitor output
-    sleep( 10 );
+    //  Remember what was imported for the next run
+    manifest_save( );
 
     /************************************************************************
      *  Application Exit
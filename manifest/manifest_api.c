@@ -0,0 +1,421 @@
+/*******************************  COPYRIGHT  ********************************/
+/**
+ *  Author? "Gregory N. Leonhardt"
+ *  License? "CC BY-NC 2.0"
+ *           "https://creativecommons.org/licenses/by-nc/2.0/"
+ *
+ ****************************************************************************/
+
+/******************************** JAVADOC ***********************************/
+/**
+ *  This file contains public function that makeup the external
+ *  library components of the 'manifest' library.
+ *
+ *  @note
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ *  Compiler directives
+ ****************************************************************************/
+
+#define ALLOC_MANIFEST          ( "ALLOCATE STORAGE FOR MANIFEST" )
+
+/****************************************************************************
+ * System Function API
+ ****************************************************************************/
+
+                                //*******************************************
+#include <stdint.h>             //  Alternative storage types
+#include <stdbool.h>            //  TRUE, FALSE, etc.
+#include <stdio.h>              //  Standard I/O definitions
+                                //*******************************************
+#include <string.h>             //  Functions for managing strings
+#include <pthread.h>            //  POSIX threads
+                                //*******************************************
+
+/****************************************************************************
+ * Application APIs
+ ****************************************************************************/
+
+                                //*******************************************
+#include "global.h"             //  Global stuff for this application
+#include "libtools_api.h"       //  My Tools Library
+                                //*******************************************
+#include "manifest_api.h"       //  API for all manifest_*          PUBLIC
+#include "manifest_lib.h"       //  API for all MANIFEST__*         PRIVATE
+                                //*******************************************
+
+/****************************************************************************
+ * Private API Enumerations
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Private API Definitions
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Private API Structures
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Private API Storage Allocation
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Public API Functions
+ ****************************************************************************/
+
+/****************************************************************************/
+/**
+ *  Start keeping a manifest of the input files.
+ *
+ *  @param  manifest_name_p     Where the manifest is kept
+ *  @param  rebuild             TRUE to ignore the last run's manifest
+ *
+ *  @return void                No information is returned
+ *
+ *  @note
+ *      When rebuild is TRUE every file is imported, but a new manifest is
+ *      still written at the end of the run.
+ *
+ ****************************************************************************/
+
+void
+manifest_init(
+    char                    *   manifest_name_p,
+    int                         rebuild
+    )
+{
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+    //  Remember where the manifest is kept
+    strncpy( manifest_name, manifest_name_p, sizeof( manifest_name ) - 1 );
+
+    pthread_mutex_init( &manifest_mutex, NULL );
+    manifest_new_p  = NULL;
+    manifest_active = true;
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    //  Is this a full rebuild ?
+    if ( rebuild == true )
+    {
+        //  YES:    Forget the last run
+        log_write( MID_INFO, "manifest",
+                   "Rebuild requested, all files will be imported.\n" );
+    }
+    else
+    {
+        //  NO:     Load the last run's manifest
+        MANIFEST__load( );
+    }
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+}
+
+/****************************************************************************/
+/**
+ *  Check a file against the last run's manifest.
+ *
+ *  @param  file_info_p         The file
+ *  @param  entry_pp            Where to put this run's entry for a new or
+ *                              changed file ( NULL = none )
+ *
+ *  @return unchanged           TRUE when the file has not changed since
+ *                              the last complete run, else FALSE.
+ *
+ *  @note
+ *      A file with the same size and modification time is taken as
+ *      unchanged without reading it.  A file that was only touched (same
+ *      size, new time) is hashed and compared.  New and changed files are
+ *      hashed for the next run's manifest, but their entry is only written
+ *      once it is passed to manifest_imported( ).
+ *      Called from all of the walker threads at the same time.
+ *
+ ****************************************************************************/
+
+int
+manifest_unchanged(
+    struct  file_info_t     *   file_info_p,
+    struct  manifest_entry_t **  entry_pp
+    )
+{
+    /**
+     *  @param  unchanged       Return code                                 */
+    int                         unchanged;
+    /**
+     *  @param  path            Full path & name of the file                */
+    char                        path[ FILENAME_MAX ];
+    /**
+     *  @param  old_p           The last run's entry for the file           */
+    struct  manifest_entry_t *  old_p;
+    /**
+     *  @param  new_p           This run's entry for the file               */
+    struct  manifest_entry_t *  new_p;
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+    unchanged = false;
+    *entry_pp = NULL;
+
+    //  Is a manifest being kept ?
+    if ( manifest_active == false )
+    {
+        //  NO:     Everything is imported
+        return( unchanged );
+    }
+
+    snprintf( path, sizeof( path ), "%s/%s",
+              file_info_p->dir_name, file_info_p->file_name );
+
+    //  Look for the file in the last run
+    old_p = NULL;
+    if ( manifest_bucket_pp != NULL )
+    {
+        old_p = MANIFEST__find( path );
+    }
+
+    //  Build the entry for this run
+    new_p = mem_malloc( sizeof( struct manifest_entry_t ) );
+    memset( new_p, '\0', sizeof( struct manifest_entry_t ) );
+    strncpy( new_p->file_size, file_info_p->file_size,
+             sizeof( new_p->file_size ) - 1 );
+    strncpy( new_p->date_time, file_info_p->date_time,
+             sizeof( new_p->date_time ) - 1 );
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    //  Same size and same modification time ?
+    if (    ( old_p != NULL )
+         && ( strcmp( old_p->file_size, new_p->file_size ) == 0 )
+         && ( strcmp( old_p->date_time, new_p->date_time ) == 0 ) )
+    {
+        //  YES:    It hasn't changed
+        memcpy( new_p->digest, old_p->digest, MANIFEST_DIGEST_L );
+        unchanged = true;
+    }
+
+    //  Can the content be hashed ?
+    else if ( MANIFEST__digest( path, new_p->digest ) == false )
+    {
+        //  NO:     Let the import report the problem
+        mem_free( new_p );
+        return( unchanged );
+    }
+
+    //  Was it only touched ?
+    else if (    ( old_p != NULL )
+              && ( strcmp( old_p->file_size, new_p->file_size ) == 0 )
+              && ( memcmp( old_p->digest, new_p->digest,
+                           MANIFEST_DIGEST_L ) == 0 ) )
+    {
+        //  YES:    It hasn't changed
+        unchanged = true;
+    }
+
+    //  Count it
+    if ( unchanged == true )
+    {
+        //  Nothing to import, it stays in the manifest
+        new_p->imported = true;
+        __atomic_add_fetch( &manifest_same, 1, __ATOMIC_RELAXED );
+    }
+    else if ( old_p != NULL )
+    {
+        __atomic_add_fetch( &manifest_changed, 1, __ATOMIC_RELAXED );
+    }
+    else
+    {
+        __atomic_add_fetch( &manifest_added, 1, __ATOMIC_RELAXED );
+    }
+
+    //  Add it to this run's manifest
+    new_p->path_p = text_copy_to_new( path );
+
+    pthread_mutex_lock( &manifest_mutex );
+    new_p->next_p  = manifest_new_p;
+    manifest_new_p = new_p;
+    pthread_mutex_unlock( &manifest_mutex );
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  Does IMPORT have to read it first ?
+    if ( unchanged == false )
+    {
+        //  YES:    The caller passes the entry on
+        *entry_pp = new_p;
+    }
+
+    //  DONE!
+    return( unchanged );
+}
+
+/****************************************************************************/
+/**
+ *  A new or changed file has been imported.
+ *
+ *  @param  entry_p             The entry from manifest_unchanged( )
+ *                              ( NULL = not in the manifest )
+ *
+ *  @return void                No information is returned
+ *
+ *  @note
+ *      Called by IMPORT once the whole file was read.  A file that was
+ *      never read (missing, unreadable or the run was cut short) keeps its
+ *      entry out of the manifest, so the next run tries it again.
+ *
+ ****************************************************************************/
+
+void
+manifest_imported(
+    struct  manifest_entry_t *  entry_p
+    )
+{
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    //  Is there an entry ?
+    if ( entry_p != NULL )
+    {
+        //  YES:    It goes into the manifest
+        __atomic_store_n( &entry_p->imported, true, __ATOMIC_RELEASE );
+    }
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+}
+
+/****************************************************************************/
+/**
+ *  Write this run's manifest.
+ *
+ *  @param  void                No parameters are passed in.
+ *
+ *  @return void                No information is returned
+ *
+ *  @note
+ *      Only called after a complete run, so an interrupted run leaves the
+ *      last manifest in place.  The new manifest is written to a temporary
+ *      file and renamed, so a reader never sees half a manifest.  Files
+ *      that have gone away since the last run drop out, and so do new or
+ *      changed files that IMPORT never finished reading.
+ *
+ ****************************************************************************/
+
+void
+manifest_save(
+    void
+    )
+{
+    /**
+     *  @param  temp_name       Temporary manifest file name                */
+    char                        temp_name[ FILENAME_MAX + 8 ];
+    /**
+     *  @param  manifest_fp     Manifest file                               */
+    FILE                    *   manifest_fp;
+    /**
+     *  @param  entry_p         One manifest entry                          */
+    struct  manifest_entry_t *  entry_p;
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+    //  Is a manifest being kept ?
+    if ( manifest_active == false )
+    {
+        //  NO:     Nothing to write
+        return;
+    }
+
+    snprintf( temp_name, sizeof( temp_name ), "%s.tmp", manifest_name );
+
+    //  Open the temporary file
+    manifest_fp = fopen( temp_name, "w" );
+
+    //  Did it open ?
+    if ( manifest_fp == NULL )
+    {
+        //  NO:     The next run will import everything again
+        log_write( MID_WARNING, "manifest",
+                   "Unable to write the manifest: '%s'\n", temp_name );
+        return;
+    }
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    //  Write every entry that was imported
+    for ( entry_p  = manifest_new_p;
+          entry_p != NULL;
+          entry_p  = entry_p->next_p )
+    {
+        if ( __atomic_load_n( &entry_p->imported, __ATOMIC_ACQUIRE ) == true )
+        {
+            fprintf( manifest_fp, "%s\t%s\t%s\t%s\n",
+                     entry_p->digest, entry_p->file_size,
+                     entry_p->date_time, entry_p->path_p );
+        }
+    }
+
+    //  Did it all get written ?
+    if (    ( fclose( manifest_fp ) != 0 )
+         || ( rename( temp_name, manifest_name ) != 0 ) )
+    {
+        //  NO:     Keep the last manifest
+        log_write( MID_WARNING, "manifest",
+                   "Unable to write the manifest: '%s'\n", manifest_name );
+        remove( temp_name );
+    }
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  Progress report.
+    log_write( MID_INFO, "manifest",
+               "%d unchanged files skipped, %d changed, %d new.\n",
+               manifest_same, manifest_changed, manifest_added );
+
+    //  DONE!
+}
+/****************************************************************************/
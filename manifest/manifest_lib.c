@@ -0,0 +1,450 @@
+/*******************************  COPYRIGHT  ********************************/
+/**
+ *  Author? "Gregory N. Leonhardt"
+ *  License? "CC BY-NC 2.0"
+ *           "https://creativecommons.org/licenses/by-nc/2.0/"
+ *
+ ****************************************************************************/
+
+/******************************** JAVADOC ***********************************/
+/**
+ *  This file contains private functions that makeup the internal
+ *  library components of the 'manifest' library.
+ *
+ *  @note
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ *  Compiler directives
+ ****************************************************************************/
+
+#define _GNU_SOURCE             //  getline( )
+
+/****************************************************************************
+ * System Function API
+ ****************************************************************************/
+
+                                //*******************************************
+#include <stdint.h>             //  Alternative storage types
+#include <stdbool.h>            //  TRUE, FALSE, etc.
+#include <stdio.h>              //  Standard I/O definitions
+                                //*******************************************
+#include <stdlib.h>             //  free( )
+#include <string.h>             //  Functions for managing strings
+#include <unistd.h>             //  read( ), close( )
+#include <fcntl.h>              //  open( )
+#include <openssl/evp.h>        //  OpenSSL API for EVP Crypto libraries.
+                                //*******************************************
+
+/****************************************************************************
+ * Application APIs
+ ****************************************************************************/
+
+                                //*******************************************
+#include "global.h"             //  Global stuff for this application
+#include "libtools_api.h"       //  My Tools Library
+                                //*******************************************
+#include "manifest_api.h"       //  API for all manifest_*          PUBLIC
+#include "manifest_lib.h"       //  API for all MANIFEST__*         PRIVATE
+                                //*******************************************
+
+/****************************************************************************
+ * Enumerations local to this file
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Definitions local to this file
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Structures local to this file
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Storage Allocation local to this file
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * LIB Functions
+ ****************************************************************************/
+
+/****************************************************************************/
+/**
+ *  Hash a file path (FNV-1a).
+ *
+ *  @param  path_p              Full path & name of the file
+ *
+ *  @return hash                The hash of the path
+ *
+ *  @note
+ *
+ ****************************************************************************/
+
+uint32_t
+MANIFEST__hash(
+    char                    *   path_p
+    )
+{
+    /**
+     *  @param  hash            The hash                                    */
+    uint32_t                    hash;
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+    //  FNV offset basis
+    hash = 2166136261u;
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    //  Fold in every character
+    for ( ; *path_p != '\0'; path_p += 1 )
+    {
+        hash ^= (unsigned char)*path_p;
+        hash *= 16777619u;
+    }
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+    return( hash );
+}
+
+/****************************************************************************/
+/**
+ *  Load the manifest written by the last complete run.
+ *
+ *  @param  void                No parameters are passed in.
+ *
+ *  @return void                No information is returned
+ *
+ *  @note
+ *      Each line is "digest<TAB>size<TAB>date_time<TAB>path".  A missing
+ *      manifest is not an error (it is the first run), a damaged line is
+ *      ignored (the file is simply imported again).
+ *
+ ****************************************************************************/
+
+void
+MANIFEST__load(
+    void
+    )
+{
+    /**
+     *  @param  manifest_fp     Manifest file                               */
+    FILE                    *   manifest_fp;
+    /**
+     *  @param  line_p          One line of the manifest                    */
+    char                    *   line_p;
+    /**
+     *  @param  line_size       Size of the line buffer                     */
+    size_t                      line_size;
+    /**
+     *  @param  line_l          Length of the line                          */
+    ssize_t                     line_l;
+    /**
+     *  @param  field_p         The fields of the line                      */
+    char                    *   field_p[ 4 ];
+    /**
+     *  @param  save_p          strtok_r( ) state                           */
+    char                    *   save_p;
+    /**
+     *  @param  entry_p         One manifest entry                          */
+    struct  manifest_entry_t *  entry_p;
+    /**
+     *  @param  list_p          Entries that have been read                 */
+    struct  manifest_entry_t *  list_p;
+    /**
+     *  @param  entry_count     Number of entries that have been read       */
+    int                         entry_count;
+    /**
+     *  @param  bucket_count    Number of hash buckets                      */
+    uint32_t                    bucket_count;
+    /**
+     *  @param  ndx             Field number                                */
+    int                         ndx;
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+    line_p      = NULL;
+    line_size   = 0;
+    list_p      = NULL;
+    entry_count = 0;
+
+    //  Open the manifest
+    manifest_fp = fopen( manifest_name, "r" );
+
+    //  Is there one ?
+    if ( manifest_fp == NULL )
+    {
+        //  NO:     Everything is new
+        log_write( MID_INFO, "manifest",
+                   "No manifest found, all files will be imported.\n" );
+    }
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    //  Read every line
+    while (    ( manifest_fp != NULL )
+            && ( ( line_l = getline( &line_p, &line_size, manifest_fp ) ) > 0 ) )
+    {
+        //  Remove the newline
+        if ( line_p[ line_l - 1 ] == '\n' )
+        {
+            line_p[ line_l - 1 ] = '\0';
+        }
+
+        //  Split the line into its fields
+        field_p[ 0 ] = strtok_r( line_p, "\t", &save_p );
+        for ( ndx = 1; ndx < 3; ndx += 1 )
+        {
+            field_p[ ndx ] = strtok_r( NULL, "\t", &save_p );
+        }
+        field_p[ 3 ] = strtok_r( NULL, "", &save_p );
+
+        //  Is the line complete ?
+        if (    ( field_p[ 3 ] == NULL )
+             || ( strlen( field_p[ 0 ] ) != MANIFEST_DIGEST_L ) )
+        {
+            //  NO:     Ignore it
+            continue;
+        }
+
+        //  Build the entry
+        entry_p = mem_malloc( sizeof( struct manifest_entry_t ) );
+        memset( entry_p, '\0', sizeof( struct manifest_entry_t ) );
+        strncpy( entry_p->digest,    field_p[ 0 ], MANIFEST_DIGEST_L );
+        strncpy( entry_p->file_size, field_p[ 1 ],
+                 sizeof( entry_p->file_size ) - 1 );
+        strncpy( entry_p->date_time, field_p[ 2 ],
+                 sizeof( entry_p->date_time ) - 1 );
+        entry_p->path_p = text_copy_to_new( field_p[ 3 ] );
+        entry_p->hash   = MANIFEST__hash( entry_p->path_p );
+
+        //  Hold it until the table is built
+        entry_p->next_p = list_p;
+        list_p          = entry_p;
+        entry_count    += 1;
+    }
+
+    //  Size the table for a short chain
+    for ( bucket_count  = MANIFEST_BUCKETS_MIN;
+          bucket_count  < (uint32_t)entry_count * 2;
+          bucket_count *= 2 );
+
+    manifest_mask      = bucket_count - 1;
+    manifest_bucket_pp = mem_malloc( sizeof( struct manifest_entry_t * )
+                                     * bucket_count );
+    memset( manifest_bucket_pp, '\0',
+            sizeof( struct manifest_entry_t * ) * bucket_count );
+
+    //  Move the entries into the table
+    while ( list_p != NULL )
+    {
+        entry_p = list_p;
+        list_p  = entry_p->next_p;
+
+        entry_p->next_p = manifest_bucket_pp[ entry_p->hash & manifest_mask ];
+        manifest_bucket_pp[ entry_p->hash & manifest_mask ] = entry_p;
+    }
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  Clean up
+    if ( manifest_fp != NULL )
+    {
+        fclose( manifest_fp );
+
+        log_write( MID_INFO, "manifest",
+                   "Loaded %d entries from '%s'.\n",
+                   entry_count, manifest_name );
+    }
+    free( line_p );
+
+    //  DONE!
+}
+
+/****************************************************************************/
+/**
+ *  Find a file in the last run's manifest.
+ *
+ *  @param  path_p              Full path & name of the file
+ *
+ *  @return entry_p             The entry or NULL when the file is new
+ *
+ *  @note
+ *      The table is only written by manifest_init( ), so no lock is needed.
+ *
+ ****************************************************************************/
+
+struct  manifest_entry_t    *
+MANIFEST__find(
+    char                    *   path_p
+    )
+{
+    /**
+     *  @param  hash            Hash of the path                            */
+    uint32_t                    hash;
+    /**
+     *  @param  entry_p         One manifest entry                          */
+    struct  manifest_entry_t *  entry_p;
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+    hash = MANIFEST__hash( path_p );
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    //  Walk the chain
+    for ( entry_p  = manifest_bucket_pp[ hash & manifest_mask ];
+          entry_p != NULL;
+          entry_p  = entry_p->next_p )
+    {
+        //  Is this the file ?
+        if (    ( entry_p->hash == hash )
+             && ( strcmp( entry_p->path_p, path_p ) == 0 ) )
+        {
+            //  YES:    Found it
+            break;
+        }
+    }
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+    return( entry_p );
+}
+
+/****************************************************************************/
+/**
+ *  Compute the SHA-256 of a file's content.
+ *
+ *  @param  path_p              Full path & name of the file
+ *  @param  digest_p            Where the hex digest is written
+ *
+ *  @return digest_rc           TRUE when the digest was computed,
+ *                              FALSE when the file could not be read.
+ *
+ *  @note
+ *      digest_p must hold MANIFEST_DIGEST_L + 1 characters.
+ *
+ ****************************************************************************/
+
+int
+MANIFEST__digest(
+    char                    *   path_p,
+    char                    *   digest_p
+    )
+{
+    /**
+     *  @param  digest_rc       Return code                                 */
+    int                         digest_rc;
+    /**
+     *  @param  file_fd         Input file descriptor                       */
+    int                         file_fd;
+    /**
+     *  @param  read_l          Number of bytes read                        */
+    ssize_t                     read_l;
+    /**
+     *  @param  buffer_p        Read buffer                                 */
+    unsigned char           *   buffer_p;
+    /**
+     *  @param  mdctx           Message digest context                      */
+    EVP_MD_CTX              *   mdctx;
+    /**
+     *  @param  md_value        The digest                                  */
+    unsigned char               md_value[ EVP_MAX_MD_SIZE ];
+    /**
+     *  @param  md_len          Length of the digest                        */
+    unsigned int                md_len;
+    /**
+     *  @param  ndx             Index into the digest                       */
+    unsigned int                ndx;
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+    digest_rc = false;
+
+    //  Open the file
+    file_fd = open( path_p, O_RDONLY );
+
+    //  Did it open ?
+    if ( file_fd < 0 )
+    {
+        //  NO:     There is nothing to hash
+        return( digest_rc );
+    }
+
+    buffer_p = mem_malloc( MANIFEST_READ_L );
+    mdctx    = EVP_MD_CTX_new( );
+    EVP_DigestInit_ex( mdctx, EVP_sha256( ), NULL );
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    //  Hash the whole file
+    while ( ( read_l = read( file_fd, buffer_p, MANIFEST_READ_L ) ) > 0 )
+    {
+        EVP_DigestUpdate( mdctx, buffer_p, read_l );
+    }
+
+    //  Did it read to the end ?
+    if ( read_l == 0 )
+    {
+        //  YES:    Convert the digest to hex
+        EVP_DigestFinal_ex( mdctx, md_value, &md_len );
+
+        for ( ndx = 0; ndx < md_len; ndx += 1 )
+        {
+            snprintf( &digest_p[ ndx * 2 ], 3, "%02x", md_value[ ndx ] );
+        }
+
+        digest_rc = true;
+    }
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  Clean up
+    EVP_MD_CTX_free( mdctx );
+    mem_free( buffer_p );
+    close( file_fd );
+
+    //  DONE!
+    return( digest_rc );
+}
+/****************************************************************************/
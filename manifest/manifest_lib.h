@@ -0,0 +1,170 @@
+/*******************************  COPYRIGHT  ********************************/
+/**
+ *  Author? "Gregory N. Leonhardt"
+ *  License? "CC BY-NC 2.0"
+ *           "https://creativecommons.org/licenses/by-nc/2.0/"
+ *
+ ****************************************************************************/
+
+#ifndef MANIFEST_LIB_H
+#define MANIFEST_LIB_H
+
+/******************************** JAVADOC ***********************************/
+/**
+ *  This file contains private definitions (etc.) that apply to internal
+ *  library components of the 'manifest' library.
+ *
+ *  @note
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ *  Compiler directives
+ ****************************************************************************/
+
+#ifdef ALLOC_MANIFEST
+   #define MANIFEST_EXT
+#else
+   #define MANIFEST_EXT     extern
+#endif
+
+/****************************************************************************
+ * System APIs
+ ****************************************************************************/
+
+                                //*******************************************
+#include <stdio.h>              //  FILENAME_MAX
+#include <stdint.h>             //  uint32_t
+#include <pthread.h>            //  POSIX threads
+                                //*******************************************
+
+/****************************************************************************
+ * Application APIs
+ ****************************************************************************/
+
+                                //*******************************************
+                                //*******************************************
+
+/****************************************************************************
+ * Library Private Definitions
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+#define MANIFEST_DIGEST_L       (   64 )    //  SHA-256 in hex
+#define MANIFEST_BUCKETS_MIN    ( 1024 )
+#define MANIFEST_READ_L         ( 64 * 1024 )
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Library Private Enumerations
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Library Private Structures
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+/**
+ *  @param  manifest_entry_t    One input file                              */
+struct  manifest_entry_t
+{
+    /**
+     *  @param  next_p          Next entry in the hash chain or the list    */
+    struct  manifest_entry_t *  next_p;
+    /**
+     *  @param  hash            Hash of the path                            */
+    uint32_t                    hash;
+    /**
+     *  @param  digest          SHA-256 of the content ( '-' = unreadable ) */
+    char                        digest[ MANIFEST_DIGEST_L + 1 ];
+    /**
+     *  @param  file_size       File size (as reported by the walker)       */
+    char                        file_size[ 32 ];
+    /**
+     *  @param  date_time       Modification date & time                    */
+    char                        date_time[ 32 ];
+    /**
+     *  @param  path_p          Full path & name of the file                */
+    char                    *   path_p;
+    /**
+     *  @param  imported        TRUE once the file was read (or unchanged)  */
+    int                         imported;
+};
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Library Private Storage Allocation
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+/**
+ *  @param  manifest_active     TRUE when a manifest is kept                */
+MANIFEST_EXT
+int                             manifest_active;
+/**
+ *  @param  manifest_name       Where the manifest is kept                  */
+MANIFEST_EXT
+char                            manifest_name[ FILENAME_MAX ];
+/**
+ *  @param  manifest_bucket_pp  The last run's files, by path               */
+MANIFEST_EXT
+struct  manifest_entry_t    **  manifest_bucket_pp;
+/**
+ *  @param  manifest_mask       Number of buckets - 1 ( a power of 2 - 1 )  */
+MANIFEST_EXT
+uint32_t                        manifest_mask;
+/**
+ *  @param  manifest_new_p      This run's files                            */
+MANIFEST_EXT
+struct  manifest_entry_t    *   manifest_new_p;
+/**
+ *  @param  manifest_mutex      Protects manifest_new_p                     */
+MANIFEST_EXT
+pthread_mutex_t                 manifest_mutex;
+/**
+ *  @param  manifest_same       Files that have not changed                 */
+MANIFEST_EXT
+int                             manifest_same;
+/**
+ *  @param  manifest_changed    Files that have changed                     */
+MANIFEST_EXT
+int                             manifest_changed;
+/**
+ *  @param  manifest_added      Files that are new                          */
+MANIFEST_EXT
+int                             manifest_added;
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Library Private Prototypes
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+uint32_t
+MANIFEST__hash(
+    char                    *   path_p
+    );
+//----------------------------------------------------------------------------
+void
+MANIFEST__load(
+    void
+    );
+//----------------------------------------------------------------------------
+struct  manifest_entry_t    *
+MANIFEST__find(
+    char                    *   path_p
+    );
+//----------------------------------------------------------------------------
+int
+MANIFEST__digest(
+    char                    *   path_p,
+    char                    *   digest_p
+    );
+//----------------------------------------------------------------------------
+
+/****************************************************************************/
+
+#endif                      //    MANIFEST_LIB_H
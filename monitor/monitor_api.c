@@ -144,23 +144,23 @@ monitor(
          *  Gather the queue depth data
          ********************************************************************/
 
-        //  INPUT FILE
-        file_total = list_query_count( file_list_p );
+        //  INPUT FILE (queued so far, the walk may still be running)
+        file_total = __atomic_load_n( &file_count, __ATOMIC_RELAXED );
 
         //  IMPORT
-        import_total = queue_get_count( import_tcb->queue_id );
+        import_total = tcb_queue_count( import_tcb );
 
         //  EMAIL
-        email_total = queue_get_count( email_tcb->queue_id );
+        email_total = tcb_queue_count( email_tcb );
 
         //  DECODE
-        decode_total = queue_get_count( decode_tcb->queue_id );
+        decode_total = tcb_queue_count( decode_tcb );
 
         //  ENCODE
-        encode_total = queue_get_count( encode_tcb->queue_id );
+        encode_total = tcb_queue_count( encode_tcb );
 
         //  EXPORT
-        export_total = queue_get_count( export_tcb->queue_id );
+        export_total = tcb_queue_count( export_tcb );
 
         /********************************************************************
          *  Write the data to the log file
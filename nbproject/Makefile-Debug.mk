@@ -35,6 +35,8 @@ OBJECTDIR=${CND_BUILDDIR}/${CND_CONF}/${CND_PLATFORM}
 
 # Object Files
 OBJECTFILES= \
+	${OBJECTDIR}/archive/archive_api.o \
+	${OBJECTDIR}/archive/archive_lib.o \
 	${OBJECTDIR}/dbase/DBASE__appliance.o \
 	${OBJECTDIR}/dbase/DBASE__chapter.o \
 	${OBJECTDIR}/dbase/DBASE__cuisine.o \
@@ -59,9 +61,12 @@ OBJECTFILES= \
 	${OBJECTDIR}/decode/post/decode_post_lib.o \
 	${OBJECTDIR}/decode/rxf/decode_rxf_api.o \
 	${OBJECTDIR}/decode/rxf/decode_rxf_lib.o \
+	${OBJECTDIR}/decode/test/DECODE_BENCH.o \
 	${OBJECTDIR}/decode/test/DECODE_TEST.o \
 	${OBJECTDIR}/email/email_api.o \
 	${OBJECTDIR}/email/email_lib.o \
+	${OBJECTDIR}/email/test/EMAIL_BENCH.o \
+	${OBJECTDIR}/email/test/EMAIL_TEST.o \
 	${OBJECTDIR}/encode/RXF/encode_rxf_api.o \
 	${OBJECTDIR}/encode/RXF/encode_rxf_lib.o \
 	${OBJECTDIR}/encode/XML/encode_xml_api.o \
@@ -73,14 +78,28 @@ OBJECTFILES= \
 	${OBJECTDIR}/import/import_api.o \
 	${OBJECTDIR}/import/import_lib.o \
 	${OBJECTDIR}/main.o \
+	${OBJECTDIR}/manifest/manifest_api.o \
+	${OBJECTDIR}/manifest/manifest_lib.o \
 	${OBJECTDIR}/monitor/monitor_api.o \
 	${OBJECTDIR}/monitor/monitor_lib.o \
+	${OBJECTDIR}/order/order_api.o \
+	${OBJECTDIR}/order/order_lib.o \
+	${OBJECTDIR}/prefetch/prefetch_api.o \
+	${OBJECTDIR}/prefetch/prefetch_lib.o \
 	${OBJECTDIR}/rcb/rcb_api.o \
 	${OBJECTDIR}/rcb/rcb_lib.o \
 	${OBJECTDIR}/recipe/recipe_api.o \
 	${OBJECTDIR}/recipe/recipe_lib.o \
+	${OBJECTDIR}/ring/ring_api.o \
+	${OBJECTDIR}/ring/ring_lib.o \
+	${OBJECTDIR}/ring/test/RING_BENCH.o \
+	${OBJECTDIR}/schedule/schedule_api.o \
+	${OBJECTDIR}/schedule/schedule_lib.o \
 	${OBJECTDIR}/tcb/tcb_api.o \
 	${OBJECTDIR}/tcb/tcb_lib.o \
+	${OBJECTDIR}/walk/test/WALK_TEST.o \
+	${OBJECTDIR}/walk/walk_api.o \
+	${OBJECTDIR}/walk/walk_lib.o \
 	${OBJECTDIR}/xlate/xlate_api.o \
 	${OBJECTDIR}/xlate/xlate_lib.o
 
@@ -99,7 +118,7 @@ FFLAGS=
 ASFLAGS=
 
 # Link Libraries and Options
-LDLIBSOPTIONS=../Libtools/dist/Debug/GNU-Linux/liblibtools.a -lpthread -ldl `pkg-config --libs mysqlclient` `pkg-config --libs libcrypto`  
+LDLIBSOPTIONS=../Libtools/dist/Debug/GNU-Linux/liblibtools.a -lpthread -ldl -lz -lbz2 -llzma `pkg-config --libs mysqlclient` `pkg-config --libs libcrypto`  
 
 # Build Targets
 .build-conf: ${BUILD_SUBPROJECTS}
@@ -111,6 +130,16 @@ ${CND_DISTDIR}/${CND_CONF}/${CND_PLATFORM}/ria_v6: ${OBJECTFILES}
 	${MKDIR} -p ${CND_DISTDIR}/${CND_CONF}/${CND_PLATFORM}
 	${LINK.c} -o ${CND_DISTDIR}/${CND_CONF}/${CND_PLATFORM}/ria_v6 ${OBJECTFILES} ${LDLIBSOPTIONS}
 
+${OBJECTDIR}/archive/archive_api.o: archive/archive_api.c
+	${MKDIR} -p ${OBJECTDIR}/archive
+	${RM} "$@.d"
+	$(COMPILE.c) -g -Iinclude -I../Libtools/include `pkg-config --cflags mysqlclient` `pkg-config --cflags libcrypto`   -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/archive/archive_api.o archive/archive_api.c
+
+${OBJECTDIR}/archive/archive_lib.o: archive/archive_lib.c
+	${MKDIR} -p ${OBJECTDIR}/archive
+	${RM} "$@.d"
+	$(COMPILE.c) -g -Iinclude -I../Libtools/include `pkg-config --cflags mysqlclient` `pkg-config --cflags libcrypto`   -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/archive/archive_lib.o archive/archive_lib.c
+
 ${OBJECTDIR}/dbase/DBASE__appliance.o: dbase/DBASE__appliance.c
 	${MKDIR} -p ${OBJECTDIR}/dbase
 	${RM} "$@.d"
@@ -231,6 +260,11 @@ ${OBJECTDIR}/decode/rxf/decode_rxf_lib.o: decode/rxf/decode_rxf_lib.c
 	${RM} "$@.d"
 	$(COMPILE.c) -g -Iinclude -I../Libtools/include `pkg-config --cflags mysqlclient` `pkg-config --cflags libcrypto`   -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/decode/rxf/decode_rxf_lib.o decode/rxf/decode_rxf_lib.c
 
+${OBJECTDIR}/decode/test/DECODE_BENCH.o: decode/test/DECODE_BENCH.c
+	${MKDIR} -p ${OBJECTDIR}/decode/test
+	${RM} "$@.d"
+	$(COMPILE.c) -g -Iinclude -I../Libtools/include `pkg-config --cflags mysqlclient` `pkg-config --cflags libcrypto`   -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/decode/test/DECODE_BENCH.o decode/test/DECODE_BENCH.c
+
 ${OBJECTDIR}/decode/test/DECODE_TEST.o: decode/test/DECODE_TEST.c
 	${MKDIR} -p ${OBJECTDIR}/decode/test
 	${RM} "$@.d"
@@ -246,6 +280,16 @@ ${OBJECTDIR}/email/email_lib.o: email/email_lib.c
 	${RM} "$@.d"
 	$(COMPILE.c) -g -Iinclude -I../Libtools/include `pkg-config --cflags mysqlclient` `pkg-config --cflags libcrypto`   -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/email/email_lib.o email/email_lib.c
 
+${OBJECTDIR}/email/test/EMAIL_BENCH.o: email/test/EMAIL_BENCH.c
+	${MKDIR} -p ${OBJECTDIR}/email/test
+	${RM} "$@.d"
+	$(COMPILE.c) -g -Iinclude -I../Libtools/include `pkg-config --cflags mysqlclient` `pkg-config --cflags libcrypto`   -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/email/test/EMAIL_BENCH.o email/test/EMAIL_BENCH.c
+
+${OBJECTDIR}/email/test/EMAIL_TEST.o: email/test/EMAIL_TEST.c
+	${MKDIR} -p ${OBJECTDIR}/email/test
+	${RM} "$@.d"
+	$(COMPILE.c) -g -Iinclude -I../Libtools/include `pkg-config --cflags mysqlclient` `pkg-config --cflags libcrypto`   -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/email/test/EMAIL_TEST.o email/test/EMAIL_TEST.c
+
 ${OBJECTDIR}/encode/RXF/encode_rxf_api.o: encode/RXF/encode_rxf_api.c
 	${MKDIR} -p ${OBJECTDIR}/encode/RXF
 	${RM} "$@.d"
@@ -301,6 +345,16 @@ ${OBJECTDIR}/main.o: main.c
 	${RM} "$@.d"
 	$(COMPILE.c) -g -Iinclude -I../Libtools/include `pkg-config --cflags mysqlclient` `pkg-config --cflags libcrypto`   -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/main.o main.c
 
+${OBJECTDIR}/manifest/manifest_api.o: manifest/manifest_api.c
+	${MKDIR} -p ${OBJECTDIR}/manifest
+	${RM} "$@.d"
+	$(COMPILE.c) -g -Iinclude -I../Libtools/include `pkg-config --cflags mysqlclient` `pkg-config --cflags libcrypto`   -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/manifest/manifest_api.o manifest/manifest_api.c
+
+${OBJECTDIR}/manifest/manifest_lib.o: manifest/manifest_lib.c
+	${MKDIR} -p ${OBJECTDIR}/manifest
+	${RM} "$@.d"
+	$(COMPILE.c) -g -Iinclude -I../Libtools/include `pkg-config --cflags mysqlclient` `pkg-config --cflags libcrypto`   -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/manifest/manifest_lib.o manifest/manifest_lib.c
+
 ${OBJECTDIR}/monitor/monitor_api.o: monitor/monitor_api.c
 	${MKDIR} -p ${OBJECTDIR}/monitor
 	${RM} "$@.d"
@@ -311,6 +365,26 @@ ${OBJECTDIR}/monitor/monitor_lib.o: monitor/monitor_lib.c
 	${RM} "$@.d"
 	$(COMPILE.c) -g -Iinclude -I../Libtools/include `pkg-config --cflags mysqlclient` `pkg-config --cflags libcrypto`   -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/monitor/monitor_lib.o monitor/monitor_lib.c
 
+${OBJECTDIR}/order/order_api.o: order/order_api.c
+	${MKDIR} -p ${OBJECTDIR}/order
+	${RM} "$@.d"
+	$(COMPILE.c) -g -Iinclude -I../Libtools/include `pkg-config --cflags mysqlclient` `pkg-config --cflags libcrypto`   -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/order/order_api.o order/order_api.c
+
+${OBJECTDIR}/order/order_lib.o: order/order_lib.c
+	${MKDIR} -p ${OBJECTDIR}/order
+	${RM} "$@.d"
+	$(COMPILE.c) -g -Iinclude -I../Libtools/include `pkg-config --cflags mysqlclient` `pkg-config --cflags libcrypto`   -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/order/order_lib.o order/order_lib.c
+
+${OBJECTDIR}/prefetch/prefetch_api.o: prefetch/prefetch_api.c
+	${MKDIR} -p ${OBJECTDIR}/prefetch
+	${RM} "$@.d"
+	$(COMPILE.c) -g -Iinclude -I../Libtools/include `pkg-config --cflags mysqlclient` `pkg-config --cflags libcrypto`   -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/prefetch/prefetch_api.o prefetch/prefetch_api.c
+
+${OBJECTDIR}/prefetch/prefetch_lib.o: prefetch/prefetch_lib.c
+	${MKDIR} -p ${OBJECTDIR}/prefetch
+	${RM} "$@.d"
+	$(COMPILE.c) -g -Iinclude -I../Libtools/include `pkg-config --cflags mysqlclient` `pkg-config --cflags libcrypto`   -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/prefetch/prefetch_lib.o prefetch/prefetch_lib.c
+
 ${OBJECTDIR}/rcb/rcb_api.o: rcb/rcb_api.c
 	${MKDIR} -p ${OBJECTDIR}/rcb
 	${RM} "$@.d"
@@ -331,6 +405,31 @@ ${OBJECTDIR}/recipe/recipe_lib.o: recipe/recipe_lib.c
 	${RM} "$@.d"
 	$(COMPILE.c) -g -Iinclude -I../Libtools/include `pkg-config --cflags mysqlclient` `pkg-config --cflags libcrypto`   -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/recipe/recipe_lib.o recipe/recipe_lib.c
 
+${OBJECTDIR}/ring/ring_api.o: ring/ring_api.c
+	${MKDIR} -p ${OBJECTDIR}/ring
+	${RM} "$@.d"
+	$(COMPILE.c) -g -Iinclude -I../Libtools/include `pkg-config --cflags mysqlclient` `pkg-config --cflags libcrypto`   -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/ring/ring_api.o ring/ring_api.c
+
+${OBJECTDIR}/ring/ring_lib.o: ring/ring_lib.c
+	${MKDIR} -p ${OBJECTDIR}/ring
+	${RM} "$@.d"
+	$(COMPILE.c) -g -Iinclude -I../Libtools/include `pkg-config --cflags mysqlclient` `pkg-config --cflags libcrypto`   -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/ring/ring_lib.o ring/ring_lib.c
+
+${OBJECTDIR}/ring/test/RING_BENCH.o: ring/test/RING_BENCH.c
+	${MKDIR} -p ${OBJECTDIR}/ring/test
+	${RM} "$@.d"
+	$(COMPILE.c) -g -Iinclude -I../Libtools/include `pkg-config --cflags mysqlclient` `pkg-config --cflags libcrypto`   -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/ring/test/RING_BENCH.o ring/test/RING_BENCH.c
+
+${OBJECTDIR}/schedule/schedule_api.o: schedule/schedule_api.c
+	${MKDIR} -p ${OBJECTDIR}/schedule
+	${RM} "$@.d"
+	$(COMPILE.c) -g -Iinclude -I../Libtools/include `pkg-config --cflags mysqlclient` `pkg-config --cflags libcrypto`   -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/schedule/schedule_api.o schedule/schedule_api.c
+
+${OBJECTDIR}/schedule/schedule_lib.o: schedule/schedule_lib.c
+	${MKDIR} -p ${OBJECTDIR}/schedule
+	${RM} "$@.d"
+	$(COMPILE.c) -g -Iinclude -I../Libtools/include `pkg-config --cflags mysqlclient` `pkg-config --cflags libcrypto`   -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/schedule/schedule_lib.o schedule/schedule_lib.c
+
 ${OBJECTDIR}/tcb/tcb_api.o: tcb/tcb_api.c
 	${MKDIR} -p ${OBJECTDIR}/tcb
 	${RM} "$@.d"
@@ -341,6 +440,21 @@ ${OBJECTDIR}/tcb/tcb_lib.o: tcb/tcb_lib.c
 	${RM} "$@.d"
 	$(COMPILE.c) -g -Iinclude -I../Libtools/include `pkg-config --cflags mysqlclient` `pkg-config --cflags libcrypto`   -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/tcb/tcb_lib.o tcb/tcb_lib.c
 
+${OBJECTDIR}/walk/test/WALK_TEST.o: walk/test/WALK_TEST.c
+	${MKDIR} -p ${OBJECTDIR}/walk/test
+	${RM} "$@.d"
+	$(COMPILE.c) -g -Iinclude -I../Libtools/include `pkg-config --cflags mysqlclient` `pkg-config --cflags libcrypto`   -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/walk/test/WALK_TEST.o walk/test/WALK_TEST.c
+
+${OBJECTDIR}/walk/walk_api.o: walk/walk_api.c
+	${MKDIR} -p ${OBJECTDIR}/walk
+	${RM} "$@.d"
+	$(COMPILE.c) -g -Iinclude -I../Libtools/include `pkg-config --cflags mysqlclient` `pkg-config --cflags libcrypto`   -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/walk/walk_api.o walk/walk_api.c
+
+${OBJECTDIR}/walk/walk_lib.o: walk/walk_lib.c
+	${MKDIR} -p ${OBJECTDIR}/walk
+	${RM} "$@.d"
+	$(COMPILE.c) -g -Iinclude -I../Libtools/include `pkg-config --cflags mysqlclient` `pkg-config --cflags libcrypto`   -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/walk/walk_lib.o walk/walk_lib.c
+
 ${OBJECTDIR}/xlate/xlate_api.o: xlate/xlate_api.c
 	${MKDIR} -p ${OBJECTDIR}/xlate
 	${RM} "$@.d"
@@ -0,0 +1,295 @@
+/*******************************  COPYRIGHT  ********************************/
+/**
+ *  Author? "Gregory N. Leonhardt"
+ *  License? "CC BY-NC 2.0"
+ *           "https://creativecommons.org/licenses/by-nc/2.0/"
+ *
+ ****************************************************************************/
+
+/******************************** JAVADOC ***********************************/
+/**
+ *  This file contains public function that makeup the external
+ *  library components of the 'order' library.
+ *
+ *  @note
+ *      When strict ordering is off nothing is ever held; order_release( )
+ *      hands the recipe straight to its release function and the other
+ *      functions return without taking a lock.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ *  Compiler directives
+ ****************************************************************************/
+
+#define ALLOC_ORDER             ( "ALLOCATE STORAGE FOR ORDER" )
+
+/****************************************************************************
+ * System Function API
+ ****************************************************************************/
+
+                                //*******************************************
+#include <stdint.h>             //  Alternative storage types
+#include <stdbool.h>            //  TRUE, FALSE, etc.
+#include <stdio.h>              //  Standard I/O definitions
+                                //*******************************************
+#include <pthread.h>            //  POSIX threads
+                                //*******************************************
+
+/****************************************************************************
+ * Application APIs
+ ****************************************************************************/
+
+                                //*******************************************
+#include "global.h"             //  Global stuff for this application
+#include "libtools_api.h"       //  My Tools Library
+                                //*******************************************
+#include "rcb_api.h"            //  API for all rcb_*               PUBLIC
+#include "order_api.h"          //  API for all order_*             PUBLIC
+#include "order_lib.h"          //  API for all ORDER__*            PRIVATE
+                                //*******************************************
+
+/****************************************************************************
+ * Private API Enumerations
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Private API Definitions
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Private API Structures
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Private API Storage Allocation
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Public API Functions
+ ****************************************************************************/
+
+/****************************************************************************/
+/**
+ *  Turn on strict output ordering.
+ *
+ *  @param  max_files           Number of input files that may be in the
+ *                              pipeline past the oldest unfinished file.
+ *
+ *  @return void                No information is returned
+ *
+ *  @note
+ *      Must be called before the first file is queued.  Without this call
+ *      recipes are released as soon as they are ready.
+ *
+ ****************************************************************************/
+
+void
+order_init(
+    int                         max_files
+    )
+{
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    //  Create the reorder buffer
+    order_file_p      = mem_malloc( max_files * sizeof( struct order_file_t ) );
+    order_max_files   = max_files;
+    order_head_file   = 1;
+    order_head_recipe = 1;
+
+    //  Create the wake-up signal
+    pthread_mutex_init( &order_mutex, NULL );
+    pthread_cond_init( &order_cond, NULL );
+
+    //  Strict ordering is now active
+    order_strict      = true;
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+}
+
+/****************************************************************************/
+/**
+ *  Get the sequence number for the next input file.
+ *
+ *  @param  void                No parameters are passed into this function.
+ *
+ *  @return file_seq            Input file sequence number (1, 2, 3, ...)
+ *
+ *  @note
+ *      Called by the directory walker threads.  With strict ordering this
+ *      waits until the new file is within max_files of the oldest unfinished
+ *      file, which is what keeps the reorder buffer bounded.
+ *
+ ****************************************************************************/
+
+int
+order_next_file(
+    void
+    )
+{
+    /**
+     *  @param  file_seq        Input file sequence number                  */
+    int                         file_seq;
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+    //  Next file
+    file_seq = __atomic_add_fetch( &order_next_seq, 1, __ATOMIC_SEQ_CST );
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    //  Is strict ordering active ?
+    if ( order_strict == true )
+    {
+        //  YES:    Wait for room
+        pthread_mutex_lock( &order_mutex );
+
+        while ( file_seq >= ( order_head_file + order_max_files ) )
+        {
+            pthread_cond_wait( &order_cond, &order_mutex );
+        }
+
+        pthread_mutex_unlock( &order_mutex );
+    }
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+    return( file_seq );
+}
+
+/****************************************************************************/
+/**
+ *  A recipe is ready for output.
+ *
+ *  @param  rcb_p               Pointer to a Recipe Control Block
+ *  @param  release_p           Called (in order) to output the recipe
+ *
+ *  @return void                No information is returned
+ *
+ *  @note
+ *      The release function may run on this thread or on whichever thread
+ *      completes the gap in front of this recipe.  Releases never overlap.
+ *
+ ****************************************************************************/
+
+void
+order_release(
+    struct  rcb_t           *   rcb_p,
+    void                    ( * release_p )( struct rcb_t * )
+    )
+{
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    //  Is strict ordering active ?
+    if ( order_strict != true )
+    {
+        //  NO:     Out it goes
+        release_p( rcb_p );
+    }
+    else
+    {
+        //  YES:    Wait for its turn
+        ORDER__add( rcb_p->file_seq, rcb_p->recipe_seq, 0, rcb_p, release_p );
+    }
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+}
+
+/****************************************************************************/
+/**
+ *  A Recipe Control Block is being destroyed.
+ *
+ *  @param  rcb_p               Pointer to a Recipe Control Block
+ *
+ *  @return void                No information is returned
+ *
+ *  @note
+ *      Called by rcb_kill( ).  A file RCB going away means every recipe in
+ *      the file has been numbered.  A recipe RCB going away before it was
+ *      released means the recipe was thrown out and its turn is skipped.
+ *
+ ****************************************************************************/
+
+void
+order_discard(
+    struct  rcb_t           *   rcb_p
+    )
+{
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    //  Is this a numbered RCB while strict ordering is active ?
+    if (    ( order_strict          == true  )
+         && ( rcb_p->file_seq       != 0     )
+         && ( rcb_p->order_released != true  ) )
+    {
+        //  YES:    Is it the input file ?
+        if ( rcb_p->recipe_seq == 0 )
+        {
+            //  YES:    End of file
+            ORDER__add( rcb_p->file_seq, 0, rcb_p->recipe_count, NULL, NULL );
+        }
+        else
+        {
+            //  NO:     Skip this recipe
+            ORDER__add( rcb_p->file_seq, rcb_p->recipe_seq, 0, NULL, NULL );
+        }
+    }
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+}
+/****************************************************************************/
@@ -0,0 +1,273 @@
+/*******************************  COPYRIGHT  ********************************/
+/**
+ *  Author? "Gregory N. Leonhardt"
+ *  License? "CC BY-NC 2.0"
+ *           "https://creativecommons.org/licenses/by-nc/2.0/"
+ *
+ ****************************************************************************/
+
+/******************************** JAVADOC ***********************************/
+/**
+ *  This file contains private functions that makeup the internal
+ *  library components of the 'order' library.
+ *
+ *  @note
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ *  Compiler directives
+ ****************************************************************************/
+
+
+/****************************************************************************
+ * System Function API
+ ****************************************************************************/
+
+                                //*******************************************
+#include <stdint.h>             //  Alternative storage types
+#include <stdbool.h>            //  TRUE, FALSE, etc.
+#include <stdio.h>              //  Standard I/O definitions
+#include <string.h>             //  memcpy( ), memset( )
+                                //*******************************************
+#include <pthread.h>            //  POSIX threads
+                                //*******************************************
+
+/****************************************************************************
+ * Application APIs
+ ****************************************************************************/
+
+                                //*******************************************
+#include "global.h"             //  Global stuff for this application
+#include "libtools_api.h"       //  My Tools Library
+                                //*******************************************
+#include "rcb_api.h"            //  API for all rcb_*               PUBLIC
+#include "order_api.h"          //  API for all order_*             PUBLIC
+#include "order_lib.h"          //  API for all ORDER__*            PRIVATE
+                                //*******************************************
+
+/****************************************************************************
+ * Enumerations local to this file
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Definitions local to this file
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Structures local to this file
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Storage Allocation local to this file
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * LIB Functions
+ ****************************************************************************/
+
+/****************************************************************************/
+/**
+ *  Add an entry to the reorder buffer and release everything that is now
+ *  in order.
+ *
+ *  @param  file_seq            Input file sequence number
+ *  @param  recipe_seq          Recipe number in the file ( 0 = end of file )
+ *  @param  recipe_count        Number of recipes in the file (end of file)
+ *  @param  rcb_p               The recipe ( NULL = discarded )
+ *  @param  release_p           What to do with the recipe on its turn
+ *
+ *  @return void                No information is returned
+ *
+ *  @note
+ *      Each file in the pipeline has a slot holding a table indexed by
+ *      recipe_seq, so adding and finding the next recipe never scan.
+ *      The run that is ready is copied out under the lock and released
+ *      after it is dropped.  Only one thread releases at a time; anyone
+ *      who adds to the buffer meanwhile leaves the work for that thread.
+ *
+ ****************************************************************************/
+
+void
+ORDER__add(
+    int                         file_seq,
+    int                         recipe_seq,
+    int                         recipe_count,
+    struct  rcb_t           *   rcb_p,
+    void                    ( * release_p )( struct rcb_t * )
+    )
+{
+    /**
+     *  @param  file_p          Pointer to the slot for a file              */
+    struct  order_file_t    *   file_p;
+    /**
+     *  @param  entry_p         Pointer to a new (bigger) recipe table      */
+    struct  order_entry_t   *   entry_p;
+    /**
+     *  @param  entry_count     Number of slots in the new recipe table     */
+    int                         entry_count;
+    /**
+     *  @param  batch           Recipes to release once the lock is dropped */
+    struct  order_entry_t       batch[ ORDER_BATCH ];
+    /**
+     *  @param  batch_count     Number of recipes in the batch              */
+    int                         batch_count;
+    /**
+     *  @param  batch_ndx       Index into the batch                        */
+    int                         batch_ndx;
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+    pthread_mutex_lock( &order_mutex );
+
+    //  The slot for this file
+    file_p = &order_file_p[ file_seq % order_max_files ];
+    file_p->file_seq = file_seq;
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    //  Is it the end of the file ?
+    if ( recipe_seq == 0 )
+    {
+        //  YES:    Now we know how many recipes to wait for
+        file_p->ended        = true;
+        file_p->recipe_count = recipe_count;
+    }
+    else
+    {
+        //  NO:     Is the recipe table big enough ?
+        if ( recipe_seq >= file_p->entry_count )
+        {
+            //  NO:     Make it bigger
+            entry_count = ( file_p->entry_count > 0 ) ? file_p->entry_count
+                                                      : ORDER_RECIPES;
+            while ( recipe_seq >= entry_count )
+            {
+                entry_count *= 2;
+            }
+            entry_p = mem_malloc( entry_count * sizeof( struct order_entry_t ) );
+
+            //  Move anything that is already waiting
+            if ( file_p->entry_p != NULL )
+            {
+                memcpy( entry_p, file_p->entry_p,
+                        file_p->entry_count * sizeof( struct order_entry_t ) );
+                mem_free( file_p->entry_p );
+            }
+            file_p->entry_p     = entry_p;
+            file_p->entry_count = entry_count;
+        }
+
+        //  Park it in its slot
+        file_p->entry_p[ recipe_seq ].arrived   = true;
+        file_p->entry_p[ recipe_seq ].rcb_p     = rcb_p;
+        file_p->entry_p[ recipe_seq ].release_p = release_p;
+    }
+
+    //  Is another thread already releasing ?
+    if ( order_releasing != true )
+    {
+        //  NO:     Release everything that is now in order
+        order_releasing = true;
+
+        do
+        {
+            //  Collect the run that is ready
+            for( batch_count = 0;
+                 batch_count < ORDER_BATCH;
+                 )
+            {
+                file_p = &order_file_p[ order_head_file % order_max_files ];
+
+                //  Has anything arrived from the head file ?
+                if ( file_p->file_seq != order_head_file )
+                {
+                    //  NO:     Nothing more to do
+                    break;
+                }
+
+                //  Is the next recipe here ?
+                if (    ( order_head_recipe < file_p->entry_count )
+                     && ( file_p->entry_p[ order_head_recipe ].arrived == true ) )
+                {
+                    //  YES:    Was it thrown out ?
+                    entry_p = &file_p->entry_p[ order_head_recipe ];
+                    if ( entry_p->rcb_p != NULL )
+                    {
+                        //  NO:     Release it
+                        entry_p->rcb_p->order_released = true;
+                        batch[ batch_count++ ] = *entry_p;
+                    }
+                    order_head_recipe += 1;
+                }
+                //  Is the head file finished ?
+                else
+                if (    ( file_p->ended        == true )
+                     && ( file_p->recipe_count <  order_head_recipe ) )
+                {
+                    //  YES:    Free its slot and move on to the next file
+                    if ( file_p->entry_p != NULL )
+                    {
+                        mem_free( file_p->entry_p );
+                    }
+                    memset( file_p, 0, sizeof( struct order_file_t ) );
+                    order_head_file  += 1;
+                    order_head_recipe = 1;
+                    pthread_cond_broadcast( &order_cond );
+                }
+                else
+                {
+                    //  NO:     Still waiting on a gap
+                    break;
+                }
+            }
+
+            //  Did we collect anything ?
+            if ( batch_count == 0 )
+            {
+                //  NO:     Done releasing
+                order_releasing = false;
+            }
+            else
+            {
+                //  YES:    Release them without holding the lock
+                pthread_mutex_unlock( &order_mutex );
+
+                for( batch_ndx = 0;
+                     batch_ndx < batch_count;
+                     batch_ndx += 1 )
+                {
+                    batch[ batch_ndx ].release_p( batch[ batch_ndx ].rcb_p );
+                }
+
+                pthread_mutex_lock( &order_mutex );
+            }
+
+        }   while( batch_count != 0 );
+    }
+
+    pthread_mutex_unlock( &order_mutex );
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+}
+/****************************************************************************/
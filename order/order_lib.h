@@ -0,0 +1,168 @@
+/*******************************  COPYRIGHT  ********************************/
+/**
+ *  Author? "Gregory N. Leonhardt"
+ *  License? "CC BY-NC 2.0"
+ *           "https://creativecommons.org/licenses/by-nc/2.0/"
+ *
+ ****************************************************************************/
+
+#ifndef ORDER_LIB_H
+#define ORDER_LIB_H
+
+/******************************** JAVADOC ***********************************/
+/**
+ *  This file contains private definitions (etc.) that apply to internal
+ *  library components of the 'order' library.
+ *
+ *  @note
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ *  Compiler directives
+ ****************************************************************************/
+
+#ifdef ALLOC_ORDER
+   #define ORDER_EXT
+#else
+   #define ORDER_EXT        extern
+#endif
+
+/****************************************************************************
+ * System APIs
+ ****************************************************************************/
+
+                                //*******************************************
+#include <pthread.h>            //  POSIX threads
+                                //*******************************************
+
+/****************************************************************************
+ * Application APIs
+ ****************************************************************************/
+
+                                //*******************************************
+                                //*******************************************
+
+/****************************************************************************
+ * Library Private Definitions
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+/**
+ *  @param  ORDER_BATCH         Recipes released per trip through the lock  */
+#define ORDER_BATCH             (   32 )
+/**
+ *  @param  ORDER_RECIPES       First size of a file's recipe table         */
+#define ORDER_RECIPES           (   64 )
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Library Private Enumerations
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Library Private Structures
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+/**
+ *  @param  order_entry_t       A recipe that arrived ahead of its turn     */
+struct  order_entry_t
+{
+    /**
+     *  @param  arrived         TRUE once the recipe is finished            */
+    int                         arrived;
+    /**
+     *  @param  rcb_p           The recipe ( NULL = it was discarded )      */
+    struct  rcb_t           *   rcb_p;
+    /**
+     *  @param  release_p       What to do with the recipe on its turn      */
+    void                    ( * release_p )( struct rcb_t * );
+};
+//----------------------------------------------------------------------------
+/**
+ *  @param  order_file_t        Everything waiting from one input file      */
+struct  order_file_t
+{
+    /**
+     *  @param  file_seq        Input file sequence number ( 0 = unused )   */
+    int                         file_seq;
+    /**
+     *  @param  ended           TRUE once every recipe has been numbered    */
+    int                         ended;
+    /**
+     *  @param  recipe_count    Number of recipes in the file (when ended)  */
+    int                         recipe_count;
+    /**
+     *  @param  entry_count     Number of slots in the recipe table         */
+    int                         entry_count;
+    /**
+     *  @param  entry_p         Recipe table indexed by recipe_seq          */
+    struct  order_entry_t   *   entry_p;
+};
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Library Private Storage Allocation
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+/**
+ *  @param  order_strict        TRUE when the output order is enforced      */
+ORDER_EXT
+int                             order_strict;
+/**
+ *  @param  order_max_files     Files allowed past the oldest unfinished one*/
+ORDER_EXT
+int                             order_max_files;
+/**
+ *  @param  order_next_seq      Sequence number for the next input file     */
+ORDER_EXT
+int                             order_next_seq;
+/**
+ *  @param  order_head_file     File that is being released                 */
+ORDER_EXT
+int                             order_head_file;
+/**
+ *  @param  order_head_recipe   Next recipe to release from the head file   */
+ORDER_EXT
+int                             order_head_recipe;
+/**
+ *  @param  order_file_p        One slot per file: file_seq % max_files     */
+ORDER_EXT
+struct  order_file_t        *   order_file_p;
+/**
+ *  @param  order_releasing     TRUE while a thread is releasing recipes    */
+ORDER_EXT
+int                             order_releasing;
+/**
+ *  @param  order_mutex         Protects all of the above                   */
+ORDER_EXT
+pthread_mutex_t                 order_mutex;
+/**
+ *  @param  order_cond          Signaled when the head file is finished     */
+ORDER_EXT
+pthread_cond_t                  order_cond;
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Library Private Prototypes
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+void
+ORDER__add(
+    int                         file_seq,
+    int                         recipe_seq,
+    int                         recipe_count,
+    struct  rcb_t           *   rcb_p,
+    void                    ( * release_p )( struct rcb_t * )
+    );
+//----------------------------------------------------------------------------
+
+/****************************************************************************/
+
+#endif                      //    ORDER_LIB_H
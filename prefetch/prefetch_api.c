@@ -0,0 +1,327 @@
+/*******************************  COPYRIGHT  ********************************/
+/**
+ *  Author? "Gregory N. Leonhardt"
+ *  License? "CC BY-NC 2.0"
+ *           "https://creativecommons.org/licenses/by-nc/2.0/"
+ *
+ ****************************************************************************/
+
+/******************************** JAVADOC ***********************************/
+/**
+ *  This file contains public function that makeup the external
+ *  library components of the 'prefetch' library.
+ *
+ *  @note
+ *      When the prefetcher is off prefetch_file( ) returns FALSE and
+ *      nothing else is ever touched.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ *  Compiler directives
+ ****************************************************************************/
+
+#define ALLOC_PREFETCH          ( "ALLOCATE STORAGE FOR PREFETCH" )
+
+/****************************************************************************
+ * System Function API
+ ****************************************************************************/
+
+                                //*******************************************
+#include <stdint.h>             //  Alternative storage types
+#include <stdbool.h>            //  TRUE, FALSE, etc.
+#include <stdio.h>              //  Standard I/O definitions
+                                //*******************************************
+#include <pthread.h>            //  POSIX threads
+                                //*******************************************
+
+/****************************************************************************
+ * Application APIs
+ ****************************************************************************/
+
+                                //*******************************************
+#include "global.h"             //  Global stuff for this application
+#include "libtools_api.h"       //  My Tools Library
+                                //*******************************************
+#include "ring_api.h"           //  API for all ring_*              PUBLIC
+#include "prefetch_api.h"       //  API for all prefetch_*          PUBLIC
+#include "prefetch_lib.h"       //  API for all PREFETCH__*         PRIVATE
+                                //*******************************************
+
+/****************************************************************************
+ * Private API Enumerations
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Private API Definitions
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Private API Structures
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Private API Storage Allocation
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Public API Functions
+ ****************************************************************************/
+
+/****************************************************************************/
+/**
+ *  Turn on the read-ahead of input files.
+ *
+ *  @param  depth               Number of files that may be read ahead of
+ *                              IMPORT.
+ *
+ *  @return void                No information is returned
+ *
+ *  @note
+ *      Must be called before the first file is queued.  One reader thread
+ *      is started for every file in the window (up to PREFETCH_THREADS_MAX)
+ *      so that many reads are outstanding at once on a slow file system.
+ *
+ ****************************************************************************/
+
+void
+prefetch_init(
+    int                         depth
+    )
+{
+    /**
+     *  @param  thread_id       Reader thread                               */
+    pthread_t                   thread_id;
+    /**
+     *  @param  thread_count    Number of reader threads                    */
+    int                         thread_count;
+    /**
+     *  @param  ndx             Thread number                               */
+    int                         ndx;
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+    //  Keep the depth sane
+    if ( depth > PREFETCH_DEPTH_MAX )
+    {
+        depth = PREFETCH_DEPTH_MAX;
+    }
+
+    //  One reader per file in the window
+    thread_count = depth;
+    if ( thread_count > PREFETCH_THREADS_MAX )
+    {
+        thread_count = PREFETCH_THREADS_MAX;
+    }
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    //  Is the prefetcher wanted ?
+    if ( depth > 0 )
+    {
+        //  YES:    Create the window
+        pthread_mutex_init( &prefetch_mutex, NULL );
+        pthread_cond_init( &prefetch_cond, NULL );
+        prefetch_ahead  = 0;
+
+        //  Create the queue of file names
+        prefetch_ring_p = ring_new( depth, RING_WAIT_BLOCK );
+
+        //  Launch the readers
+        for ( ndx = 0; ndx < thread_count; ndx += 1 )
+        {
+            pthread_create( &thread_id, NULL, PREFETCH__thread, NULL );
+            pthread_detach( thread_id );
+        }
+
+        //  The prefetcher is now active
+        prefetch_depth  = depth;
+
+        //  Progress report.
+        log_write( MID_INFO, "prefetch",
+                   "Reading up to %d files ahead with %d threads.\n",
+                   depth, thread_count );
+    }
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+}
+
+/****************************************************************************/
+/**
+ *  Start reading a file that is about to be queued for IMPORT.
+ *
+ *  @param  file_name_p         Full path & name of the file
+ *
+ *  @return prefetch_flag       TRUE when the file was read ahead and the
+ *                              caller owes a call to prefetch_done( ).
+ *
+ *  @note
+ *      Waits while the window is full so the read-ahead never gets more
+ *      than 'depth' files in front of IMPORT (any further and the files
+ *      would be pushed back out of the page cache before they are used).
+ *
+ ****************************************************************************/
+
+int
+prefetch_file(
+    char                    *   file_name_p
+    )
+{
+    /**
+     *  @param  copy_p          The readers copy of the file name           */
+    char                    *   copy_p;
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+    //  Is the prefetcher active ?
+    if ( prefetch_depth == 0 )
+    {
+        //  NO:     Nothing to do
+        return( false );
+    }
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    pthread_mutex_lock( &prefetch_mutex );
+
+    //  Wait for room in the window
+    if ( prefetch_ahead >= prefetch_depth )
+    {
+        prefetch_waits += 1;
+
+        while ( prefetch_ahead >= prefetch_depth )
+        {
+            pthread_cond_wait( &prefetch_cond, &prefetch_mutex );
+        }
+    }
+
+    //  This file is now ahead of IMPORT
+    prefetch_ahead += 1;
+
+    pthread_mutex_unlock( &prefetch_mutex );
+
+    //  Hand the file name to a reader
+    copy_p = text_copy_to_new( file_name_p );
+    ring_put( prefetch_ring_p, copy_p );
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+    return( true );
+}
+
+/****************************************************************************/
+/**
+ *  IMPORT has started on a file that was read ahead.
+ *
+ *  @param  void                No parameters are passed into this function.
+ *
+ *  @return void                No information is returned
+ *
+ *  @note
+ *      Makes room in the window for one more file.
+ *
+ ****************************************************************************/
+
+void
+prefetch_done(
+    void
+    )
+{
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    pthread_mutex_lock( &prefetch_mutex );
+
+    //  One less file ahead of IMPORT
+    prefetch_ahead -= 1;
+
+    //  Wake up the file discovery
+    pthread_cond_signal( &prefetch_cond );
+
+    pthread_mutex_unlock( &prefetch_mutex );
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+}
+
+/****************************************************************************/
+/**
+ *  Report what the prefetcher did.
+ *
+ *  @param  void                No parameters are passed into this function.
+ *
+ *  @return void                No information is returned
+ *
+ ****************************************************************************/
+
+void
+prefetch_report(
+    void
+    )
+{
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    //  Was the prefetcher active ?
+    if ( prefetch_depth != 0 )
+    {
+        //  YES:    Progress report.
+        log_write( MID_INFO, "prefetch",
+                   "Read ahead %d files (%lld bytes); "
+                   "the window was full %d times.\n",
+                   __atomic_load_n( &prefetch_files, __ATOMIC_RELAXED ),
+                   __atomic_load_n( &prefetch_bytes, __ATOMIC_RELAXED ),
+                   prefetch_waits );
+    }
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+}
+/****************************************************************************/
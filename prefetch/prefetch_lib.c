@@ -0,0 +1,207 @@
+/*******************************  COPYRIGHT  ********************************/
+/**
+ *  Author? "Gregory N. Leonhardt"
+ *  License? "CC BY-NC 2.0"
+ *           "https://creativecommons.org/licenses/by-nc/2.0/"
+ *
+ ****************************************************************************/
+
+/******************************** JAVADOC ***********************************/
+/**
+ *  This file contains private functions that makeup the internal
+ *  library components of the 'prefetch' library.
+ *
+ *  @note
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ *  Compiler directives
+ ****************************************************************************/
+
+#define _GNU_SOURCE             //  readahead( )
+
+/****************************************************************************
+ * System Function API
+ ****************************************************************************/
+
+                                //*******************************************
+#include <stdint.h>             //  Alternative storage types
+#include <stdbool.h>            //  TRUE, FALSE, etc.
+#include <stdio.h>              //  Standard I/O definitions
+                                //*******************************************
+#include <fcntl.h>              //  open( ), posix_fadvise( ), readahead( )
+#include <unistd.h>             //  close( )
+#include <sys/stat.h>           //  fstat( )
+#include <pthread.h>            //  POSIX threads
+                                //*******************************************
+
+/****************************************************************************
+ * Application APIs
+ ****************************************************************************/
+
+                                //*******************************************
+#include "global.h"             //  Global stuff for this application
+#include "libtools_api.h"       //  My Tools Library
+                                //*******************************************
+#include "ring_api.h"           //  API for all ring_*              PUBLIC
+#include "prefetch_api.h"       //  API for all prefetch_*          PUBLIC
+#include "prefetch_lib.h"       //  API for all PREFETCH__*         PRIVATE
+                                //*******************************************
+
+/****************************************************************************
+ * Enumerations local to this file
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Definitions local to this file
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Structures local to this file
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Storage Allocation local to this file
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * LIB Functions
+ ****************************************************************************/
+
+/****************************************************************************/
+/**
+ *  Read a file into the page cache.
+ *
+ *  @param  file_name_p         Full path & name of the file
+ *
+ *  @return void                No information is returned
+ *
+ *  @note
+ *      posix_fadvise( ) only starts the read; readahead( ) waits for it.
+ *      Waiting here keeps this reader busy (and the next file queued) until
+ *      the data is really in memory.
+ *      A file that cannot be opened is left for IMPORT to report.
+ *
+ ****************************************************************************/
+
+void
+PREFETCH__read(
+    char                    *   file_name_p
+    )
+{
+    /**
+     *  @param  file_fd         File descriptor                             */
+    int                         file_fd;
+    /**
+     *  @param  file_stat       File status                                 */
+    struct  stat                file_stat;
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+    //  Open the file
+    file_fd = open( file_name_p, O_RDONLY );
+
+    //  Did it open ?
+    if ( file_fd < 0 )
+    {
+        //  NO:     IMPORT will find out
+        return;
+    }
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    //  How big is it ?
+    if (    ( fstat( file_fd, &file_stat ) == 0 )
+         && ( file_stat.st_size            >  0 ) )
+    {
+        //  Start the read
+        posix_fadvise( file_fd, 0, file_stat.st_size, POSIX_FADV_WILLNEED );
+
+        //  Wait for it
+        readahead( file_fd, 0, file_stat.st_size );
+
+        //  Count it
+        __atomic_add_fetch( &prefetch_files, 1, __ATOMIC_RELAXED );
+        __atomic_add_fetch( &prefetch_bytes, (long long)file_stat.st_size,
+                            __ATOMIC_RELAXED );
+    }
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  Close the file
+    close( file_fd );
+
+    //  DONE!
+}
+
+/****************************************************************************/
+/**
+ *  Read-ahead thread.
+ *
+ *  @param  void_p              Not used
+ *
+ *  @return NULL                Never
+ *
+ *  @note
+ *      Like the TCB threads, the readers live until the program ends.
+ *
+ ****************************************************************************/
+
+void    *
+PREFETCH__thread(
+    void                    *   void_p
+    )
+{
+    /**
+     *  @param  file_name_p     The next file to read                       */
+    char                    *   file_name_p;
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    //  Forever
+    while ( true )
+    {
+        //  Wait for the next file
+        file_name_p = ring_get( prefetch_ring_p );
+
+        //  Read it
+        PREFETCH__read( file_name_p );
+
+        //  Release the file name
+        mem_free( file_name_p );
+    }
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+    return( NULL );
+}
+/****************************************************************************/
@@ -0,0 +1,126 @@
+/*******************************  COPYRIGHT  ********************************/
+/**
+ *  Author? "Gregory N. Leonhardt"
+ *  License? "CC BY-NC 2.0"
+ *           "https://creativecommons.org/licenses/by-nc/2.0/"
+ *
+ ****************************************************************************/
+
+#ifndef PREFETCH_LIB_H
+#define PREFETCH_LIB_H
+
+/******************************** JAVADOC ***********************************/
+/**
+ *  This file contains private definitions (etc.) that apply to internal
+ *  library components of the 'prefetch' library.
+ *
+ *  @note
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ *  Compiler directives
+ ****************************************************************************/
+
+#ifdef ALLOC_PREFETCH
+   #define PREFETCH_EXT
+#else
+   #define PREFETCH_EXT     extern
+#endif
+
+/****************************************************************************
+ * System APIs
+ ****************************************************************************/
+
+                                //*******************************************
+#include <pthread.h>            //  POSIX threads
+                                //*******************************************
+
+/****************************************************************************
+ * Application APIs
+ ****************************************************************************/
+
+                                //*******************************************
+                                //*******************************************
+
+/****************************************************************************
+ * Library Private Definitions
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+#define PREFETCH_THREADS_MAX    (   16 )
+#define PREFETCH_DEPTH_MAX      ( 1024 )
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Library Private Enumerations
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Library Private Structures
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Library Private Storage Allocation
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+/**
+ *  @param  prefetch_depth      Files allowed ahead of IMPORT ( 0 = off )   */
+PREFETCH_EXT
+int                             prefetch_depth;
+/**
+ *  @param  prefetch_ahead      Files queued that IMPORT has not started    */
+PREFETCH_EXT
+int                             prefetch_ahead;
+/**
+ *  @param  prefetch_mutex      Protects prefetch_ahead                     */
+PREFETCH_EXT
+pthread_mutex_t                 prefetch_mutex;
+/**
+ *  @param  prefetch_cond       Signaled when IMPORT starts a file          */
+PREFETCH_EXT
+pthread_cond_t                  prefetch_cond;
+/**
+ *  @param  prefetch_ring_p     File names waiting to be read ahead         */
+PREFETCH_EXT
+struct  ring_t              *   prefetch_ring_p;
+/**
+ *  @param  prefetch_files      Number of files read ahead                  */
+PREFETCH_EXT
+int                             prefetch_files;
+/**
+ *  @param  prefetch_bytes      Number of bytes read ahead                  */
+PREFETCH_EXT
+long long                       prefetch_bytes;
+/**
+ *  @param  prefetch_waits      Times discovery waited for IMPORT           */
+PREFETCH_EXT
+int                             prefetch_waits;
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Library Private Prototypes
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+void
+PREFETCH__read(
+    char                    *   file_name_p
+    );
+//----------------------------------------------------------------------------
+void    *
+PREFETCH__thread(
+    void                    *   void_p
+    );
+//----------------------------------------------------------------------------
+
+/****************************************************************************/
+
+#endif                      //    PREFETCH_LIB_H
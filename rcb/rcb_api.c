@@ -46,6 +46,9 @@
 #include "rcb_api.h"            //  API for all rcb_*               PUBLIC
 #include "rcb_lib.h"            //  API for all RCB__*              PRIVATE
                                 //*******************************************
+#include "order_api.h"          //  API for all order_*             PUBLIC
+#include "import_api.h"         //  API for all import_*            PUBLIC
+                                //*******************************************
 
 /****************************************************************************
  * Private API Enumerations
@@ -99,6 +102,9 @@ rcb_kill(
     /**
      * @param list_data_p       Pointer to the read data                    */
     char                    *   data_p;
+    /**
+     * @param file_rcb_p        File RCB of a split part                    */
+    struct  rcb_t           *   file_rcb_p;
 
 
     /************************************************************************
@@ -110,17 +116,20 @@ rcb_kill(
      *  Function Body
      ************************************************************************/
 
-    //  Does a file information structure exist ?
-    if ( rcb_p->file_info_p != NULL )
+    //  Let the reorder buffer know this one is gone
+    order_discard( rcb_p );
+
+    //  Does it point at file and e-Mail information ?
+    if ( rcb_p->info_p != NULL )
     {
-        //  YES:    Free it
-        mem_free( rcb_p->file_info_p );
-        rcb_p->file_info_p = NULL;
+        //  YES:    Let go of it
+        RCB__info_release( rcb_p->info_p );
+        rcb_p->info_p       = NULL;
+        rcb_p->file_info_p  = NULL;
+        rcb_p->email_info_p = NULL;
+        rcb_p->file_path    = NULL;
     }
     //------------------------------------------------------------------------
-    //  Clear the display name string
-    memset( rcb_p->file_path, '\0', sizeof( rcb_p->file_path ) );
-    //------------------------------------------------------------------------
     //  Reset the destination thread id.
     rcb_p->dst_thread = DST_INVALID;
     //------------------------------------------------------------------------
@@ -132,13 +141,21 @@ rcb_kill(
             while( ( data_p = list_get_first( rcb_p->import_list_p ) ) != NULL )
             {
                 list_delete_payload( rcb_p->import_list_p, data_p );
-                mem_free( data_p );
+                import_line_free( rcb_p, data_p );
             }
         }
         list_kill( rcb_p->import_list_p );
         rcb_p->import_list_p = NULL;
     }
     //------------------------------------------------------------------------
+    //  Is the input file mapped ?
+    if ( rcb_p->import_map_p != NULL )
+    {
+        //  YES:    Let go of the mapping
+        import_map_release( rcb_p->import_map_p );
+        rcb_p->import_map_p = NULL;
+    }
+    //------------------------------------------------------------------------
     //  Clear all export data
     if ( rcb_p->export_list_p != NULL )
     {
@@ -179,16 +196,28 @@ rcb_kill(
         rcb_p->db_recipe_p = NULL;
     }
     //------------------------------------------------------------------------
-    //  Does an e-Mail information structure exist ?
-    if ( rcb_p->email_info_p != NULL )
+    //  Is there any e-Mail split state ?
+    if ( rcb_p->email_ctx_p != NULL )
     {
         //  YES:    Free it
-        mem_free( rcb_p->email_info_p );
-        rcb_p->email_info_p = NULL;
+        mem_free( rcb_p->email_ctx_p );
+        rcb_p->email_ctx_p = NULL;
     }
     //------------------------------------------------------------------------
+    //  Is this a split part of a file ?
+    file_rcb_p = rcb_p->file_rcb_p;
+    //------------------------------------------------------------------------
     //  Release the structure
     mem_free( rcb_p );
+    //------------------------------------------------------------------------
+    //  Was that the last part of the file ?
+    if (    ( file_rcb_p != NULL )
+         && ( __atomic_sub_fetch( &file_rcb_p->part_count, 1,
+                                  __ATOMIC_ACQ_REL ) == 0 ) )
+    {
+        //  YES:    Every recipe in the file has been numbered
+        rcb_kill( file_rcb_p );
+    }
 
     /************************************************************************
      *  Function Exit
@@ -217,6 +246,12 @@ rcb_new(
     /**
      *  @param  new_rcb_p       Pointer to a Recipe Control Block           */
     struct  rcb_t           *   new_rcb_p;
+    /**
+     *  @param  file_rcb_p      The RCB that numbers the recipes            */
+    struct  rcb_t           *   file_rcb_p;
+    /**
+     *  @param  info_p          New file and e-Mail information             */
+    struct  rcb_info_t      *   info_p;
 
     /************************************************************************
      *  Function Initialization
@@ -230,18 +265,28 @@ rcb_new(
     //  YES:    Allocate a new recipe control block
     new_rcb_p = mem_malloc( sizeof( struct rcb_t ) );
 
-    //  Create a new e-Mail information structure for the new RCB
-    new_rcb_p->email_info_p = mem_malloc( sizeof( struct email_info_t ) );
-
-    //  Create an new file information buffer
-    new_rcb_p->file_info_p = mem_malloc( sizeof( struct file_info_t ) );
-
     //  No destination thread yet.
     new_rcb_p->dst_thread = DST_INVALID;
 
     //  Create a new import list
     new_rcb_p->import_list_p = list_new( );
 
+    //  The input file isn't mapped
+    new_rcb_p->import_map_p = NULL;
+
+    //  The whole file is one chunk (unless it is streamed)
+    new_rcb_p->chunk_l      = 0;
+    new_rcb_p->chunk_eof    = true;
+    new_rcb_p->chunk_last   = true;
+    new_rcb_p->chunk_busy   = false;
+    new_rcb_p->email_ctx_p  = NULL;
+
+    //  Not a split part of a file
+    new_rcb_p->line_first   = 0;
+    new_rcb_p->line_end     = 0;
+    new_rcb_p->file_rcb_p   = NULL;
+    new_rcb_p->part_count   = 0;
+
     //  Create a new export list
     new_rcb_p->export_list_p = list_new( );
 
@@ -251,41 +296,67 @@ rcb_new(
     //  Clear the TCB pointer
     new_rcb_p->tcb_p = NULL;
 
-    //  Clear the file stats structure
-    memset( new_rcb_p->file_info_p, 0x00, sizeof( struct file_info_t ) );
+    //  Set the default recipe format
+    new_rcb_p->recipe_format = RECIPE_FORMAT_NONE;
 
-    //  Clear the display file name string
-    memset( new_rcb_p->file_path, 0x00, sizeof( new_rcb_p->file_path ) );
+    //  Not numbered (yet)
+    new_rcb_p->file_seq       = 0;
+    new_rcb_p->recipe_seq     = 0;
+    new_rcb_p->recipe_count   = 0;
+    new_rcb_p->order_released = false;
 
-    //  Clear the e-Mail structure
-    memset( new_rcb_p->email_info_p, 0x00, sizeof( struct email_info_t ) );
+    //  Not read ahead (yet)
+    new_rcb_p->prefetched     = false;
 
-    //  Set the default recipe format
-    new_rcb_p->recipe_format = RECIPE_FORMAT_NONE;
+    //  Not in the manifest
+    new_rcb_p->manifest_p     = NULL;
 
     //  Is this going to be a clone of an existing Recipe Control Block
-    if ( old_rcb_p != NULL )
+    if ( old_rcb_p == NULL )
+    {
+        //  NO:     Empty file stats, display file name and e-Mail structure
+        info_p = mem_malloc( sizeof( struct rcb_info_t ) );
+        memset( info_p, 0x00, sizeof( struct rcb_info_t ) );
+        info_p->ref_count = 1;
+
+        RCB__info_set( new_rcb_p, info_p );
+    }
+    else
     {
         //  YES:    Copy Thread Control Block pointer
         new_rcb_p->tcb_p = old_rcb_p->tcb_p;
 
-        //  Copy the file stats to the new RCB
-        memcpy( new_rcb_p->file_info_p,
-                old_rcb_p->file_info_p,
-                sizeof( struct file_info_t ) );
-
-        //  Copy the display file name
-        memcpy( new_rcb_p->file_path,
-                old_rcb_p->file_path,
-                sizeof( old_rcb_p->file_path ) );
-
-        //  Copy the e-Mail information to the new RCB
-        memcpy( new_rcb_p->email_info_p,
-                old_rcb_p->email_info_p,
-                sizeof( struct email_info_t ) );
+        //  Share the file stats, display file name and e-Mail information
+        //  (they are only copied if one of the RCBs changes them)
+        new_rcb_p->info_p = NULL;
+        rcb_info_share( new_rcb_p, old_rcb_p );
 
         //  Set the recipe format
         new_rcb_p->recipe_format = old_rcb_p->recipe_format;
+
+        //  Share the mapped input file (the recipe lines point into it)
+        if ( old_rcb_p->import_map_p != NULL )
+        {
+            new_rcb_p->import_map_p = old_rcb_p->import_map_p;
+            import_map_hold( new_rcb_p->import_map_p );
+        }
+
+        //  Is the old RCB a split part of a file ?
+        if ( old_rcb_p->file_rcb_p != NULL )
+        {
+            //  YES:    The file numbers the recipes of all of its parts
+            file_rcb_p = old_rcb_p->file_rcb_p;
+        }
+        else
+        {
+            //  NO:     It is the file
+            file_rcb_p = old_rcb_p;
+        }
+
+        //  Number the recipe: same file, next recipe in the file
+        new_rcb_p->file_seq      = file_rcb_p->file_seq;
+        new_rcb_p->recipe_seq    = __atomic_add_fetch( &file_rcb_p->recipe_count,
+                                                       1, __ATOMIC_RELAXED );
     }
 
     /************************************************************************
@@ -295,4 +366,108 @@ rcb_new(
     //  DONE!
     return( new_rcb_p );
 }
-/****************************************************************************/
\ No newline at end of file
+
+/****************************************************************************/
+/**
+ *  Point a Recipe Control Block at another one's file and e-Mail
+ *  information.
+ *
+ *  @param  rcb_p               Pointer to a Recipe Control Block
+ *  @param  from_rcb_p          Pointer to the RCB with the information
+ *
+ *  @return void                No information is returned
+ *
+ *  @note
+ *      Nothing is copied.  Whatever rcb_p pointed at before is let go.
+ *
+ ****************************************************************************/
+
+void
+rcb_info_share(
+    struct  rcb_t           *   rcb_p,
+    struct  rcb_t           *   from_rcb_p
+    )
+{
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+    //  One more user
+    __atomic_add_fetch( &from_rcb_p->info_p->ref_count, 1, __ATOMIC_RELAXED );
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    //  Let go of the old information
+    if ( rcb_p->info_p != NULL )
+    {
+        RCB__info_release( rcb_p->info_p );
+    }
+
+    //  Point at the shared information
+    RCB__info_set( rcb_p, from_rcb_p->info_p );
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+}
+
+/****************************************************************************/
+/**
+ *  Get a private copy of the file and e-Mail information before changing it.
+ *
+ *  @param  rcb_p               Pointer to a Recipe Control Block
+ *
+ *  @return void                No information is returned
+ *
+ *  @note
+ *      Must be called before anything is written into file_info_p,
+ *      email_info_p or file_path.  The file RCB and all of the recipes
+ *      from one e-Mail message point at the same information, so it is only
+ *      copied when someone changes it while it is shared (once per message
+ *      while splitting a file).
+ *
+ ****************************************************************************/
+
+void
+rcb_info_own(
+    struct  rcb_t           *   rcb_p
+    )
+{
+    /**
+     *  @param  info_p          Private copy of the information             */
+    struct  rcb_info_t      *   info_p;
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    //  Is anybody else pointing at it ?
+    if ( __atomic_load_n( &rcb_p->info_p->ref_count, __ATOMIC_ACQUIRE ) > 1 )
+    {
+        //  YES:    Make a copy
+        info_p = mem_malloc( sizeof( struct rcb_info_t ) );
+        memcpy( info_p, rcb_p->info_p, sizeof( struct rcb_info_t ) );
+        info_p->ref_count = 1;
+
+        //  Use the copy
+        RCB__info_release( rcb_p->info_p );
+        RCB__info_set( rcb_p, info_p );
+    }
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+}
+/****************************************************************************/
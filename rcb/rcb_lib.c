@@ -39,6 +39,8 @@
 #include "global.h"             //  Global stuff for this application
 #include "libtools_api.h"       //  My Tools Library
                                 //*******************************************
+#include "email_api.h"          //  API for all email_*             PUBLIC
+                                //*******************************************
 #include "rcb_api.h"            //  API for all rcb_*               PUBLIC
 #include "rcb_lib.h"            //  API for all RCB__*              PRIVATE
                                 //*******************************************
@@ -112,4 +114,87 @@ RCB__FooBar(
     //  DONE!
     return ( 0 );
 }
+
+/****************************************************************************/
+/**
+ *  Point a Recipe Control Block at its file and e-Mail information.
+ *
+ *  @param  rcb_p               Pointer to a Recipe Control Block
+ *  @param  info_p              The information ( the caller's reference )
+ *
+ *  @return void                No information is returned
+ *
+ *  @note
+ *
+ ****************************************************************************/
+
+void
+RCB__info_set(
+    struct  rcb_t           *   rcb_p,
+    struct  rcb_info_t      *   info_p
+    )
+{
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    rcb_p->info_p       = info_p;
+    rcb_p->file_info_p  = &info_p->file_info;
+    rcb_p->email_info_p = &info_p->email_info;
+    rcb_p->file_path    = info_p->file_path;
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+}
+
+/****************************************************************************/
+/**
+ *  A Recipe Control Block no longer points at the information.
+ *
+ *  @param  info_p              The information
+ *
+ *  @return void                No information is returned
+ *
+ *  @note
+ *      The last one out frees it.
+ *
+ ****************************************************************************/
+
+void
+RCB__info_release(
+    struct  rcb_info_t      *   info_p
+    )
+{
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    //  Was this the last user ?
+    if ( __atomic_sub_fetch( &info_p->ref_count, 1, __ATOMIC_ACQ_REL ) == 0 )
+    {
+        //  YES:    Free it
+        mem_free( info_p );
+    }
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+}
 /****************************************************************************/
@@ -61,6 +61,24 @@
  ****************************************************************************/
 
 //----------------------------------------------------------------------------
+/**
+ *  @param  rcb_info_t          File and e-Mail header information shared by
+ *                              a file and the recipes that came from it    */
+struct  rcb_info_t
+{
+    /**
+     *  @param  ref_count       RCBs that point here (ATOMIC access)        */
+    int                         ref_count;
+    /**
+     *  @param  file_info       File information                            */
+    struct  file_info_t         file_info;
+    /**
+     *  @param  email_info      e-Mail from, date, time etc                 */
+    struct  email_info_t        email_info;
+    /**
+     *  @param  file_path       File path & name                            */
+    char                        file_path[ RCB_FILE_PATH_L ];
+};
 //----------------------------------------------------------------------------
 
 /****************************************************************************
@@ -77,6 +95,16 @@ int                             rcb_lib;
  ****************************************************************************/
 
 //----------------------------------------------------------------------------
+void
+RCB__info_set(
+    struct  rcb_t           *   rcb_p,
+    struct  rcb_info_t      *   info_p
+    );
+//----------------------------------------------------------------------------
+void
+RCB__info_release(
+    struct  rcb_info_t      *   info_p
+    );
 //----------------------------------------------------------------------------
 
 /****************************************************************************/
@@ -108,6 +108,9 @@ recipe_new(
     /**
      *  @param recipe_t         Primary structure for a recipe              */
     struct   recipe_t       *   recipe_p;
+    /**
+     *  @param format_p         The recipe format                           */
+    struct  decode_format_t *   format_p;
 
     /************************************************************************
      *  Function Initialization
@@ -138,102 +141,14 @@ recipe_new(
     recipe_p->notes_p      = list_new( );
 
     //  Save the original recipe format
-    switch( recipe_format )
-    {
-        //--------------------------------------------------------------------
-        case    RECIPE_FORMAT_MXP:
-        {
-            //  MasterCook eXport
-            recipe_p->source_format_p = text_copy_to_new( "MXP" );
-            log_write( MID_DEBUG_1, "recipe_api.c", "Line: %d\n", __LINE__ );
-
-        }   break;
-        //--------------------------------------------------------------------
-        case    RECIPE_FORMAT_MX2:
-        {
-            //  MasterCook eXport Ver. 2
-            recipe_p->source_format_p = text_copy_to_new( "MX2" );
-            log_write( MID_DEBUG_1, "recipe_api.c", "Line: %d\n", __LINE__ );
-
-        }   break;
-        //--------------------------------------------------------------------
-        case    RECIPE_FORMAT_MMF:
-        {
-            //  Meal-Master Format
-            recipe_p->source_format_p = text_copy_to_new( "MMF" );
-            log_write( MID_DEBUG_1, "recipe_api.c", "Line: %d\n", __LINE__ );
-
-        }   break;
-        //--------------------------------------------------------------------
-        case    RECIPE_FORMAT_RXF:
-        {
-            //  Recipe eXchange Format (Native)
-            recipe_p->source_format_p = text_copy_to_new( "RXF" );
-            log_write( MID_DEBUG_1, "recipe_api.c", "Line: %d\n", __LINE__ );
-
-        }   break;
-        //--------------------------------------------------------------------
-        case    RECIPE_FORMAT_NYC:
-        {
-            //  Now Your Cooking!
-            recipe_p->source_format_p = text_copy_to_new( "NYC" );
-            log_write( MID_DEBUG_1, "recipe_api.c", "Line: %d\n", __LINE__ );
-
-        }   break;
-        //--------------------------------------------------------------------
-        case    RECIPE_FORMAT_ERD:
-        {
-            //  Easy Recipe Deluxe
-            recipe_p->source_format_p = text_copy_to_new( "ERD" );
-            log_write( MID_DEBUG_1, "recipe_api.c", "Line: %d\n", __LINE__ );
-
-        }   break;
-        //--------------------------------------------------------------------
-        case    RECIPE_FORMAT_BOF:
-        {
-            //  Big Oven Format
-            recipe_p->source_format_p = text_copy_to_new( "BOF" );
-            log_write( MID_DEBUG_1, "recipe_api.c", "Line: %d\n", __LINE__ );
-
-        }   break;
-        //--------------------------------------------------------------------
-        case    RECIPE_FORMAT_CP2:
-        {
-            //  Cooken Pro 2.0
-            recipe_p->source_format_p = text_copy_to_new( "CP2" );
-            log_write( MID_DEBUG_1, "recipe_api.c", "Line: %d\n", __LINE__ );
-
-        }   break;
-        //--------------------------------------------------------------------
-        case    RECIPE_FORMAT_GRF:
-        {
-            //  Generic Format #1     [[[[[
-            recipe_p->source_format_p = text_copy_to_new( "GRF" );
-            log_write( MID_DEBUG_1, "recipe_api.c", "Line: %d\n", __LINE__ );
-
-        }   break;
-        //--------------------------------------------------------------------
-        case    RECIPE_FORMAT_GF2:
-        {
-            //  Generic Format #2     @@@@@
-            recipe_p->source_format_p = text_copy_to_new( "GF2" );
-            log_write( MID_DEBUG_1, "recipe_api.c", "Line: %d\n", __LINE__ );
-
-        }   break;
-        //--------------------------------------------------------------------
-        case    RECIPE_FORMAT_TXT:
-        {
-            //  Unformatted text data
-            recipe_p->source_format_p = text_copy_to_new( "TXT" );
-            log_write( MID_DEBUG_1, "recipe_api.c", "Line: %d\n", __LINE__ );
+    format_p = decode_format( recipe_format );
 
-        }   break;
-        //--------------------------------------------------------------------
-        default:
-        {
-            //  For the unused case types.
-        }
-        //--------------------------------------------------------------------
+    //  Is it a known format ?
+    if ( format_p != NULL )
+    {
+        //  YES:    Save its name
+        recipe_p->source_format_p = text_copy_to_new( format_p->name_p );
+        log_write( MID_DEBUG_1, "recipe_api.c", "Line: %d\n", __LINE__ );
     }
 //log_write( MID_INFO, "recipe_new", "Recipe Format -- %s\n", recipe_p->source_format_p );
 
@@ -488,107 +403,8 @@ recipe_is_start(
      *  Function
      ************************************************************************/
 
-    //-------------------------------------------------------------------
-    //  Big-Oven BOF
-    if (    ( recipe_format == RECIPE_FORMAT_NONE )
-         && ( bof_is_start( data_p ) == true ) )
-    {
-        //  YES:    Set the format to use
-        recipe_format = RECIPE_FORMAT_BOF;
-    }
-#if 0   //  @ToDo: 3 cp2_is_start()
-    //-------------------------------------------------------------------
-    //  CookenPro 2.0
-    else
-    if (    ( recipe_format == RECIPE_FORMAT_NONE )
-         && ( cp2_is_start( data_p ) == true ) )
-    {
-        //  YES:    Set the format to use
-        recipe_format = RECIPE_FORMAT_CP2;
-    }
-#endif
-#if 0   //  @ToDo: 3 erd_is_start()
-    //-------------------------------------------------------------------
-    //  Easy Recipe Deluxe
-    else
-    if (    ( recipe_format == RECIPE_FORMAT_NONE )
-         && ( erd_is_start( data_p ) == true ) )
-    {
-        //  YES:    Set the format to use
-        recipe_format = RECIPE_FORMAT_ERD;
-    }
-#endif
-#if 0   //  @ToDo: 3 gf2_is_start()
-    //-------------------------------------------------------------------
-    //  Generic-Recipe-Format @@@@@
-    else
-    if (    ( recipe_format == RECIPE_FORMAT_NONE )
-         && ( gf2_is_start( data_p ) == true ) )
-    {
-        //  YES:    Set the format to use
-        recipe_format = RECIPE_FORMAT_GF2;
-    }
-#endif
-#if 0   //  @ToDo: 3 grf_is_start()
-    //-------------------------------------------------------------------
-    //  Generic-Recipe-Format [[[[[
-    else
-    if (    ( recipe_format == RECIPE_FORMAT_NONE )
-         && ( grf_is_start( data_p ) == true ) )
-    {
-        //  YES:    Set the format to use
-        recipe_format = RECIPE_FORMAT_GRF;
-    }
-    //-------------------------------------------------------------------
-    //  Meal-Master
-    else
-#endif
-    if (    ( recipe_format == RECIPE_FORMAT_NONE )
-         && ( mmf_is_start( data_p ) == true ) )
-    {
-        //  YES:    Set the format to use
-        recipe_format = RECIPE_FORMAT_MMF;
-    }
-#if 0   //  @ToDo: 3 mx2_is_start()
-    //-------------------------------------------------------------------
-    //  MasterCook MX2
-    else
-    if (    ( recipe_format == RECIPE_FORMAT_NONE )
-         && ( mx2_is_start( data_p ) == true ) )
-    {
-        //  YES:    Set the format to use
-        recipe_format = RECIPE_FORMAT_MX2;
-    }
-#endif
-    //-------------------------------------------------------------------
-    //  MasterCook MXP
-    else
-    if (    ( recipe_format == RECIPE_FORMAT_NONE )
-         && ( mxp_is_start( data_p ) == true ) )
-    {
-        //  YES:    Set the format to use
-        recipe_format = RECIPE_FORMAT_MXP;
-    }
-#if 0   //  @ToDo: 3 nyc_is_start()
-    //-------------------------------------------------------------------
-    //  Now You're Cooking!
-    else
-    if (    ( recipe_format == RECIPE_FORMAT_NONE )
-         && ( nyc_is_start( data_p ) == true ) )
-    {
-        //  YES:    Set the format to use
-        recipe_format = RECIPE_FORMAT_NYC;
-    }
-#endif
-    //-------------------------------------------------------------------
-    //  Recipe eXchange Format
-    else
-    if (    ( recipe_format == RECIPE_FORMAT_NONE )
-         && ( rxf_is_start( data_p ) == true ) )
-    {
-        //  YES:    Set the format to use
-        recipe_format = RECIPE_FORMAT_RXF;
-    }
+    //  One table lookup finds the formats worth testing
+    recipe_format = RECIPE__start( data_p );
 
     /************************************************************************
      *  Function Exit
@@ -610,6 +426,8 @@ recipe_is_start(
  *                              else FALSE is returned.
  *
  *  @note
+ *      Only the end markers for recipe_format are tested, so a Meal-Master
+ *      "-----" line does not end a MasterCook recipe.
  *
  ****************************************************************************/
 
@@ -637,36 +455,8 @@ recipe_is_end(
      *  Function
      ************************************************************************/
 
-    //  NOTE:
-    //  When a MXP formatted recipe is embedded inside a MX2, this was
-    //  producing a false positive for a recipe break.  If this creates a
-    //  problem then I will have to pass the current recipe type for
-    //  additional testing.
-
-    //  NOTE:
-    //  MX2 is a special case because it may contain an embedded MXP recipe
-    //  inside it.
-
-    //  Is this something that can end a recipe ?
-    if (    ( mmf_is_end(           data_p ) == true )
-         || ( bof_is_end(           data_p ) == true )
-//  @ToDo: 3 cp2_is_end
-//       || ( cp2_is_end(           data_p ) == true )
-//  @ToDo: 3 gf2_is_end
-//       || ( gf2_is_end(           data_p ) == true )
-//  @ToDo: 3 grf_is_end
-//       || ( grf_is_end(           data_p ) == true )
-//  @ToDo: 3 mx2_is_end
-//       || ( mx2_is_end(           data_p ) == true )
-//       || (    ( recipe_format != RECIPE_FORMAT_MX2 )
-//            && ( mxp_is_start(    data_p ) == true ) )
-//  @ToDo: 3 nyc_is_end
-//       || ( nyc_is_end(           data_p ) == true ) )
-                                                        )
-    {
-        //  YES:    Change the return code
-        decode_rc = true;
-    }
+    //  Is this something that can end a recipe of this format ?
+    decode_rc = RECIPE__end( recipe_format, data_p );
 
     /************************************************************************
      *  Function Exit
@@ -675,4 +465,51 @@ recipe_is_end(
     //  DONE!
     return( decode_rc );
 }
+
+/****************************************************************************/
+/**
+ *  Test a whole file for anything that could start a recipe.
+ *
+ *  @param  data_p              Pointer to the file data
+ *  @param  data_l              Length of the file data
+ *
+ *  @return recipe_rc           TRUE when the file may hold a recipe
+ *                              else FALSE is returned.
+ *
+ *  @note
+ *      A FALSE is certain, a TRUE is not: every start marker contains one
+ *      of the key texts of its decode format, but a key text alone doesn't
+ *      start a recipe.  A file with a base64 body is always TRUE.
+ *
+ ****************************************************************************/
+
+int
+recipe_scan(
+    char                    *   data_p,
+    size_t                      data_l
+    )
+{
+    /**
+     *  @param  recipe_rc       Return code from this function              */
+    int                         recipe_rc;
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+
+    /************************************************************************
+     *  Function
+     ************************************************************************/
+
+    //  Look for the key texts
+    recipe_rc = RECIPE__scan( data_p, data_l );
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+    return( recipe_rc );
+}
 /****************************************************************************/
\ No newline at end of file
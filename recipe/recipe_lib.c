@@ -31,6 +31,10 @@
                                 //*******************************************
 #include <ctype.h>              //  Determine the type contained
 #include <string.h>             //  Functions for managing strings
+#include <pthread.h>            //  pthread_once( )
+#if defined( __SSE2__ )
+#include <emmintrin.h>          //  SSE2 intrinsics
+#endif
                                 //*******************************************
 
 /****************************************************************************
@@ -41,6 +45,9 @@
 #include "global.h"             //  Global stuff for this application
 #include "libtools_api.h"       //  My Tools Library
                                 //*******************************************
+#include "tcb_api.h"            //  API for all tcb_*               PUBLIC
+#include "rcb_api.h"            //  API for all rcb_*               PUBLIC
+#include "decode_api.h"         //  API for all decode_*            PUBLIC
                                 //*******************************************
 #include "recipe_api.h"         //  API for all recipe_*            PUBLIC
 #include "recipe_lib.h"         //  API for all RECIPE__*           PRIVATE
@@ -58,6 +65,15 @@
  ****************************************************************************/
 
 //----------------------------------------------------------------------------
+/**
+ *  Characters from the most to the least common in (English) text.
+ *  Anything not listed is less common than all of them.                    */
+#define RECIPE_COMMON           " etaoinsrhldcumfpgwybvkxjqz"
+//----------------------------------------------------------------------------
+/**
+ *  A base64 encoded body is only decoded by EMAIL, so its markers can't
+ *  be seen in the file.                                                    */
+#define RECIPE_KEY_ENCODED      "base64"
 //----------------------------------------------------------------------------
 
 /****************************************************************************
@@ -72,10 +88,558 @@
  ****************************************************************************/
 
 //----------------------------------------------------------------------------
+/**
+ *  @param  marker_p            A format that has markers (NULL = none).
+ *                              When two formats can both match the same
+ *                              line the one with the lower format number
+ *                              wins.                                       */
+static
+struct  decode_format_t     *   marker_p[ RECIPE_MARKER_MAX ];
+/**
+ *  @param  start_first         Formats that have a start marker beginning
+ *                              with this character                         */
+static
+uint32_t                        start_first[ 256 ];
+/**
+ *  @param  end_first           Formats that have an end marker beginning
+ *                              with this character                         */
+static
+uint32_t                        end_first[ 256 ];
+/**
+ *  @param  key_table           Every key text of every format              */
+static
+struct  recipe_key_t            key_table[ RECIPE_KEY_MAX ];
+/**
+ *  @param  key_count           Number of keys in the key table             */
+static
+int                             key_count;
+/**
+ *  @param  marker_once         Builds the tables above once                */
+static
+pthread_once_t                  marker_once = PTHREAD_ONCE_INIT;
 //----------------------------------------------------------------------------
 
 /****************************************************************************
  * LIB Functions
  ****************************************************************************/
 
-/****************************************************************************/
\ No newline at end of file
+/****************************************************************************/
+/**
+ *  Add a text to the key table.
+ *
+ *  @param  key_p               Lower case text to look for
+ *
+ *  @return void                No information is returned
+ *
+ *  @note
+ *      A whole file scan only looks closer at the places where the two
+ *      least common characters of a key are found.
+ *
+ ****************************************************************************/
+
+static
+void
+RECIPE__key_add(
+    char                    *   key_p
+    )
+{
+    /**
+     *  @param  key_t_p         The new key                                 */
+    struct  recipe_key_t    *   key_t_p;
+    /**
+     *  @param  ndx             Offset into the text                        */
+    size_t                      ndx;
+    /**
+     *  @param  rarity          How uncommon a pair of characters is        */
+    int                         rarity;
+    /**
+     *  @param  best            The most uncommon pair so far               */
+    int                         best;
+    /**
+     *  @param  pair            Character of the pair                       */
+    int                         pair;
+    /**
+     *  @param  common_p        Where the character is in the common list   */
+    char                    *   common_p;
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+    //  Is there room for it ?
+    if ( key_count >= RECIPE_KEY_MAX )
+    {
+        //  NO:     Too many keys
+        log_write( MID_FATAL, "recipe",
+                   "Too many recipe keys at '%s'\n", key_p );
+    }
+
+    //  Start with the first pair
+    key_t_p         = &key_table[ key_count ];
+    key_t_p->key_p  = key_p;
+    key_t_p->key_l  = strlen( key_p );
+    key_t_p->anchor = 0;
+    best            = -1;
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    //  Find the least common pair of characters
+    for ( ndx = 0; ndx + 1 < key_t_p->key_l; ndx += 1 )
+    {
+        for ( rarity = 0, pair = 0; pair < 2; pair += 1 )
+        {
+            common_p = strchr( RECIPE_COMMON, key_p[ ndx + pair ] );
+            rarity  += ( common_p != NULL ) ? (int)( common_p - RECIPE_COMMON )
+                                            : (int)sizeof( RECIPE_COMMON );
+        }
+
+        if ( rarity > best )
+        {
+            best            = rarity;
+            key_t_p->anchor = ndx;
+        }
+    }
+
+    //  Keep it
+    key_count += 1;
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+}
+
+/****************************************************************************/
+/**
+ *  Build the first character dispatch tables from the decode formats.
+ *
+ *  @param  void                No parameters
+ *
+ *  @return void                No information is returned
+ *
+ *  @note
+ *      Called once through pthread_once( ).
+ *
+ ****************************************************************************/
+
+static
+void
+RECIPE__compile(
+    void
+    )
+{
+    /**
+     *  @param  recipe_format   A format                                    */
+    int                         recipe_format;
+    /**
+     *  @param  format_p        Pointer to the format                       */
+    struct  decode_format_t *   format_p;
+    /**
+     *  @param  first_p         Pointer to a list of first characters       */
+    unsigned char           *   first_p;
+    /**
+     *  @param  bit             Bit for the format                          */
+    uint32_t                    bit;
+    /**
+     *  @param  key_ndx         Index into the key list                     */
+    int                         key_ndx;
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    //  Add every format that has a start marker
+    for ( recipe_format = 0;
+          recipe_format < DECODE_FORMAT_MAX;
+          recipe_format += 1 )
+    {
+        format_p = decode_format( recipe_format );
+
+        //  Can this format be found ?
+        if (    ( format_p             == NULL )
+             || ( format_p->is_start_p == NULL ) )
+        {
+            //  NO:     Nothing to add
+            continue;
+        }
+
+        //  Does it fit in a bit map ?
+        if ( recipe_format >= RECIPE_MARKER_MAX )
+        {
+            //  NO:     It can't be found
+            log_write( MID_WARNING, "recipe",
+                       "Recipe format '%s' (%d) can't be detected\n",
+                       format_p->name_p, recipe_format );
+            continue;
+        }
+
+        //  The format is also its bit number
+        marker_p[ recipe_format ] = format_p;
+        bit = RECIPE_MARKER_BIT( recipe_format );
+
+        //  Where its start markers can begin
+        for ( first_p = (unsigned char *)format_p->start_first_p;
+              first_p[ 0 ] != '\0';
+              first_p += 1 )
+        {
+            start_first[ first_p[ 0 ] ] |= bit;
+        }
+
+        //  Where its end markers can begin
+        for ( first_p = (unsigned char *)format_p->end_first_p;
+              (    ( format_p->is_end_p != NULL )
+                && ( first_p[ 0 ]       != '\0' ) );
+              first_p += 1 )
+        {
+            end_first[ first_p[ 0 ] ] |= bit;
+        }
+
+        //  What its start markers contain
+        for ( key_ndx = 0;
+              (    ( key_ndx < DECODE_FORMAT_KEYS )
+                && ( format_p->key_list[ key_ndx ] != NULL ) );
+              key_ndx += 1 )
+        {
+            RECIPE__key_add( format_p->key_list[ key_ndx ] );
+        }
+    }
+
+    //  Files with an encoded body can't be ruled out
+    RECIPE__key_add( RECIPE_KEY_ENCODED );
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+}
+
+/****************************************************************************/
+/**
+ *  Find the format of a recipe start marker.
+ *
+ *  @param  data_p              Pointer to a line of text
+ *
+ *  @return recipe_format       The format when the line starts a recipe
+ *                              else RECIPE_FORMAT_NONE.
+ *
+ *  @note
+ *      Only the formats that have a start marker beginning with the first
+ *      non-blank character are tested.  Most lines begin with something
+ *      else and cost a single table lookup no matter how many formats
+ *      there are.
+ *
+ ****************************************************************************/
+
+enum    recipe_format_e
+RECIPE__start(
+    char                    *   data_p
+    )
+{
+    /**
+     *  @param  recipe_format   See recipe_format_e for details             */
+    enum    recipe_format_e     recipe_format;
+    /**
+     *  @param  start_p         First non-blank character                   */
+    unsigned char           *   start_p;
+    /**
+     *  @param  candidates      Formats that might match                    */
+    uint32_t                    candidates;
+    /**
+     *  @param  format          A format that might match                   */
+    int                         format;
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+    //  Set the default return code
+    recipe_format = RECIPE_FORMAT_NONE;
+
+    //  Build the tables the first time through
+    pthread_once( &marker_once, RECIPE__compile );
+
+    //  Locate the first character in the buffer
+    start_p = (unsigned char *)text_skip_past_whitespace( data_p );
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    //  Which formats can start with this character ?
+    candidates = ( start_p != NULL ) ? start_first[ start_p[ 0 ] ] : 0;
+
+    //  Test them in format order
+    while ( candidates != 0 )
+    {
+        format      = __builtin_ctz( candidates );
+        candidates &= candidates - 1;
+
+        //  Is this the start of a recipe ?
+        if ( marker_p[ format ]->is_start_p( data_p ) == true )
+        {
+            //  YES:    Set the format to use
+            recipe_format = marker_p[ format ]->recipe_format;
+            break;
+        }
+    }
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+    return( recipe_format );
+}
+
+/****************************************************************************/
+/**
+ *  Test for a recipe end marker.
+ *
+ *  @param  recipe_format       The format of the recipe being split out
+ *  @param  data_p              Pointer to a line of text
+ *
+ *  @return recipe_rc           TRUE when the line ends the recipe
+ *                              else FALSE is returned.
+ *
+ *  @note
+ *      Only the end markers of the recipe's own format are tested.  When
+ *      the format is not known the end markers of every format are tested.
+ *
+ ****************************************************************************/
+
+int
+RECIPE__end(
+    enum    recipe_format_e     recipe_format,
+    char                    *   data_p
+    )
+{
+    /**
+     *  @param  recipe_rc       Return code from this function              */
+    int                         recipe_rc;
+    /**
+     *  @param  start_p         First non-blank character                   */
+    unsigned char           *   start_p;
+    /**
+     *  @param  candidates      Formats that might match                    */
+    uint32_t                    candidates;
+    /**
+     *  @param  format          A format that might match                   */
+    int                         format;
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+    //  The assumption is that all tests will fail
+    recipe_rc = false;
+
+    //  Build the tables the first time through
+    pthread_once( &marker_once, RECIPE__compile );
+
+    //  Locate the first character in the buffer
+    start_p = (unsigned char *)text_skip_past_whitespace( data_p );
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    //  Which formats can end with this character ?
+    candidates = ( start_p != NULL ) ? end_first[ start_p[ 0 ] ] : 0;
+
+    //  Is the recipe format one that has markers ?
+    if (    ( recipe_format >= 0 )
+         && ( recipe_format <  RECIPE_MARKER_MAX )
+         && ( marker_p[ recipe_format ] != NULL ) )
+    {
+        //  YES:    Only its own end markers count
+        candidates &= RECIPE_MARKER_BIT( recipe_format );
+    }
+
+    //  Test them in format order
+    while ( candidates != 0 )
+    {
+        format      = __builtin_ctz( candidates );
+        candidates &= candidates - 1;
+
+        //  Is this the end of a recipe ?
+        if ( marker_p[ format ]->is_end_p( data_p ) == true )
+        {
+            //  YES:    Change the return code
+            recipe_rc = true;
+            break;
+        }
+    }
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+    return( recipe_rc );
+}
+/****************************************************************************/
+
+/**
+ *  Test a whole file for the text of any recipe start marker.
+ *
+ *  @param  data_p              Pointer to the data
+ *  @param  data_l              Length of the data
+ *
+ *  @return recipe_rc           TRUE when a key text is found
+ *                              else FALSE is returned.
+ *
+ *  @note
+ *      Upper and lower case are the same.  The lower case of a byte is
+ *      taken as ( byte | 0x20 ), which also turns a few control characters
+ *      into punctuation; every hit is checked again with tolower( ).  With
+ *      SSE2 sixteen bytes are tested at a time.
+ *
+ ****************************************************************************/
+
+int
+RECIPE__scan(
+    char                    *   data_p,
+    size_t                      data_l
+    )
+{
+    /**
+     *  @param  recipe_rc       Return code from this function              */
+    int                         recipe_rc;
+    /**
+     *  @param  ndx             Offset of the anchor being tested           */
+    size_t                      ndx;
+    /**
+     *  @param  key_ndx         Index into the key table                    */
+    int                         key_ndx;
+    /**
+     *  @param  key_t_p         A key                                       */
+    struct  recipe_key_t    *   key_t_p;
+    /**
+     *  @param  start           Offset the key would start at               */
+    size_t                      start;
+    /**
+     *  @param  match_l         Number of characters that match             */
+    size_t                      match_l;
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+    //  The assumption is that nothing is found
+    recipe_rc = false;
+
+    //  Build the tables the first time through
+    pthread_once( &marker_once, RECIPE__compile );
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    for ( ndx = 0; ( ndx + 1 < data_l ) && ( recipe_rc == false ); ndx += 1 )
+    {
+#if defined( __SSE2__ )
+        {
+            /**
+             *  @param  lower   The case bit                                */
+            __m128i             lower;
+            /**
+             *  @param  first   Sixteen bytes in lower case                 */
+            __m128i             first;
+            /**
+             *  @param  second  The next sixteen bytes in lower case        */
+            __m128i             second;
+            /**
+             *  @param  hit     An anchor starts here                       */
+            int                 hit;
+
+            lower = _mm_set1_epi8( 0x20 );
+
+            //  Skip to the next anchor
+            for ( ; ndx + 17 <= data_l; ndx += 16 )
+            {
+                first  = _mm_or_si128( _mm_loadu_si128( (__m128i *)( data_p + ndx     ) ), lower );
+                second = _mm_or_si128( _mm_loadu_si128( (__m128i *)( data_p + ndx + 1 ) ), lower );
+
+                for ( hit = 0, key_ndx = 0; key_ndx < key_count; key_ndx += 1 )
+                {
+                    key_t_p = &key_table[ key_ndx ];
+                    hit    |= _mm_movemask_epi8(
+                                _mm_and_si128(
+                                    _mm_cmpeq_epi8( first,
+                                        _mm_set1_epi8( key_t_p->key_p[ key_t_p->anchor     ] ) ),
+                                    _mm_cmpeq_epi8( second,
+                                        _mm_set1_epi8( key_t_p->key_p[ key_t_p->anchor + 1 ] ) ) ) );
+                }
+
+                //  Anything in these sixteen bytes ?
+                if ( hit != 0 )
+                {
+                    //  YES:    Go and look at it
+                    ndx += __builtin_ctz( hit );
+                    break;
+                }
+            }
+
+            //  Was the end reached ?
+            if ( ndx + 1 >= data_l )
+            {
+                //  YES:    Nothing more to look at
+                break;
+            }
+        }
+#endif
+
+        //  Does a key start here ?
+        for ( key_ndx = 0; key_ndx < key_count; key_ndx += 1 )
+        {
+            key_t_p = &key_table[ key_ndx ];
+
+            //  Is this its anchor and is there room for the whole key ?
+            if (    ( tolower( (unsigned char)data_p[ ndx     ] )
+                        != key_t_p->key_p[ key_t_p->anchor     ] )
+                 || ( tolower( (unsigned char)data_p[ ndx + 1 ] )
+                        != key_t_p->key_p[ key_t_p->anchor + 1 ] )
+                 || ( ndx                  <  key_t_p->anchor )
+                 || ( ndx - key_t_p->anchor + key_t_p->key_l > data_l ) )
+            {
+                //  NO:     Not this one
+                continue;
+            }
+
+            //  Compare it
+            start = ndx - key_t_p->anchor;
+            for ( match_l = 0;
+                  (    ( match_l < key_t_p->key_l )
+                    && (    tolower( (unsigned char)data_p[ start + match_l ] )
+                         == key_t_p->key_p[ match_l ] ) );
+                  match_l += 1 )
+            {
+            }
+
+            //  Is it a match ?
+            if ( match_l == key_t_p->key_l )
+            {
+                //  YES:    This file may hold a recipe
+                recipe_rc = true;
+                break;
+            }
+        }
+    }
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+    return( recipe_rc );
+}
+/****************************************************************************/
@@ -33,6 +33,7 @@
  ****************************************************************************/
 
                                 //*******************************************
+#include <stdint.h>             //  Alternative storage types
                                 //*******************************************
 
 /****************************************************************************
@@ -47,6 +48,11 @@
  ****************************************************************************/
 
 //----------------------------------------------------------------------------
+#define RECIPE_MARKER_MAX       ( 32 )
+//----------------------------------------------------------------------------
+#define RECIPE_MARKER_BIT( f )  ( (uint32_t)1 << ( f ) )
+//----------------------------------------------------------------------------
+#define RECIPE_KEY_MAX          (   16 )
 //----------------------------------------------------------------------------
 
 /****************************************************************************
@@ -61,6 +67,20 @@
  ****************************************************************************/
 
 //----------------------------------------------------------------------------
+/**
+ *  @param  recipe_key_t        Text that is looked for in a whole file     */
+struct  recipe_key_t
+{
+    /**
+     *  @param  key_p           Lower case text                             */
+    char                    *   key_p;
+    /**
+     *  @param  key_l           Length of the text                          */
+    size_t                      key_l;
+    /**
+     *  @param  anchor          Offset of the two least common characters   */
+    size_t                      anchor;
+};
 //----------------------------------------------------------------------------
 
 /****************************************************************************
@@ -75,6 +95,22 @@
  ****************************************************************************/
 
 //----------------------------------------------------------------------------
+enum    recipe_format_e
+RECIPE__start(
+    char                    *   data_p
+    );
+//----------------------------------------------------------------------------
+int
+RECIPE__end(
+    enum    recipe_format_e     recipe_format,
+    char                    *   data_p
+    );
+//----------------------------------------------------------------------------
+int
+RECIPE__scan(
+    char                    *   data_p,
+    size_t                      data_l
+    );
 //----------------------------------------------------------------------------
 
 /****************************************************************************/
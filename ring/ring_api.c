@@ -0,0 +1,782 @@
+/*******************************  COPYRIGHT  ********************************/
+/**
+ *  Author? "Gregory N. Leonhardt"
+ *  License? "CC BY-NC 2.0"
+ *           "https://creativecommons.org/licenses/by-nc/2.0/"
+ *
+ ****************************************************************************/
+
+/******************************** JAVADOC ***********************************/
+/**
+ *  This file contains public function that makeup the external
+ *  library components of the 'ring' library.
+ *
+ *  @note
+ *      Every slot carries a sequence number.  A producer owns slot 'n' when
+ *      its sequence is 'n', a consumer owns it when its sequence is 'n + 1'.
+ *      Producers and consumers only ever compete on their own index so a
+ *      put and a get never contend with each other.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ *  Compiler directives
+ ****************************************************************************/
+
+#define ALLOC_RING              ( "ALLOCATE STORAGE FOR RING" )
+
+/****************************************************************************
+ * System Function API
+ ****************************************************************************/
+
+                                //*******************************************
+#include <stdint.h>             //  Alternative storage types
+#include <stdbool.h>            //  TRUE, FALSE, etc.
+#include <stdio.h>              //  Standard I/O definitions
+                                //*******************************************
+#include <pthread.h>            //  POSIX threads
+                                //*******************************************
+
+/****************************************************************************
+ * Application APIs
+ ****************************************************************************/
+
+                                //*******************************************
+#include "global.h"             //  Global stuff for this application
+#include "libtools_api.h"       //  My Tools Library
+                                //*******************************************
+#include "ring_api.h"           //  API for all ring_*              PUBLIC
+#include "ring_lib.h"           //  API for all RING__*             PRIVATE
+                                //*******************************************
+
+/****************************************************************************
+ * Private API Enumerations
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Private API Definitions
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Private API Structures
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Private API Storage Allocation
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Public API Functions
+ ****************************************************************************/
+
+/****************************************************************************/
+/**
+ *  Create a new ring buffer.
+ *
+ *  @param  max_depth           MAXIMUM number of payloads before blocking.
+ *  @param  wait                What to do when the ring is full or empty
+ *
+ *  @return ring_p              Pointer to a Ring Buffer Control Block
+ *
+ *  @note
+ *      The depth is rounded up to a power of two (and at least two).  A
+ *      depth of zero (MAX_QUEUE_DEPTH) uses RING_DEPTH_DEFAULT.
+ *
+ ****************************************************************************/
+
+struct  ring_t  *
+ring_new(
+    int                         max_depth,
+    enum    ring_wait_e         wait
+    )
+{
+    /**
+     *  @param  ring_p          Pointer to a Ring Buffer Control Block      */
+    struct  ring_t          *   ring_p;
+    /**
+     *  @param  depth           Number of slots                             */
+    size_t                      depth;
+    /**
+     *  @param  ndx             Slot index                                  */
+    size_t                      ndx;
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+    //  Is there a depth limit ?
+    if ( max_depth <= 0 )
+    {
+        //  NO:     Use the default
+        max_depth = RING_DEPTH_DEFAULT;
+    }
+
+    //  Round up to a power of two
+    for ( depth = 2;
+          depth < (size_t)max_depth;
+          depth <<= 1 )
+    {
+        //  Nothing to do here
+    }
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    //  Allocate storage for a new Ring Buffer Control Block
+    ring_p = mem_malloc( sizeof( struct ring_t ) );
+    ring_p->cell_p = mem_malloc( sizeof( struct ring_cell_t ) * depth );
+
+    //  Initialize the ring
+    ring_p->mask        = depth - 1;
+    ring_p->wait        = wait;
+    ring_p->put_ndx     = 0;
+    ring_p->get_ndx     = 0;
+    ring_p->put_waiters = 0;
+    ring_p->get_waiters = 0;
+
+    //  Every slot starts out owned by the producer with the same sequence
+    for ( ndx = 0;
+          ndx < depth;
+          ndx += 1 )
+    {
+        ring_p->cell_p[ ndx ].sequence  = ndx;
+        ring_p->cell_p[ ndx ].payload_p = NULL;
+    }
+
+    //  Create the sleep / wake-up signals
+    pthread_mutex_init( &ring_p->wait_mutex, NULL );
+    pthread_cond_init( &ring_p->not_full, NULL );
+    pthread_cond_init( &ring_p->not_empty, NULL );
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+    return( ring_p );
+}
+
+/****************************************************************************/
+/**
+ *  Release a ring buffer.
+ *
+ *  @param  ring_p              Pointer to a Ring Buffer Control Block
+ *
+ *  @return void                No information is returned
+ *
+ *  @note
+ *      Any payloads still in the ring are NOT released.
+ *
+ ****************************************************************************/
+
+void
+ring_kill(
+    struct  ring_t          *   ring_p
+    )
+{
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    //  Release the sleep / wake-up signals
+    pthread_cond_destroy( &ring_p->not_empty );
+    pthread_cond_destroy( &ring_p->not_full );
+    pthread_mutex_destroy( &ring_p->wait_mutex );
+
+    //  Release the storage
+    mem_free( ring_p->cell_p );
+    mem_free( ring_p );
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+}
+
+/****************************************************************************/
+/**
+ *  Put a payload on a ring buffer without waiting.
+ *
+ *  @param  ring_p              Pointer to a Ring Buffer Control Block
+ *  @param  payload_p           Pointer to the payload (never NULL)
+ *
+ *  @return ring_rc             TRUE when the payload was added
+ *                              FALSE when the ring is full
+ *
+ *  @note
+ *
+ ****************************************************************************/
+
+int
+ring_try_put(
+    struct  ring_t          *   ring_p,
+    void                    *   payload_p
+    )
+{
+    /**
+     *  @param  ring_rc         Return code from this function              */
+    int                         ring_rc;
+    /**
+     *  @param  cell_p          Pointer to the slot                         */
+    struct  ring_cell_t     *   cell_p;
+    /**
+     *  @param  put_ndx         Sequence number we are trying to claim      */
+    size_t                      put_ndx;
+    /**
+     *  @param  sequence        Sequence number found in the slot           */
+    size_t                      sequence;
+    /**
+     *  @param  distance        How far the slot is from being ours         */
+    intptr_t                    distance;
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+    //  Assume the ring is full
+    ring_rc = false;
+
+    //  Where the next payload goes
+    put_ndx = __atomic_load_n( &ring_p->put_ndx, __ATOMIC_RELAXED );
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    while ( 1 )
+    {
+        //  Look at the slot
+        cell_p   = &ring_p->cell_p[ put_ndx & ring_p->mask ];
+        sequence = __atomic_load_n( &cell_p->sequence, __ATOMIC_ACQUIRE );
+        distance = (intptr_t)sequence - (intptr_t)put_ndx;
+
+        //  Is the slot free for this sequence number ?
+        if ( distance == 0 )
+        {
+            //  YES:    Try to claim it
+            if ( __atomic_compare_exchange_n( &ring_p->put_ndx,
+                                              &put_ndx, put_ndx + 1,
+                                              true,
+                                              __ATOMIC_RELAXED,
+                                              __ATOMIC_RELAXED ) == true )
+            {
+                //  Got it.
+                ring_rc = true;
+                break;
+            }
+            //  Somebody else got it, put_ndx was reloaded.
+        }
+        else
+        if ( distance < 0 )
+        {
+            //  The consumer hasn't released this slot.  The ring is full.
+            break;
+        }
+        else
+        {
+            //  Another producer got here first.  Try again.
+            put_ndx = __atomic_load_n( &ring_p->put_ndx, __ATOMIC_RELAXED );
+        }
+    }
+
+    //  Did we claim a slot ?
+    if ( ring_rc == true )
+    {
+        //  YES:    Fill it and hand it to the consumers
+        cell_p->payload_p = payload_p;
+        __atomic_store_n( &cell_p->sequence, put_ndx + 1, __ATOMIC_RELEASE );
+    }
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+    return( ring_rc );
+}
+
+/****************************************************************************/
+/**
+ *  Get a payload from a ring buffer without waiting.
+ *
+ *  @param  ring_p              Pointer to a Ring Buffer Control Block
+ *
+ *  @return payload_p           Pointer to the payload or NULL when the
+ *                              ring is empty.
+ *
+ *  @note
+ *
+ ****************************************************************************/
+
+void    *
+ring_try_get(
+    struct  ring_t          *   ring_p
+    )
+{
+    /**
+     *  @param  payload_p       Pointer to the payload                      */
+    void                    *   payload_p;
+    /**
+     *  @param  cell_p          Pointer to the slot                         */
+    struct  ring_cell_t     *   cell_p;
+    /**
+     *  @param  get_ndx         Sequence number we are trying to claim      */
+    size_t                      get_ndx;
+    /**
+     *  @param  sequence        Sequence number found in the slot           */
+    size_t                      sequence;
+    /**
+     *  @param  distance        How far the slot is from being ours         */
+    intptr_t                    distance;
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+    //  Assume the ring is empty
+    payload_p = NULL;
+
+    //  Where the next payload comes from
+    get_ndx = __atomic_load_n( &ring_p->get_ndx, __ATOMIC_RELAXED );
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    while ( 1 )
+    {
+        //  Look at the slot
+        cell_p   = &ring_p->cell_p[ get_ndx & ring_p->mask ];
+        sequence = __atomic_load_n( &cell_p->sequence, __ATOMIC_ACQUIRE );
+        distance = (intptr_t)sequence - (intptr_t)( get_ndx + 1 );
+
+        //  Does the slot hold a payload for this sequence number ?
+        if ( distance == 0 )
+        {
+            //  YES:    Try to claim it
+            if ( __atomic_compare_exchange_n( &ring_p->get_ndx,
+                                              &get_ndx, get_ndx + 1,
+                                              true,
+                                              __ATOMIC_RELAXED,
+                                              __ATOMIC_RELAXED ) == true )
+            {
+                //  Got it.
+                payload_p = cell_p->payload_p;
+                break;
+            }
+            //  Somebody else got it, get_ndx was reloaded.
+        }
+        else
+        if ( distance < 0 )
+        {
+            //  The producer hasn't filled this slot.  The ring is empty.
+            break;
+        }
+        else
+        {
+            //  Another consumer got here first.  Try again.
+            get_ndx = __atomic_load_n( &ring_p->get_ndx, __ATOMIC_RELAXED );
+        }
+    }
+
+    //  Did we claim a payload ?
+    if ( payload_p != NULL )
+    {
+        //  YES:    Give the slot back to the producers for the next lap
+        __atomic_store_n( &cell_p->sequence, get_ndx + ring_p->mask + 1,
+                          __ATOMIC_RELEASE );
+    }
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+    return( payload_p );
+}
+
+/****************************************************************************/
+/**
+ *  Put a payload on a ring buffer, waiting while the ring is full.
+ *
+ *  @param  ring_p              Pointer to a Ring Buffer Control Block
+ *  @param  payload_p           Pointer to the payload (never NULL)
+ *
+ *  @return void                No information is returned
+ *
+ *  @note
+ *
+ ****************************************************************************/
+
+void
+ring_put(
+    struct  ring_t          *   ring_p,
+    void                    *   payload_p
+    )
+{
+    /**
+     *  @param  ring_rc         Return code from called functions           */
+    int                         ring_rc;
+    /**
+     *  @param  spin_count      Number of failed attempts                   */
+    int                         spin_count;
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+    //  Try it once
+    ring_rc = ring_try_put( ring_p, payload_p );
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    //  Spin while the ring is full
+    for ( spin_count = 0;
+             ( ring_rc != true )
+          && (    ( ring_p->wait     == RING_WAIT_SPIN  )
+               || ( spin_count        < RING_SPIN_LIMIT ) );
+          spin_count += 1 )
+    {
+        RING__relax( spin_count );
+        ring_rc = ring_try_put( ring_p, payload_p );
+    }
+
+    //  Is the ring still full ?
+    if ( ring_rc != true )
+    {
+        //  YES:    Go to sleep until a consumer releases a slot
+        pthread_mutex_lock( &ring_p->wait_mutex );
+        __atomic_add_fetch( &ring_p->put_waiters, 1, __ATOMIC_SEQ_CST );
+
+        while ( ring_try_put( ring_p, payload_p ) != true )
+        {
+            pthread_cond_wait( &ring_p->not_full, &ring_p->wait_mutex );
+        }
+
+        __atomic_sub_fetch( &ring_p->put_waiters, 1, __ATOMIC_SEQ_CST );
+        pthread_mutex_unlock( &ring_p->wait_mutex );
+    }
+
+    //  Wake up a consumer that is waiting for this payload
+    RING__wake( ring_p, &ring_p->get_waiters, &ring_p->not_empty, false );
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+}
+
+/****************************************************************************/
+/**
+ *  Get a payload from a ring buffer, waiting while the ring is empty.
+ *
+ *  @param  ring_p              Pointer to a Ring Buffer Control Block
+ *
+ *  @return payload_p           Pointer to the payload
+ *
+ *  @note
+ *
+ ****************************************************************************/
+
+void    *
+ring_get(
+    struct  ring_t          *   ring_p
+    )
+{
+    /**
+     *  @param  payload_p       Pointer to the payload                      */
+    void                    *   payload_p;
+    /**
+     *  @param  spin_count      Number of failed attempts                   */
+    int                         spin_count;
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+    //  Try it once
+    payload_p = ring_try_get( ring_p );
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    //  Spin while the ring is empty
+    for ( spin_count = 0;
+             ( payload_p == NULL )
+          && (    ( ring_p->wait     == RING_WAIT_SPIN  )
+               || ( spin_count        < RING_SPIN_LIMIT ) );
+          spin_count += 1 )
+    {
+        RING__relax( spin_count );
+        payload_p = ring_try_get( ring_p );
+    }
+
+    //  Is the ring still empty ?
+    if ( payload_p == NULL )
+    {
+        //  YES:    Go to sleep until a producer adds a payload
+        pthread_mutex_lock( &ring_p->wait_mutex );
+        __atomic_add_fetch( &ring_p->get_waiters, 1, __ATOMIC_SEQ_CST );
+
+        while ( ( payload_p = ring_try_get( ring_p ) ) == NULL )
+        {
+            pthread_cond_wait( &ring_p->not_empty, &ring_p->wait_mutex );
+        }
+
+        __atomic_sub_fetch( &ring_p->get_waiters, 1, __ATOMIC_SEQ_CST );
+        pthread_mutex_unlock( &ring_p->wait_mutex );
+    }
+
+    //  Wake up a producer that is waiting for this slot
+    RING__wake( ring_p, &ring_p->put_waiters, &ring_p->not_full, false );
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+    return( payload_p );
+}
+
+/****************************************************************************/
+/**
+ *  Put several payloads on a ring buffer.
+ *
+ *  @param  ring_p              Pointer to a Ring Buffer Control Block
+ *  @param  payload_pp          List of payload pointers (never NULL)
+ *  @param  payload_count       Number of payloads in the list
+ *
+ *  @return void                No information is returned
+ *
+ *  @note
+ *      Sleeping consumers are only woken once for the whole batch unless
+ *      the ring fills up part way through.
+ *
+ ****************************************************************************/
+
+void
+ring_put_batch(
+    struct  ring_t          *   ring_p,
+    void                    **  payload_pp,
+    int                         payload_count
+    )
+{
+    /**
+     *  @param  ndx             Index into the payload list                 */
+    int                         ndx;
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    for ( ndx = 0;
+          ndx < payload_count;
+          ndx += 1 )
+    {
+        //  Is the ring full ?
+        if ( ring_try_put( ring_p, payload_pp[ ndx ] ) != true )
+        {
+            //  YES:    Let the consumers start on what is already there
+            RING__wake( ring_p, &ring_p->get_waiters, &ring_p->not_empty, true );
+
+            //  Wait for room
+            ring_put( ring_p, payload_pp[ ndx ] );
+        }
+    }
+
+    //  Wake up the consumers
+    RING__wake( ring_p, &ring_p->get_waiters, &ring_p->not_empty, true );
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+}
+
+/****************************************************************************/
+/**
+ *  Get one or more payloads from a ring buffer.
+ *
+ *  @param  ring_p              Pointer to a Ring Buffer Control Block
+ *  @param  payload_pp          List to receive the payload pointers
+ *  @param  max_count           Size of the list
+ *
+ *  @return payload_count       Number of payloads in the list
+ *
+ *  @note
+ *      Waits for the first payload, then takes whatever else is already in
+ *      the ring (up to max_count) without waiting.
+ *
+ ****************************************************************************/
+
+int
+ring_get_batch(
+    struct  ring_t          *   ring_p,
+    void                    **  payload_pp,
+    int                         max_count
+    )
+{
+    /**
+     *  @param  payload_count   Number of payloads in the list              */
+    int                         payload_count;
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+    //  Wait for the first one
+    payload_pp[ 0 ] = ring_get( ring_p );
+    payload_count   = 1;
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    //  Take whatever else is ready
+    while (    ( payload_count < max_count )
+            && ( ( payload_pp[ payload_count ] = ring_try_get( ring_p ) ) != NULL ) )
+    {
+        payload_count += 1;
+    }
+
+    //  Did we free up more than one slot ?
+    if ( payload_count > 1 )
+    {
+        //  YES:    Wake up the producers
+        RING__wake( ring_p, &ring_p->put_waiters, &ring_p->not_full, true );
+    }
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+    return( payload_count );
+}
+
+/****************************************************************************/
+/**
+ *  Get the number of payloads in a ring buffer.
+ *
+ *  @param  ring_p              Pointer to a Ring Buffer Control Block
+ *
+ *  @return count               Number of payloads in the ring
+ *
+ *  @note
+ *      The count is a snapshot and may be stale by the time it is used.
+ *
+ ****************************************************************************/
+
+int
+ring_get_count(
+    struct  ring_t          *   ring_p
+    )
+{
+    /**
+     *  @param  put_ndx         Snapshot of the producer index              */
+    size_t                      put_ndx;
+    /**
+     *  @param  get_ndx         Snapshot of the consumer index              */
+    size_t                      get_ndx;
+    /**
+     *  @param  count           Number of payloads in the ring              */
+    int                         count;
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+    //  Take the snapshot
+    get_ndx = __atomic_load_n( &ring_p->get_ndx, __ATOMIC_RELAXED );
+    put_ndx = __atomic_load_n( &ring_p->put_ndx, __ATOMIC_RELAXED );
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    //  A consumer may have moved past the snapshot of the producer
+    if ( put_ndx > get_ndx )
+    {
+        count = (int)( put_ndx - get_ndx );
+    }
+    else
+    {
+        count = 0;
+    }
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+    return( count );
+}
+
+/****************************************************************************/
+/**
+ *  Run the ring buffer benchmarks.
+ *
+ *  @param  void                No parameters are passed in.
+ *
+ *  @return void                No information is returned
+ *
+ *  @note
+ *      The results are written to the log file.
+ *
+ ****************************************************************************/
+
+void
+ring_benchmark(
+    void
+    )
+{
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    //  Ring vs. libtools queue
+    RING__BENCH_mpmc( );
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+}
+/****************************************************************************/
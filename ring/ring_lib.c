@@ -0,0 +1,191 @@
+/*******************************  COPYRIGHT  ********************************/
+/**
+ *  Author? "Gregory N. Leonhardt"
+ *  License? "CC BY-NC 2.0"
+ *           "https://creativecommons.org/licenses/by-nc/2.0/"
+ *
+ ****************************************************************************/
+
+/******************************** JAVADOC ***********************************/
+/**
+ *  This file contains private functions that makeup the internal
+ *  library components of the 'ring' library.
+ *
+ *  @note
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ *  Compiler directives
+ ****************************************************************************/
+
+
+/****************************************************************************
+ * System Function API
+ ****************************************************************************/
+
+                                //*******************************************
+#include <stdint.h>             //  Alternative storage types
+#include <stdbool.h>            //  TRUE, FALSE, etc.
+#include <stdio.h>              //  Standard I/O definitions
+                                //*******************************************
+#include <sched.h>              //  sched_yield( )
+#include <pthread.h>            //  POSIX threads
+                                //*******************************************
+
+/****************************************************************************
+ * Application APIs
+ ****************************************************************************/
+
+                                //*******************************************
+#include "global.h"             //  Global stuff for this application
+#include "libtools_api.h"       //  My Tools Library
+                                //*******************************************
+#include "ring_api.h"           //  API for all ring_*              PUBLIC
+#include "ring_lib.h"           //  API for all RING__*             PRIVATE
+                                //*******************************************
+
+/****************************************************************************
+ * Enumerations local to this file
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Definitions local to this file
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Structures local to this file
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Storage Allocation local to this file
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * LIB Functions
+ ****************************************************************************/
+
+/****************************************************************************/
+/**
+ *  Back off after a failed put or get.
+ *
+ *  @param  spin_count          Number of failed attempts so far
+ *
+ *  @return void                No information is returned
+ *
+ *  @note
+ *      The first few attempts only tell the processor that we are in a spin
+ *      loop.  After that the processor is given to another thread.
+ *
+ ****************************************************************************/
+
+void
+RING__relax(
+    int                         spin_count
+    )
+{
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    //  Have we been spinning for a while ?
+    if ( spin_count < RING_YIELD_LIMIT )
+    {
+        //  NO:     Just a pause
+#if defined( __x86_64__ ) || defined( __i386__ )
+        __builtin_ia32_pause( );
+#else
+        __asm__ __volatile__( "" ::: "memory" );
+#endif
+    }
+    else
+    {
+        //  YES:    Let someone else run
+        sched_yield( );
+    }
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+}
+
+/****************************************************************************/
+/**
+ *  Wake sleeping producers or consumers.
+ *
+ *  @param  ring_p              Pointer to a Ring Buffer Control Block
+ *  @param  waiters_p           Pointer to the count of sleepers
+ *  @param  cond_p              Pointer to the condition they sleep on
+ *  @param  wake_all            TRUE to wake all of them, FALSE for one
+ *
+ *  @return void                No information is returned
+ *
+ *  @note
+ *      The fence pairs with the atomic increment a sleeper does before it
+ *      retries.  Either the sleeper sees our change to the ring or we see
+ *      the sleeper, so a wake-up can not be lost.  When nobody is asleep
+ *      the mutex is never touched.
+ *
+ ****************************************************************************/
+
+void
+RING__wake(
+    struct  ring_t          *   ring_p,
+    int                     *   waiters_p,
+    pthread_cond_t          *   cond_p,
+    int                         wake_all
+    )
+{
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+    //  Order the ring update before the sleeper check
+    __atomic_thread_fence( __ATOMIC_SEQ_CST );
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    //  Is anyone asleep ?
+    if ( __atomic_load_n( waiters_p, __ATOMIC_SEQ_CST ) != 0 )
+    {
+        //  YES:    Wake them up
+        pthread_mutex_lock( &ring_p->wait_mutex );
+
+        if ( wake_all == true )
+            pthread_cond_broadcast( cond_p );
+        else
+            pthread_cond_signal( cond_p );
+
+        pthread_mutex_unlock( &ring_p->wait_mutex );
+    }
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+}
+/****************************************************************************/
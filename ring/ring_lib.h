@@ -0,0 +1,105 @@
+/*******************************  COPYRIGHT  ********************************/
+/**
+ *  Author? "Gregory N. Leonhardt"
+ *  License? "CC BY-NC 2.0"
+ *           "https://creativecommons.org/licenses/by-nc/2.0/"
+ *
+ ****************************************************************************/
+
+#ifndef RING_LIB_H
+#define RING_LIB_H
+
+/******************************** JAVADOC ***********************************/
+/**
+ *  This file contains private definitions (etc.) that apply to internal
+ *  library components of the 'ring' library.
+ *
+ *  @note
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ *  Compiler directives
+ ****************************************************************************/
+
+#ifdef ALLOC_RING
+   #define RING_EXT
+#else
+   #define RING_EXT         extern
+#endif
+
+/****************************************************************************
+ * System APIs
+ ****************************************************************************/
+
+                                //*******************************************
+                                //*******************************************
+
+/****************************************************************************
+ * Application APIs
+ ****************************************************************************/
+
+                                //*******************************************
+                                //*******************************************
+
+/****************************************************************************
+ * Library Private Definitions
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+//  Number of failed attempts before a RING_WAIT_BLOCK caller goes to sleep
+#define RING_SPIN_LIMIT         (  256 )
+//  Number of failed attempts before a spinning caller starts to yield
+#define RING_YIELD_LIMIT        (   64 )
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Library Private Enumerations
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Library Private Structures
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Library Private Storage Allocation
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+RING_EXT
+int                             ring_lib;
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Library Private Prototypes
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+void
+RING__relax(
+    int                         spin_count
+    );
+//----------------------------------------------------------------------------
+void
+RING__wake(
+    struct  ring_t          *   ring_p,
+    int                     *   waiters_p,
+    pthread_cond_t          *   cond_p,
+    int                         wake_all
+    );
+//----------------------------------------------------------------------------
+void
+RING__BENCH_mpmc(
+    void
+    );
+//----------------------------------------------------------------------------
+
+/****************************************************************************/
+
+#endif                      //    RING_LIB_H
@@ -0,0 +1,395 @@
+/*******************************  COPYRIGHT  ********************************/
+/**
+ *  Author? "Gregory N. Leonhardt"
+ *  License? "CC BY-NC 2.0"
+ *           "https://creativecommons.org/licenses/by-nc/2.0/"
+ *
+ ****************************************************************************/
+
+/******************************** JAVADOC ***********************************/
+/**
+ *  This file contains the benchmarks for the 'ring' library.
+ *
+ *  @note
+ *      The same number of producers and consumers move BENCH_PAYLOADS
+ *      payloads through a ring buffer and through a libtools queue of the
+ *      same depth.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ *  Compiler directives
+ ****************************************************************************/
+
+
+/****************************************************************************
+ * System Function API
+ ****************************************************************************/
+
+                                //*******************************************
+#include <stdint.h>             //  Alternative storage types
+#include <stdbool.h>            //  TRUE, FALSE, etc.
+#include <stdio.h>              //  Standard I/O definitions
+                                //*******************************************
+#include <time.h>               //  clock_gettime( )
+#include <pthread.h>            //  POSIX threads
+                                //*******************************************
+
+/****************************************************************************
+ * Application APIs
+ ****************************************************************************/
+
+                                //*******************************************
+#include "global.h"             //  Global stuff for this application
+#include "libtools_api.h"       //  My Tools Library
+                                //*******************************************
+#include "ring_api.h"           //  API for all ring_*              PUBLIC
+#include "../ring_lib.h"        //  API for all RING__*             PRIVATE
+                                //*******************************************
+
+/****************************************************************************
+ * Enumerations local to this file
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Definitions local to this file
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+#define BENCH_PAYLOADS          ( 1000000 )
+#define BENCH_DEPTH             (    1024 )
+#define BENCH_THREADS_MAX       (      16 )
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Structures local to this file
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+/**
+ *  @param  bench_t             What one benchmark thread works on          */
+struct  bench_t
+{
+    /**
+     *  @param  ring_p          Ring under test (NULL for the queue)        */
+    struct  ring_t          *   ring_p;
+    /**
+     *  @param  queue_id        libtools queue under test                   */
+    int                         queue_id;
+    /**
+     *  @param  payload_count   Number of payloads to put                   */
+    int                         payload_count;
+};
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Storage Allocation local to this file
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+/**
+ * @param bench_stop            Payload that tells a consumer to stop       */
+static
+int                             bench_stop;
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * LIB Functions
+ ****************************************************************************/
+
+/****************************************************************************/
+/**
+ *  Benchmark producer thread.
+ *
+ *  @param  void_p              Pointer to a bench_t
+ *
+ *  @return NULL                Always
+ *
+ *  @note
+ *
+ ****************************************************************************/
+
+static
+void    *
+BENCH__producer(
+    void                    *   void_p
+    )
+{
+    /**
+     *  @param  bench_p         What this thread works on                   */
+    struct  bench_t         *   bench_p;
+    /**
+     *  @param  ndx             Payload number                              */
+    intptr_t                    ndx;
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+    //  Set the pointer
+    bench_p = void_p;
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    //  Put all of the payloads (never NULL)
+    for ( ndx = 1;
+          ndx <= bench_p->payload_count;
+          ndx += 1 )
+    {
+        if ( bench_p->ring_p != NULL )
+            ring_put( bench_p->ring_p, (void *)ndx );
+        else
+            queue_put_payload( bench_p->queue_id, (void *)ndx );
+    }
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+    return( NULL );
+}
+
+/****************************************************************************/
+/**
+ *  Benchmark consumer thread.
+ *
+ *  @param  void_p              Pointer to a bench_t
+ *
+ *  @return NULL                Always
+ *
+ *  @note
+ *
+ ****************************************************************************/
+
+static
+void    *
+BENCH__consumer(
+    void                    *   void_p
+    )
+{
+    /**
+     *  @param  bench_p         What this thread works on                   */
+    struct  bench_t         *   bench_p;
+    /**
+     *  @param  payload_p       Pointer to the payload                      */
+    void                    *   payload_p;
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+    //  Set the pointer
+    bench_p = void_p;
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    //  Get payloads until told to stop
+    do
+    {
+        if ( bench_p->ring_p != NULL )
+            payload_p = ring_get( bench_p->ring_p );
+        else
+            payload_p = queue_get_payload( bench_p->queue_id );
+
+    }   while( payload_p != &bench_stop );
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+    return( NULL );
+}
+
+/****************************************************************************/
+/**
+ *  Time one benchmark run.
+ *
+ *  @param  ring_p              Ring under test (NULL for the queue)
+ *  @param  queue_id            libtools queue under test
+ *  @param  thread_count        Number of producers (and consumers)
+ *
+ *  @return seconds             Wall clock time for the run
+ *
+ *  @note
+ *
+ ****************************************************************************/
+
+static
+double
+BENCH__run(
+    struct  ring_t          *   ring_p,
+    int                         queue_id,
+    int                         thread_count
+    )
+{
+    /**
+     *  @param  bench           What the threads work on                    */
+    struct  bench_t             bench;
+    /**
+     *  @param  producer        Producer threads                            */
+    pthread_t                   producer[ BENCH_THREADS_MAX ];
+    /**
+     *  @param  consumer        Consumer threads                            */
+    pthread_t                   consumer[ BENCH_THREADS_MAX ];
+    /**
+     *  @param  start           Start time                                  */
+    struct  timespec            start;
+    /**
+     *  @param  stop            Stop time                                   */
+    struct  timespec            stop;
+    /**
+     *  @param  ndx             Thread number                               */
+    int                         ndx;
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+    //  Split the payloads across the producers
+    bench.ring_p        = ring_p;
+    bench.queue_id      = queue_id;
+    bench.payload_count = BENCH_PAYLOADS / thread_count;
+
+    //  Start the clock
+    clock_gettime( CLOCK_MONOTONIC, &start );
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    //  Launch the threads
+    for ( ndx = 0; ndx < thread_count; ndx += 1 )
+    {
+        pthread_create( &consumer[ ndx ], NULL, BENCH__consumer, &bench );
+        pthread_create( &producer[ ndx ], NULL, BENCH__producer, &bench );
+    }
+
+    //  Wait for the producers
+    for ( ndx = 0; ndx < thread_count; ndx += 1 )
+    {
+        pthread_join( producer[ ndx ], NULL );
+    }
+
+    //  Stop the consumers
+    for ( ndx = 0; ndx < thread_count; ndx += 1 )
+    {
+        if ( ring_p != NULL )
+            ring_put( ring_p, &bench_stop );
+        else
+            queue_put_payload( queue_id, &bench_stop );
+    }
+
+    //  Wait for the consumers
+    for ( ndx = 0; ndx < thread_count; ndx += 1 )
+    {
+        pthread_join( consumer[ ndx ], NULL );
+    }
+
+    //  Stop the clock
+    clock_gettime( CLOCK_MONOTONIC, &stop );
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+    return(   (double)( stop.tv_sec  - start.tv_sec  )
+            + (double)( stop.tv_nsec - start.tv_nsec ) / 1000000000.0 );
+}
+
+/****************************************************************************/
+/**
+ *  Compare the ring buffer against the libtools queue.
+ *
+ *  @param  void                No parameters are passed into this function.
+ *
+ *  @return void                No information is returned
+ *
+ *  @note
+ *      Runs with 1, 4 and 16 producers.  Each run has the same number of
+ *      consumers as producers.
+ *
+ ****************************************************************************/
+
+void
+RING__BENCH_mpmc(
+    void
+    )
+{
+    /**
+     *  @param  thread_count    Producers (and consumers) for each run      */
+    static
+    int                         thread_count[ ] = { 1, 4, BENCH_THREADS_MAX };
+    /**
+     *  @param  ndx             Index into thread_count                     */
+    int                         ndx;
+    /**
+     *  @param  ring_p          Ring under test                             */
+    struct  ring_t          *   ring_p;
+    /**
+     *  @param  queue_name      Name of the libtools queue under test       */
+    char                        queue_name[ THREAD_NAME_SIZE ];
+    /**
+     *  @param  seconds         Run time                                    */
+    double                      seconds;
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+    log_write( MID_INFO, "RING__BENCH",
+               "%d payloads, depth %d\n", BENCH_PAYLOADS, BENCH_DEPTH );
+    log_write( MID_INFO, "RING__BENCH",
+               "QUEUE            PRODUCERS    SECONDS     PAYLOADS/SEC\n" );
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    for ( ndx = 0;
+          ndx < (int)( sizeof( thread_count ) / sizeof( thread_count[ 0 ] ) );
+          ndx += 1 )
+    {
+        //  RING_WAIT_BLOCK
+        ring_p  = ring_new( BENCH_DEPTH, RING_WAIT_BLOCK );
+        seconds = BENCH__run( ring_p, 0, thread_count[ ndx ] );
+        ring_kill( ring_p );
+        log_write( MID_INFO, "RING__BENCH",
+                   "ring (block)     %9d %10.3f %16.0f\n",
+                   thread_count[ ndx ], seconds, BENCH_PAYLOADS / seconds );
+
+        //  RING_WAIT_SPIN
+        ring_p  = ring_new( BENCH_DEPTH, RING_WAIT_SPIN );
+        seconds = BENCH__run( ring_p, 0, thread_count[ ndx ] );
+        ring_kill( ring_p );
+        log_write( MID_INFO, "RING__BENCH",
+                   "ring (spin)      %9d %10.3f %16.0f\n",
+                   thread_count[ ndx ], seconds, BENCH_PAYLOADS / seconds );
+
+        //  libtools queue
+        snprintf( queue_name, sizeof( queue_name ),
+                  "BENCH:%02d", thread_count[ ndx ] );
+        seconds = BENCH__run( NULL,
+                              queue_new( queue_name, BENCH_DEPTH ),
+                              thread_count[ ndx ] );
+        log_write( MID_INFO, "RING__BENCH",
+                   "libtools queue   %9d %10.3f %16.0f\n",
+                   thread_count[ ndx ], seconds, BENCH_PAYLOADS / seconds );
+    }
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+}
+/****************************************************************************/
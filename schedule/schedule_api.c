@@ -0,0 +1,289 @@
+/*******************************  COPYRIGHT  ********************************/
+/**
+ *  Author? "Gregory N. Leonhardt"
+ *  License? "CC BY-NC 2.0"
+ *           "https://creativecommons.org/licenses/by-nc/2.0/"
+ *
+ ****************************************************************************/
+
+/******************************** JAVADOC ***********************************/
+/**
+ *  This file contains public function that makeup the external
+ *  library components of the 'schedule' library.
+ *
+ *  @note
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ *  Compiler directives
+ ****************************************************************************/
+
+#define ALLOC_SCHEDULE          ( "ALLOCATE STORAGE FOR SCHEDULE" )
+
+/****************************************************************************
+ * System Function API
+ ****************************************************************************/
+
+                                //*******************************************
+#include <stdint.h>             //  Alternative storage types
+#include <stdbool.h>            //  TRUE, FALSE, etc.
+#include <stdio.h>              //  Standard I/O definitions
+                                //*******************************************
+#include <stdlib.h>             //  strtoull( ), qsort( )
+#include <string.h>             //  Functions for managing strings
+#include <pthread.h>            //  POSIX threads
+                                //*******************************************
+
+/****************************************************************************
+ * Application APIs
+ ****************************************************************************/
+
+                                //*******************************************
+#include "global.h"             //  Global stuff for this application
+#include "libtools_api.h"       //  My Tools Library
+                                //*******************************************
+#include "schedule_api.h"       //  API for all schedule_*          PUBLIC
+#include "schedule_lib.h"       //  API for all SCHEDULE__*         PRIVATE
+                                //*******************************************
+
+/****************************************************************************
+ * Private API Enumerations
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Private API Definitions
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Private API Structures
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Private API Storage Allocation
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+/**
+ *  @param  schedule_mutex      Protects the file list                      */
+static
+pthread_mutex_t                 schedule_mutex = PTHREAD_MUTEX_INITIALIZER;
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Public API Functions
+ ****************************************************************************/
+
+/****************************************************************************/
+/**
+ *  Hold an input file until the directory walk is finished.
+ *
+ *  @param  file_info_p         Pointer to a file information structure
+ *  @param  manifest_p          Manifest entry for the new or changed file
+ *
+ *  @return void                No information is returned
+ *
+ *  @note
+ *      Called from all of the walker threads at the same time, for the
+ *      files that would be queued: the caller drops the small and the
+ *      unchanged files first, so they are not part of the estimate.
+ *
+ ****************************************************************************/
+
+void
+schedule_add(
+    struct  file_info_t     *   file_info_p,
+    struct  manifest_entry_t *  manifest_p
+    )
+{
+    /**
+     *  @param  file_size       File size in bytes                          */
+    uint64_t                    file_size;
+    /**
+     *  @param  list_p          The bigger file list                        */
+    struct  schedule_file_t *   list_p;
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+    file_size = strtoull( file_info_p->file_size, NULL, 10 );
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    pthread_mutex_lock( &schedule_mutex );
+
+    //  Is there room for one more ?
+    if ( schedule_count == schedule_max )
+    {
+        //  NO:     Make the list bigger
+        if ( schedule_max == 0 )
+        {
+            schedule_max = SCHEDULE_FILES_INITIAL;
+        }
+        else
+        {
+            schedule_max *= 2;
+        }
+        list_p = mem_malloc( sizeof( struct schedule_file_t ) * schedule_max );
+
+        if ( list_p == NULL )
+        {
+            log_write( MID_FATAL, "schedule",
+                       "Out of memory for %d files.\n", schedule_max );
+        }
+
+        //  Move the files found so far
+        if ( schedule_file_p != NULL )
+        {
+            memcpy( list_p, schedule_file_p,
+                    sizeof( struct schedule_file_t ) * schedule_count );
+            mem_free( schedule_file_p );
+        }
+        schedule_file_p = list_p;
+    }
+
+    //  Add it to the list
+    schedule_file_p[ schedule_count ].file_size   = file_size;
+    schedule_file_p[ schedule_count ].file_info_p = file_info_p;
+    schedule_file_p[ schedule_count ].manifest_p  = manifest_p;
+    schedule_count += 1;
+
+    pthread_mutex_unlock( &schedule_mutex );
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+}
+
+/****************************************************************************/
+/**
+ *  Queue the held input files, largest first.
+ *
+ *  @param  worker_count        Number of threads that take a whole file
+ *  @param  split_bytes         Files bigger than this are split between
+ *                              the threads, zero when they are not
+ *  @param  queue_p             Called for every file, largest first
+ *
+ *  @return void                No information is returned
+ *
+ *  @note
+ *      Largest first is the longest-processing-time rule: each thread
+ *      takes the biggest file that is left as soon as it is free, so the
+ *      small files fill in the gaps at the end.
+ *      The report compares the estimated makespan (the busiest thread's
+ *      bytes) of this order with the order the files were found in.
+ *
+ ****************************************************************************/
+
+void
+schedule_run(
+    int                         worker_count,
+    uint64_t                    split_bytes,
+    void                    ( * queue_p )( struct file_info_t *,
+                                           struct manifest_entry_t * )
+    )
+{
+    /**
+     *  @param  walk_span       Makespan in the order the files were found  */
+    uint64_t                    walk_span;
+    /**
+     *  @param  lpt_span        Makespan largest first                      */
+    uint64_t                    lpt_span;
+    /**
+     *  @param  saved_pct       Percent of the walk order makespan saved    */
+    int64_t                     saved_pct;
+    /**
+     *  @param  ndx             Index into the file list                    */
+    int                         ndx;
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+    //  Keep the worker count sane
+    if ( worker_count < 1 )
+    {
+        worker_count = 1;
+    }
+    else if ( worker_count > SCHEDULE_WORKERS_MAX )
+    {
+        worker_count = SCHEDULE_WORKERS_MAX;
+    }
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    //  How long would the files take in the order they were found ?
+    walk_span = SCHEDULE__makespan( schedule_file_p, schedule_count,
+                                    worker_count, split_bytes );
+
+    //  Biggest first
+    if ( schedule_count > 1 )
+    {
+        qsort( schedule_file_p, schedule_count,
+               sizeof( struct schedule_file_t ), SCHEDULE__compare );
+    }
+
+    //  And how long largest first ?
+    lpt_span = SCHEDULE__makespan( schedule_file_p, schedule_count,
+                                   worker_count, split_bytes );
+
+    //  Largest first can lose (3,3,2,2,2 on two threads is 7 against 6)
+    if ( walk_span == 0 )
+    {
+        saved_pct = 0;
+    }
+    else
+    {
+        saved_pct = ( (int64_t)walk_span - (int64_t)lpt_span ) * 100
+                  / (int64_t)walk_span;
+    }
+
+    //  Progress report.
+    log_write( MID_INFO, "schedule",
+               "Estimated makespan for %d files on %d threads: "
+               "walk order %llu MB, largest first %llu MB (%d%% %s).\n",
+               schedule_count, worker_count,
+               (unsigned long long)( walk_span / ( 1024 * 1024 ) ),
+               (unsigned long long)( lpt_span  / ( 1024 * 1024 ) ),
+               (int)( ( saved_pct < 0 ) ? -saved_pct : saved_pct ),
+               ( saved_pct < 0 ) ? "longer" : "shorter" );
+
+    //  Queue them
+    for ( ndx = 0; ndx < schedule_count; ndx += 1 )
+    {
+        queue_p( schedule_file_p[ ndx ].file_info_p,
+                 schedule_file_p[ ndx ].manifest_p );
+    }
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  Clean up
+    if ( schedule_file_p != NULL )
+    {
+        mem_free( schedule_file_p );
+        schedule_file_p = NULL;
+    }
+    schedule_count  = 0;
+    schedule_max    = 0;
+
+    //  DONE!
+}
+/****************************************************************************/
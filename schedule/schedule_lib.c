@@ -0,0 +1,258 @@
+/*******************************  COPYRIGHT  ********************************/
+/**
+ *  Author? "Gregory N. Leonhardt"
+ *  License? "CC BY-NC 2.0"
+ *           "https://creativecommons.org/licenses/by-nc/2.0/"
+ *
+ ****************************************************************************/
+
+/******************************** JAVADOC ***********************************/
+/**
+ *  This file contains private functions that makeup the internal
+ *  library components of the 'schedule' library.
+ *
+ *  @note
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ *  Compiler directives
+ ****************************************************************************/
+
+
+/****************************************************************************
+ * System Function API
+ ****************************************************************************/
+
+                                //*******************************************
+#include <stdint.h>             //  Alternative storage types
+#include <stdbool.h>            //  TRUE, FALSE, etc.
+#include <stdio.h>              //  Standard I/O definitions
+                                //*******************************************
+#include <string.h>             //  Functions for managing strings
+                                //*******************************************
+
+/****************************************************************************
+ * Application APIs
+ ****************************************************************************/
+
+                                //*******************************************
+#include "global.h"             //  Global stuff for this application
+#include "libtools_api.h"       //  My Tools Library
+                                //*******************************************
+#include "schedule_api.h"       //  API for all schedule_*          PUBLIC
+#include "schedule_lib.h"       //  API for all SCHEDULE__*         PRIVATE
+                                //*******************************************
+
+/****************************************************************************
+ * Enumerations local to this file
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Definitions local to this file
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Structures local to this file
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Storage Allocation local to this file
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * LIB Functions
+ ****************************************************************************/
+
+/****************************************************************************/
+/**
+ *  qsort( ) compare function: largest file first.
+ *
+ *  @param  a_p                 Pointer to a schedule_file_t
+ *  @param  b_p                 Pointer to a schedule_file_t
+ *
+ *  @return compare_rc          < 0 when a is larger, > 0 when b is larger
+ *
+ *  @note
+ *      Files of the same size keep a stable order by name, so two runs
+ *      over the same tree queue the files in the same order.
+ *
+ ****************************************************************************/
+
+int
+SCHEDULE__compare(
+    const   void            *   a_p,
+    const   void            *   b_p
+    )
+{
+    /**
+     *  @param  a_file_p        First file                                  */
+    const   struct  schedule_file_t *   a_file_p;
+    /**
+     *  @param  b_file_p        Second file                                 */
+    const   struct  schedule_file_t *   b_file_p;
+    /**
+     *  @param  compare_rc      Return code                                 */
+    int                         compare_rc;
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+    a_file_p = a_p;
+    b_file_p = b_p;
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    //  Different sizes ?
+    if ( a_file_p->file_size != b_file_p->file_size )
+    {
+        //  YES:    Larger one first
+        compare_rc = ( a_file_p->file_size > b_file_p->file_size ) ? -1 : 1;
+    }
+    else
+    {
+        //  NO:     By directory, then by name
+        compare_rc = strcmp( a_file_p->file_info_p->dir_name,
+                             b_file_p->file_info_p->dir_name );
+
+        if ( compare_rc == 0 )
+        {
+            compare_rc = strcmp( a_file_p->file_info_p->file_name,
+                                 b_file_p->file_info_p->file_name );
+        }
+    }
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+    return( compare_rc );
+}
+
+/****************************************************************************/
+/**
+ *  Estimate the makespan of a file order.
+ *
+ *  @param  file_p              The files, in the order they are queued
+ *  @param  file_count          Number of files
+ *  @param  worker_count        Number of threads that take a whole file
+ *  @param  split_bytes         Files bigger than this are split between
+ *                              the threads, zero when they are not
+ *
+ *  @return makespan            Bytes handled by the busiest thread
+ *
+ *  @note
+ *      A file's cost is its size.  Each file goes to the thread that
+ *      finishes first, the way the threads take files off the queue.
+ *      A split file goes out as split_bytes parts, one after the other,
+ *      the way IMPORT queues the parts of a big mailbox.
+ *
+ ****************************************************************************/
+
+uint64_t
+SCHEDULE__makespan(
+    struct  schedule_file_t *   file_p,
+    int                         file_count,
+    int                         worker_count,
+    uint64_t                    split_bytes
+    )
+{
+    /**
+     *  @param  busy            Bytes given to each thread                  */
+    uint64_t                    busy[ SCHEDULE_WORKERS_MAX ];
+    /**
+     *  @param  makespan        Bytes handled by the busiest thread         */
+    uint64_t                    makespan;
+    /**
+     *  @param  left            Bytes of the file not handed out yet        */
+    uint64_t                    left;
+    /**
+     *  @param  piece           Bytes handed out to one thread              */
+    uint64_t                    piece;
+    /**
+     *  @param  first           The thread that finishes first              */
+    int                         first;
+    /**
+     *  @param  ndx             Index into the file list                    */
+    int                         ndx;
+    /**
+     *  @param  worker          Thread number                               */
+    int                         worker;
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+    memset( busy, '\0', sizeof( busy ) );
+    makespan = 0;
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    //  Hand out every file
+    for ( ndx = 0; ndx < file_count; ndx += 1 )
+    {
+        //  A file bigger than the split size is handed out a part at a time
+        left = file_p[ ndx ].file_size;
+
+        do
+        {
+            //  How much goes to one thread ?
+            if (    ( split_bytes != 0    )
+                 && ( left > split_bytes ) )
+            {
+                //  A part of a split file
+                piece = split_bytes;
+            }
+            else
+            {
+                //  The whole (rest of the) file
+                piece = left;
+            }
+            left -= piece;
+
+            //  Find the thread that finishes first
+            for ( first = 0, worker = 1; worker < worker_count; worker += 1 )
+            {
+                if ( busy[ worker ] < busy[ first ] )
+                {
+                    first = worker;
+                }
+            }
+
+            busy[ first ] += piece;
+
+            //  Is it the busiest thread now ?
+            if ( busy[ first ] > makespan )
+            {
+                //  YES:    The run takes at least this long
+                makespan = busy[ first ];
+            }
+        }   while( left != 0 );
+    }
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+    return( makespan );
+}
+/****************************************************************************/
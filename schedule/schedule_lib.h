@@ -0,0 +1,124 @@
+/*******************************  COPYRIGHT  ********************************/
+/**
+ *  Author? "Gregory N. Leonhardt"
+ *  License? "CC BY-NC 2.0"
+ *           "https://creativecommons.org/licenses/by-nc/2.0/"
+ *
+ ****************************************************************************/
+
+#ifndef SCHEDULE_LIB_H
+#define SCHEDULE_LIB_H
+
+/******************************** JAVADOC ***********************************/
+/**
+ *  This file contains private definitions (etc.) that apply to internal
+ *  library components of the 'schedule' library.
+ *
+ *  @note
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ *  Compiler directives
+ ****************************************************************************/
+
+#ifdef ALLOC_SCHEDULE
+   #define SCHEDULE_EXT
+#else
+   #define SCHEDULE_EXT     extern
+#endif
+
+/****************************************************************************
+ * System APIs
+ ****************************************************************************/
+
+                                //*******************************************
+#include <stdint.h>             //  uint64_t
+                                //*******************************************
+
+/****************************************************************************
+ * Application APIs
+ ****************************************************************************/
+
+                                //*******************************************
+                                //*******************************************
+
+/****************************************************************************
+ * Library Private Definitions
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+#define SCHEDULE_FILES_INITIAL  ( 4096 )
+#define SCHEDULE_WORKERS_MAX    (  256 )
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Library Private Enumerations
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Library Private Structures
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+/**
+ *  @param  schedule_file_t     One input file waiting to be queued         */
+struct  schedule_file_t
+{
+    /**
+     *  @param  file_size       File size in bytes                          */
+    uint64_t                    file_size;
+    /**
+     *  @param  file_info_p     The file                                    */
+    struct  file_info_t     *   file_info_p;
+    /**
+     *  @param  manifest_p      Manifest entry for the new or changed file  */
+    struct  manifest_entry_t *  manifest_p;
+};
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Library Private Storage Allocation
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+/**
+ *  @param  schedule_file_p     The files, in the order they were found     */
+SCHEDULE_EXT
+struct  schedule_file_t     *   schedule_file_p;
+/**
+ *  @param  schedule_count      Number of files                             */
+SCHEDULE_EXT
+int                             schedule_count;
+/**
+ *  @param  schedule_max        Room in schedule_file_p                     */
+SCHEDULE_EXT
+int                             schedule_max;
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Library Private Prototypes
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+int
+SCHEDULE__compare(
+    const   void            *   a_p,
+    const   void            *   b_p
+    );
+//----------------------------------------------------------------------------
+uint64_t
+SCHEDULE__makespan(
+    struct  schedule_file_t *   file_p,
+    int                         file_count,
+    int                         worker_count,
+    uint64_t                    split_bytes
+    );
+//----------------------------------------------------------------------------
+
+/****************************************************************************/
+
+#endif                      //    SCHEDULE_LIB_H
@@ -30,6 +30,9 @@
 #include <stdbool.h>            //  TRUE, FALSE, etc.
 #include <stdio.h>              //  Standard I/O definitions
                                 //*******************************************
+#include <string.h>             //  Functions for managing strings
+#include <time.h>               //  clock_gettime( )
+#include <pthread.h>            //  POSIX threads
                                 //*******************************************
 
 /****************************************************************************
@@ -70,6 +73,14 @@
  ****************************************************************************/
 
 //----------------------------------------------------------------------------
+/**
+ * @param idle_mutex            Protects the process idle signal            */
+static
+pthread_mutex_t                 idle_mutex = PTHREAD_MUTEX_INITIALIZER;
+/**
+ * @param idle_cond             Signaled when a group runs out of work      */
+static
+pthread_cond_t                  idle_cond  = PTHREAD_COND_INITIALIZER;
 //----------------------------------------------------------------------------
 
 /****************************************************************************
@@ -155,8 +166,108 @@ tcb_new(
               sizeof( import_tcb->thread_name ),
               "%s%02d", group_name, group_thread_num );
 
+    //  Save the group name for the worker threads
+    snprintf( tcb_p->group_name,
+              sizeof( tcb_p->group_name ),
+              "%s", group_name );
+
     //  Create the queue
+#if QUEUE_RING
+    tcb_p->queue_id = -1;
+    tcb_p->ring_p   = ring_new( max_depth, RING_WAIT_BLOCK );
+#else
     tcb_p->queue_id = queue_new( tcb_p->thread_name, max_depth );
+    tcb_p->ring_p   = NULL;
+#endif
+
+    //  This TCB is the owner of the group
+    tcb_p->group_tcb_p    = tcb_p;
+    tcb_p->thread_state   = TS_STARTUP;
+    tcb_p->thread_count   = 0;
+    tcb_p->ready_count    = 0;
+    tcb_p->working_count  = 0;
+    tcb_p->inflight_count = 0;
+    tcb_p->inline_p       = NULL;
+    tcb_p->payload_count  = 0;
+    tcb_p->batch.payload_count = 0;
+
+    //  Create the group start-up signal
+    pthread_mutex_init( &tcb_p->group_mutex, NULL );
+    pthread_cond_init( &tcb_p->group_cond, NULL );
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+    return( tcb_p );
+}
+/****************************************************************************/
+
+/****************************************************************************/
+/**
+ *  Create a worker Thread Control Block that shares the queue of a group.
+ *
+ *  @param  group_tcb_p         Pointer to the group Thread Control Block
+ *  @param  group_thread_num    Group Thread Number
+ *
+ *  @return tcb_p               Pointer to a Thread Control Block
+ *
+ *  @note
+ *      The worker does not own the queue.  Every worker in the group reads
+ *      from the queue that was created by tcb_new( ).
+ *
+ ****************************************************************************/
+
+struct  tcb_t   *
+tcb_new_worker(
+    struct  tcb_t           *   group_tcb_p,
+    int                         group_thread_num
+    )
+{
+    /**
+     *  @param  tcb_p           Pointer to a Thread Control Block           */
+    struct  tcb_t           *   tcb_p;
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+    //  Just in case everything goes south.
+    tcb_p = NULL;
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    //  Allocate storage for a new Thread Control Block
+    tcb_p = mem_malloc( sizeof( struct tcb_t ) );
+
+    //  Build the thread name
+    snprintf( tcb_p->thread_name,
+              sizeof( tcb_p->thread_name ),
+              "%s%02d", group_tcb_p->group_name, group_thread_num );
+
+    //  Copy the group name
+    memcpy( tcb_p->group_name,
+            group_tcb_p->group_name,
+            sizeof( tcb_p->group_name ) );
+
+    //  Share the group queue
+    tcb_p->queue_id      = group_tcb_p->queue_id;
+    tcb_p->ring_p        = group_tcb_p->ring_p;
+    tcb_p->thread_id     = group_thread_num;
+
+    //  Link the worker to the group
+    tcb_p->group_tcb_p    = group_tcb_p;
+    tcb_p->thread_state   = TS_STARTUP;
+    tcb_p->thread_count   = 0;
+    tcb_p->ready_count    = 0;
+    tcb_p->working_count  = 0;
+    tcb_p->inflight_count = 0;
+    tcb_p->inline_p       = NULL;
+    tcb_p->payload_count  = 0;
+    tcb_p->batch.payload_count = 0;
 
     /************************************************************************
      *  Function Exit
@@ -165,4 +276,822 @@ tcb_new(
     //  DONE!
     return( tcb_p );
 }
-/****************************************************************************/
\ No newline at end of file
+
+/****************************************************************************/
+/**
+ *  Change the execution state of a worker thread.
+ *
+ *  @param  tcb_p               Pointer to a Thread Control Block
+ *  @param  thread_state        The new execution state
+ *
+ *  @return void                No information is returned
+ *
+ *  @note
+ *      The group counters are updated atomically so that the state of the
+ *      whole group can be tested without looking at every worker.
+ *
+ *      Every trip through TS_WORKING consumes the payload(s) the worker took
+ *      off the queue.  Leaving TS_WORKING retires them from the group
+ *      in-flight count and wakes tcb_wait_idle( ) when the group has run
+ *      dry.
+ *
+ ****************************************************************************/
+
+void
+tcb_set_state(
+    struct  tcb_t           *   tcb_p,
+    enum    thread_stat_e       thread_state
+    )
+{
+    /**
+     *  @param  group_tcb_p     Pointer to the group Thread Control Block   */
+    struct  tcb_t           *   group_tcb_p;
+    /**
+     *  @param  old_state       The previous execution state                */
+    enum    thread_stat_e       old_state;
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+    //  Locate the group
+    group_tcb_p = tcb_p->group_tcb_p;
+
+    //  Swap in the new state
+    old_state = __atomic_exchange_n( &tcb_p->thread_state, thread_state,
+                                     __ATOMIC_SEQ_CST );
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    //  Did the thread just finish initialization ?
+    if (    ( old_state    == TS_STARTUP )
+         && ( thread_state != TS_STARTUP ) )
+    {
+        //  YES:    One more worker is ready
+        pthread_mutex_lock( &group_tcb_p->group_mutex );
+        group_tcb_p->ready_count += 1;
+        pthread_cond_broadcast( &group_tcb_p->group_cond );
+        pthread_mutex_unlock( &group_tcb_p->group_mutex );
+    }
+
+    //  Did the thread start working ?
+    if (    ( old_state    != TS_WORKING )
+         && ( thread_state == TS_WORKING ) )
+    {
+        //  YES:    One more worker is busy
+        __atomic_add_fetch( &group_tcb_p->working_count, 1, __ATOMIC_SEQ_CST );
+    }
+    else
+    //  Did the thread stop working ?
+    if (    ( old_state    == TS_WORKING )
+         && ( thread_state != TS_WORKING ) )
+    {
+        //  YES:    One less worker is busy
+        __atomic_sub_fetch( &group_tcb_p->working_count, 1, __ATOMIC_SEQ_CST );
+
+        //  Was that the last payload for this group ?
+        if ( __atomic_sub_fetch( &group_tcb_p->inflight_count,
+                                 tcb_p->payload_count,
+                                 __ATOMIC_SEQ_CST ) == 0 )
+        {
+            //  YES:    Wake anyone waiting for the pipeline to drain
+            pthread_mutex_lock( &idle_mutex );
+            pthread_cond_broadcast( &idle_cond );
+            pthread_mutex_unlock( &idle_mutex );
+        }
+    }
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+}
+
+/****************************************************************************/
+/**
+ *  Launch all worker threads for a thread group.
+ *
+ *  @param  group_tcb_p         Pointer to the group Thread Control Block
+ *  @param  thread_p            Thread function for every worker
+ *  @param  thread_count        Number of worker threads to start
+ *
+ *  @return void                No information is returned
+ *
+ *  @note
+ *
+ ****************************************************************************/
+
+void
+tcb_group_start(
+    struct  tcb_t           *   group_tcb_p,
+    void                    ( * thread_p )( void * ),
+    int                         thread_count
+    )
+{
+    /**
+     *  @param  tcb_p           Pointer to a worker Thread Control Block    */
+    struct  tcb_t           *   tcb_p;
+    /**
+     *  @param  thread_num      Worker thread number                        */
+    int                         thread_num;
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+    //  There must be at least one worker
+    if ( thread_count < 1 )
+    {
+        thread_count = 1;
+    }
+
+    //  Save the size of the group
+    group_tcb_p->thread_count = thread_count;
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    //  Launch the workers
+    for ( thread_num = 1;
+          thread_num <= thread_count;
+          thread_num += 1 )
+    {
+        //  Allocate storage for a worker Thread Control Block
+        tcb_p = tcb_new_worker( group_tcb_p, thread_num );
+
+        //  Launch the worker thread
+        thread_new( thread_p, tcb_p );
+    }
+
+    //  Progress report.
+    log_write( MID_INFO, "tcb_group_start",
+               "%-10s %3d worker thread(s)\n",
+               group_tcb_p->group_name, thread_count );
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+}
+
+/****************************************************************************/
+/**
+ *  Make a thread group run inline on the thread that queues work to it.
+ *
+ *  @param  group_tcb_p         Pointer to the group Thread Control Block
+ *  @param  work_p              Work function for one payload
+ *
+ *  @return void                No information is returned
+ *
+ *  @note
+ *      No worker threads are started.  tcb_queue_put( ) calls the work
+ *      function directly so a payload never leaves the calling thread.
+ *
+ ****************************************************************************/
+
+void
+tcb_group_inline(
+    struct  tcb_t           *   group_tcb_p,
+    void                    ( * work_p )( struct tcb_t *, void * )
+    )
+{
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    //  There aren't any worker threads to wait for
+    group_tcb_p->thread_count = 0;
+
+    //  Save the work function
+    group_tcb_p->inline_p = work_p;
+
+    //  Progress report.
+    log_write( MID_INFO, "tcb_group_inline",
+               "%-10s runs inline\n",
+               group_tcb_p->group_name );
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+}
+
+/****************************************************************************/
+/**
+ *  Wait for every worker in a thread group to finish initialization.
+ *
+ *  @param  group_tcb_p         Pointer to the group Thread Control Block
+ *
+ *  @return void                No information is returned
+ *
+ *  @note
+ *
+ ****************************************************************************/
+
+void
+tcb_group_wait_ready(
+    struct  tcb_t           *   group_tcb_p
+    )
+{
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+    //  Lock the group start-up signal
+    pthread_mutex_lock( &group_tcb_p->group_mutex );
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    //  Are any of the workers still starting ?
+    while ( group_tcb_p->ready_count < group_tcb_p->thread_count )
+    {
+        //  YES:    Sleep until another one is ready
+        pthread_cond_wait( &group_tcb_p->group_cond,
+                           &group_tcb_p->group_mutex );
+    }
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  Release the group start-up signal
+    pthread_mutex_unlock( &group_tcb_p->group_mutex );
+
+    //  DONE!
+}
+
+/****************************************************************************/
+/**
+ *  Test if a thread group has finished all of its work.
+ *
+ *  @param  group_tcb_p         Pointer to the group Thread Control Block
+ *
+ *  @return tcb_rc              TRUE when the thread group is done
+ *                              FALSE when still working
+ *
+ *  @note
+ *
+ ****************************************************************************/
+
+int
+tcb_group_is_done(
+    struct  tcb_t           *   group_tcb_p
+    )
+{
+    /**
+     *  @param  tcb_rc          Function return code                        */
+    int                         tcb_rc;
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+    //  Assume everything is complete
+    tcb_rc = true;
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    //  Is anything queued to, or being worked on by, the group ?
+    if ( __atomic_load_n( &group_tcb_p->inflight_count, __ATOMIC_SEQ_CST ) != 0 )
+    {
+        //  YES:    It's still working
+        tcb_rc = false;
+    }
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+    return( tcb_rc );
+}
+
+/****************************************************************************/
+/**
+ *  Put a payload on the queue of a thread group.
+ *
+ *  @param  group_tcb_p         Pointer to the group Thread Control Block
+ *  @param  payload_p           Pointer to the payload (usually a RCB)
+ *
+ *  @return void                No information is returned
+ *
+ *  @note
+ *      The in-flight count is raised BEFORE the payload is queued.  A worker
+ *      that passes work downstream always does so before it leaves the
+ *      TS_WORKING state, so the sum of all in-flight counts can only reach
+ *      zero when there is really nothing left to do.
+ *
+ *      An inline group does the work right here on the calling thread; the
+ *      payload is still counted by the group that is calling.
+ *
+ ****************************************************************************/
+
+void
+tcb_queue_put(
+    struct  tcb_t           *   group_tcb_p,
+    void                    *   payload_p
+    )
+{
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    //  Does this group run inline ?
+    if ( group_tcb_p->inline_p != NULL )
+    {
+        //  YES:    Do the work now
+        group_tcb_p->inline_p( group_tcb_p, payload_p );
+    }
+    else
+    {
+        //  NO:     One more payload for the group
+        __atomic_add_fetch( &group_tcb_p->inflight_count, 1, __ATOMIC_SEQ_CST );
+
+        //  Put it on the group queue
+#if QUEUE_RING
+        ring_put( group_tcb_p->ring_p, payload_p );
+#else
+        queue_put_payload( group_tcb_p->queue_id, payload_p );
+#endif
+    }
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+}
+
+/****************************************************************************/
+/**
+ *  Get the next payload from the queue of a thread group.
+ *
+ *  @param  tcb_p               Pointer to a (worker) Thread Control Block
+ *
+ *  @return payload_p           Pointer to the payload
+ *
+ *  @note
+ *      Blocks until there is something to get.
+ *
+ ****************************************************************************/
+
+void    *
+tcb_queue_get(
+    struct  tcb_t           *   tcb_p
+    )
+{
+    /**
+     *  @param  payload_p       Pointer to the payload                      */
+    void                    *   payload_p;
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    //  Get it from the group queue
+#if QUEUE_RING
+    payload_p = ring_get( tcb_p->ring_p );
+#else
+    payload_p = queue_get_payload( tcb_p->queue_id );
+#endif
+
+    //  The worker now holds one payload
+    tcb_p->payload_count = 1;
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+    return( payload_p );
+}
+
+/****************************************************************************/
+/**
+ *  Put several payloads on the queue of a thread group.
+ *
+ *  @param  group_tcb_p         Pointer to the group Thread Control Block
+ *  @param  payload_pp          List of payload pointers
+ *  @param  payload_count       Number of payloads in the list
+ *
+ *  @return void                No information is returned
+ *
+ *  @note
+ *      Same rules as tcb_queue_put( ), but the in-flight count is raised
+ *      once and the sleeping workers are woken once for the whole list.
+ *
+ ****************************************************************************/
+
+void
+tcb_queue_put_batch(
+    struct  tcb_t           *   group_tcb_p,
+    void                    **  payload_pp,
+    int                         payload_count
+    )
+{
+    /**
+     *  @param  ndx             Index into the payload list                 */
+    int                         ndx;
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    //  Does this group run inline ?
+    if ( group_tcb_p->inline_p != NULL )
+    {
+        //  YES:    Do the work now
+        for ( ndx = 0;
+              ndx < payload_count;
+              ndx += 1 )
+        {
+            group_tcb_p->inline_p( group_tcb_p, payload_pp[ ndx ] );
+        }
+    }
+    else
+    {
+        //  NO:     More payloads for the group
+        __atomic_add_fetch( &group_tcb_p->inflight_count, payload_count,
+                            __ATOMIC_SEQ_CST );
+
+        //  Put them on the group queue
+#if QUEUE_RING
+        ring_put_batch( group_tcb_p->ring_p, payload_pp, payload_count );
+#else
+        for ( ndx = 0;
+              ndx < payload_count;
+              ndx += 1 )
+        {
+            queue_put_payload( group_tcb_p->queue_id, payload_pp[ ndx ] );
+        }
+#endif
+    }
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+}
+
+/****************************************************************************/
+/**
+ *  Get one or more payloads from the queue of a thread group.
+ *
+ *  @param  tcb_p               Pointer to a (worker) Thread Control Block
+ *  @param  payload_pp          List to receive the payload pointers
+ *  @param  max_count           Size of the list
+ *
+ *  @return payload_count       Number of payloads in the list
+ *
+ *  @note
+ *      Blocks until there is something to get, then takes whatever else is
+ *      already waiting (up to max_count).  The libtools queue can only hand
+ *      out one payload at a time.
+ *
+ ****************************************************************************/
+
+int
+tcb_queue_get_batch(
+    struct  tcb_t           *   tcb_p,
+    void                    **  payload_pp,
+    int                         max_count
+    )
+{
+    /**
+     *  @param  payload_count   Number of payloads in the list              */
+    int                         payload_count;
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    //  Get them from the group queue
+#if QUEUE_RING
+    payload_count = ring_get_batch( tcb_p->ring_p, payload_pp, max_count );
+#else
+    payload_pp[ 0 ] = queue_get_payload( tcb_p->queue_id );
+    payload_count   = 1;
+#endif
+
+    //  The worker now holds all of them
+    tcb_p->payload_count = payload_count;
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+    return( payload_count );
+}
+
+/****************************************************************************/
+/**
+ *  Add a payload to the batch a worker is passing downstream.
+ *
+ *  @param  tcb_p               Pointer to a (worker) Thread Control Block
+ *  @param  group_tcb_p         Pointer to the group Thread Control Block
+ *  @param  payload_p           Pointer to the payload (usually a RCB)
+ *
+ *  @return void                No information is returned
+ *
+ *  @note
+ *      The batch is handed over when it holds TCB_BATCH_MAX payloads or
+ *      when its oldest payload is TCB_BATCH_USEC old.  The age is only
+ *      checked when a payload is added, so the worker MUST call
+ *      tcb_batch_flush( ) before it leaves the TS_WORKING state.
+ *
+ *      An inline group gets the payload right away; there is nothing to
+ *      gain by holding it.  The same goes for a caller that is itself
+ *      running inline, its group TCB is shared by every calling thread.
+ *
+ ****************************************************************************/
+
+void
+tcb_batch_put(
+    struct  tcb_t           *   tcb_p,
+    struct  tcb_t           *   group_tcb_p,
+    void                    *   payload_p
+    )
+{
+    /**
+     *  @param  batch_p         Pointer to the worker batch                 */
+    struct  tcb_batch_t     *   batch_p;
+    /**
+     *  @param  now             Current time                                */
+    struct  timespec            now;
+    /**
+     *  @param  age             Age of the batch in microseconds            */
+    long                        age;
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+    //  Locate the batch
+    batch_p = &tcb_p->batch;
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    //  Is either side running inline ?
+    if (    ( group_tcb_p->inline_p != NULL )
+         || ( tcb_p->inline_p       != NULL ) )
+    {
+        //  YES:    Hand it over now
+        tcb_queue_put( group_tcb_p, payload_p );
+    }
+    else
+    {
+        //  NO:     Is the batch going somewhere else ?
+        if (    ( batch_p->payload_count != 0             )
+             && ( batch_p->group_tcb_p   != group_tcb_p   ) )
+        {
+            //  YES:    Send it on its way
+            tcb_batch_flush( tcb_p );
+        }
+
+        //  Is this the first payload of a new batch ?
+        if ( batch_p->payload_count == 0 )
+        {
+            //  YES:    Start the clock
+            batch_p->group_tcb_p = group_tcb_p;
+            clock_gettime( CLOCK_MONOTONIC, &batch_p->start_time );
+        }
+
+        //  Add the payload
+        batch_p->payload_p[ batch_p->payload_count ] = payload_p;
+        batch_p->payload_count += 1;
+
+        //  Is the batch full ?
+        if ( batch_p->payload_count >= TCB_BATCH_MAX )
+        {
+            //  YES:    Send it on its way
+            tcb_batch_flush( tcb_p );
+        }
+        else
+        {
+            //  NO:     How old is it ?
+            clock_gettime( CLOCK_MONOTONIC, &now );
+            age =   ( now.tv_sec  - batch_p->start_time.tv_sec  ) * 1000000L
+                  + ( now.tv_nsec - batch_p->start_time.tv_nsec ) / 1000L;
+
+            //  Has it waited long enough ?
+            if ( age >= TCB_BATCH_USEC )
+            {
+                //  YES:    Send it on its way
+                tcb_batch_flush( tcb_p );
+            }
+        }
+    }
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+}
+
+/****************************************************************************/
+/**
+ *  Hand the batch a worker is holding to its thread group.
+ *
+ *  @param  tcb_p               Pointer to a (worker) Thread Control Block
+ *
+ *  @return void                No information is returned
+ *
+ *  @note
+ *      Safe to call when the batch is empty.
+ *
+ ****************************************************************************/
+
+void
+tcb_batch_flush(
+    struct  tcb_t           *   tcb_p
+    )
+{
+    /**
+     *  @param  batch_p         Pointer to the worker batch                 */
+    struct  tcb_batch_t     *   batch_p;
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+    //  Locate the batch
+    batch_p = &tcb_p->batch;
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    //  Is there anything in the batch ?
+    if ( batch_p->payload_count != 0 )
+    {
+        //  YES:    Hand it over
+        tcb_queue_put_batch( batch_p->group_tcb_p,
+                             batch_p->payload_p,
+                             batch_p->payload_count );
+
+        //  Start over
+        batch_p->payload_count = 0;
+    }
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+}
+
+/****************************************************************************/
+/**
+ *  Get the number of payloads waiting on the queue of a thread group.
+ *
+ *  @param  tcb_p               Pointer to a Thread Control Block
+ *
+ *  @return count               Number of payloads on the queue
+ *
+ *  @note
+ *
+ ****************************************************************************/
+
+int
+tcb_queue_count(
+    struct  tcb_t           *   tcb_p
+    )
+{
+    /**
+     *  @param  count           Number of payloads on the queue             */
+    int                         count;
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+#if QUEUE_RING
+    count = ring_get_count( tcb_p->ring_p );
+#else
+    count = queue_get_count( tcb_p->queue_id );
+#endif
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+    return( count );
+}
+
+/****************************************************************************/
+/**
+ *  Wait until every thread group in the list has finished all of its work.
+ *
+ *  @param  group_tcb_list      List of group Thread Control Blocks
+ *  @param  group_count         Number of entries in the list
+ *
+ *  @return void                No information is returned
+ *
+ *  @note
+ *      Only call this after the last payload has been handed to the first
+ *      group, otherwise it may return while work is still being queued.
+ *      The list must be in pipeline order; once a group and everything
+ *      upstream of it are idle they stay idle.
+ *
+ ****************************************************************************/
+
+void
+tcb_wait_idle(
+    struct  tcb_t           *   group_tcb_list[ ],
+    int                         group_count
+    )
+{
+    /**
+     *  @param  group_ndx       Index into the group list                   */
+    int                         group_ndx;
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+    //  Lock the process idle signal
+    pthread_mutex_lock( &idle_mutex );
+
+    //  Start with the first group
+    group_ndx = 0;
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    //  Scan the groups
+    while ( group_ndx < group_count )
+    {
+        //  Is this group still working ?
+        if ( tcb_group_is_done( group_tcb_list[ group_ndx ] ) != true )
+        {
+            //  YES:    Sleep until some group runs dry and start over
+            pthread_cond_wait( &idle_cond, &idle_mutex );
+            group_ndx = 0;
+        }
+        else
+        {
+            //  NO:     Check the next group
+            group_ndx += 1;
+        }
+    }
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  Release the process idle signal
+    pthread_mutex_unlock( &idle_mutex );
+
+    //  DONE!
+}
+/****************************************************************************/
@@ -0,0 +1,381 @@
+/*******************************  COPYRIGHT  ********************************/
+/**
+ *  Author? "Gregory N. Leonhardt"
+ *  License? "CC BY-NC 2.0"
+ *           "https://creativecommons.org/licenses/by-nc/2.0/"
+ *
+ ****************************************************************************/
+
+/******************************** JAVADOC ***********************************/
+/**
+ *  This file contains the unit tests for the internal library components
+ *  of the 'walk' library.
+ *
+ *  @note
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ *  Compiler directives
+ ****************************************************************************/
+
+
+/****************************************************************************
+ * System Function API
+ ****************************************************************************/
+
+                                //*******************************************
+#include <stdint.h>             //  Alternative storage types
+#include <stdbool.h>            //  TRUE, FALSE, etc.
+#include <stdio.h>              //  Standard I/O definitions
+                                //*******************************************
+#include <stdlib.h>             //  mkdtemp( )
+#include <string.h>             //  Functions for managing strings
+#include <unistd.h>             //  unlink( ), rmdir( )
+#include <sys/stat.h>           //  mkdir( )
+                                //*******************************************
+
+/****************************************************************************
+ * Application APIs
+ ****************************************************************************/
+
+                                //*******************************************
+#include "global.h"             //  Global stuff for this application
+#include "libtools_api.h"       //  My Tools Library
+                                //*******************************************
+#include "walk_api.h"           //  API for all walk_*              PUBLIC
+#include "../walk_lib.h"        //  API for all WALK__*             PRIVATE
+                                //*******************************************
+
+/****************************************************************************
+ * Enumerations local to this file
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Definitions local to this file
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+/**
+ *  @param  TEST_WALKERS        Walker threads asked for by the test        */
+#define TEST_WALKERS            (    4 )
+/**
+ *  @param  TEST_FILES_MAX      Most files one walk can record              */
+#define TEST_FILES_MAX          (   64 )
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Structures local to this file
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+/**
+ *  The test tree, created in this (unsorted) order.  Directories end
+ *  with a '/'.  The tree is removed in the reverse order.              */
+static
+char                        *   TEST_tree[ ] =
+{
+    "m.txt",        "c/",           "c/z.txt",      "c/b.txt",
+    "a.txt",        "q/",           "q/q/",         "q/q/y.txt",
+    "q/k.txt",      "q/q/a.txt",    "z.txt",        "c/m.txt",
+    "b/",           "b/x.txt",      "b/c.txt",      "q/d.txt",
+    "k.txt",        "b/a/",         "b/a/e.txt",    "b/a/b.txt",
+    NULL
+};
+/**
+ *  The order an ordered walk finds the files in: each directory's files
+ *  by name, then its subdirectories newest pushed first.               */
+static
+char                        *   TEST_expect[ ] =
+{
+    "a.txt",        "k.txt",        "m.txt",        "z.txt",
+    "q/d.txt",      "q/k.txt",      "q/q/a.txt",    "q/q/y.txt",
+    "c/b.txt",      "c/m.txt",      "c/z.txt",      "b/c.txt",
+    "b/x.txt",      "b/a/b.txt",    "b/a/e.txt",
+    NULL
+};
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Storage Allocation local to this file
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+/**
+ *  @param  TEST_found          Files in the order one walk found them      */
+static
+char                            TEST_found[ TEST_FILES_MAX ][ FILENAME_MAX ];
+/**
+ *  @param  TEST_found_count    Number of files found                       */
+static
+int                             TEST_found_count;
+/**
+ *  @param  TEST_first          The files found by the first walk           */
+static
+char                            TEST_first[ TEST_FILES_MAX ][ FILENAME_MAX ];
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * LIB Functions
+ ****************************************************************************/
+
+/****************************************************************************/
+/**
+ *  Record a file found by the walk.
+ *
+ *  @param  file_info_p         Pointer to a file information structure
+ *
+ *  @return void                No information is returned
+ *
+ *  @note
+ *
+ ****************************************************************************/
+
+static
+void
+WALK__TEST_found(
+    struct  file_info_t     *   file_info_p
+    )
+{
+    /**
+     *  @param  found_ndx       Where this file goes in the found list      */
+    int                         found_ndx;
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+    //  Take the next slot (an unordered walk calls this on many threads)
+    found_ndx = __atomic_fetch_add( &TEST_found_count, 1, __ATOMIC_SEQ_CST );
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    //  Is there room for it ?
+    if ( found_ndx < TEST_FILES_MAX )
+    {
+        //  YES:    Save the path & name
+        snprintf( TEST_found[ found_ndx ], FILENAME_MAX, "%s/%s",
+                  file_info_p->dir_name, file_info_p->file_name );
+    }
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  Done with the file information
+    mem_free( file_info_p );
+
+    //  DONE!
+}
+
+/****************************************************************************/
+/**
+ *  Unit tests for an ordered walk_dir( )
+ *
+ *  @param  void                No parameters are passed into this function.
+ *
+ *  @return walk_rc             TRUE if all test pass, else FALSE
+ *
+ *  @note
+ *      Walks the same tree twice, asking for several walker threads each
+ *      time, and checks that the files come out in the same, expected,
+ *      order.  That order is the one -ordered numbers the input files by.
+ *
+ ****************************************************************************/
+
+int
+WALK__TEST_ordered(
+    void
+    )
+{
+    /**
+     *  @param  walk_rc         Return code from this function              */
+    int                         walk_rc;
+    /**
+     *  @param  root            The test tree                               */
+    char                        root[ FILENAME_MAX ];
+    /**
+     *  @param  path            Full path & name of a test file             */
+    char                        path[ FILENAME_MAX ];
+    /**
+     *  @param  first_count     Number of files found by the first walk     */
+    int                         first_count;
+    /**
+     *  @param  file_count      Number of files in the test tree            */
+    int                         file_count;
+    /**
+     *  @param  tree_count      Number of test tree entries created         */
+    int                         tree_count;
+    /**
+     *  @param  file_p          Test file                                   */
+    FILE                    *   file_p;
+    /**
+     *  @param  ndx             Index to array                              */
+    int                         ndx;
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+    //  Initialize variables
+    walk_rc    = true;
+    file_count = 0;
+
+    //  Build the test tree
+    snprintf( root, sizeof( root ), "/tmp/walk_wbt_XXXXXX" );
+
+    if ( mkdtemp( root ) == NULL )
+    {
+        //  ERROR:  Write a message
+        log_write( MID_INFO, "WALK__TEST",
+                   "ERROR: Unable to create '%s'.\n", root );
+
+        //  Set a failed return code
+        walk_rc = false;
+    }
+
+    for( ndx = 0;
+         ( walk_rc == true ) && ( TEST_tree[ ndx ] != NULL );
+         ndx += 1 )
+    {
+        snprintf( path, sizeof( path ), "%s/%s", root, TEST_tree[ ndx ] );
+
+        //  Is it a directory ?
+        if ( path[ strlen( path ) - 1 ] == '/' )
+        {
+            //  YES:    Create it
+            mkdir( path, 0700 );
+        }
+        else
+        {
+            //  NO:     Create an empty file
+            file_p = fopen( path, "w" );
+            if ( file_p != NULL )
+            {
+                fclose( file_p );
+            }
+            file_count += 1;
+        }
+    }
+    tree_count = ndx;
+
+    /************************************************************************
+     *  Function Code
+     ************************************************************************/
+
+    //  Walk it once
+    if ( walk_rc == true )
+    {
+        TEST_found_count = 0;
+        walk_dir( root, TEST_WALKERS, true, WALK__TEST_found );
+
+        memcpy( TEST_first, TEST_found, sizeof( TEST_first ) );
+        first_count = TEST_found_count;
+
+        //  Did it find every file ?
+        if ( first_count != file_count )
+        {
+            //  ERROR:  Write a message
+            log_write( MID_INFO, "WALK__TEST",
+                       "ERROR: Found %d files, expected %d.\n",
+                       first_count, file_count );
+
+            //  Set a failed return code
+            walk_rc = false;
+        }
+
+        //  In the expected order ?
+        for( ndx = 0;
+             ( walk_rc == true ) && ( ndx < first_count );
+             ndx += 1 )
+        {
+            snprintf( path, sizeof( path ), "%s/%s", root, TEST_expect[ ndx ] );
+
+            if ( strcmp( TEST_first[ ndx ], path ) != 0 )
+            {
+                //  ERROR:  Write a message
+                log_write( MID_INFO, "WALK__TEST",
+                           "ERROR: F-%02d '%s' Expected: '%s'\n",
+                           ndx, TEST_first[ ndx ], path );
+
+                //  Set a failed return code
+                walk_rc = false;
+            }
+        }
+    }
+
+    //  Walk it again
+    if ( walk_rc == true )
+    {
+        TEST_found_count = 0;
+        walk_dir( root, TEST_WALKERS, true, WALK__TEST_found );
+
+        //  Same files in the same order ?
+        for( ndx = 0;
+             ndx < first_count;
+             ndx += 1 )
+        {
+            if (    ( TEST_found_count != first_count )
+                 || ( strcmp( TEST_found[ ndx ], TEST_first[ ndx ] ) != 0 ) )
+            {
+                //  ERROR:  Write a message
+                log_write( MID_INFO, "WALK__TEST",
+                           "ERROR: F-%02d '%s' then '%s'.\n",
+                           ndx, TEST_first[ ndx ], TEST_found[ ndx ] );
+
+                //  Set a failed return code
+                walk_rc = false;
+
+                //  Stop testing
+                break;
+            }
+        }
+    }
+
+    /************************************************************************
+     *  Completion Message
+     ************************************************************************/
+
+    //  PASS or FAIL ?
+    if ( walk_rc == true )
+    {
+        //  Completion message
+        log_write( MID_INFO, "WALK__TEST", "walk_dir ordered\t\tPASS\n" );
+    }
+    else
+    {
+        //  Completion message
+        log_write( MID_INFO, "WALK__TEST", "walk_dir ordered\t\tFAIL\n" );
+    }
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  Remove the test tree (newest first, so directories are empty)
+    for( ndx = tree_count - 1;
+         ndx >= 0;
+         ndx -= 1 )
+    {
+        snprintf( path, sizeof( path ), "%s/%s", root, TEST_tree[ ndx ] );
+
+        if ( path[ strlen( path ) - 1 ] == '/' )
+        {
+            rmdir( path );
+        }
+        else
+        {
+            unlink( path );
+        }
+    }
+    rmdir( root );
+
+    //  DONE!
+    return ( walk_rc );
+}
+/****************************************************************************/
@@ -0,0 +1,223 @@
+/*******************************  COPYRIGHT  ********************************/
+/**
+ *  Author? "Gregory N. Leonhardt"
+ *  License? "CC BY-NC 2.0"
+ *           "https://creativecommons.org/licenses/by-nc/2.0/"
+ *
+ ****************************************************************************/
+
+/******************************** JAVADOC ***********************************/
+/**
+ *  This file contains public function that makeup the external
+ *  library components of the 'walk' library.
+ *
+ *  @note
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ *  Compiler directives
+ ****************************************************************************/
+
+#define ALLOC_WALK              ( "ALLOCATE STORAGE FOR WALK" )
+
+/****************************************************************************
+ * System Function API
+ ****************************************************************************/
+
+                                //*******************************************
+#include <stdint.h>             //  Alternative storage types
+#include <stdbool.h>            //  TRUE, FALSE, etc.
+#include <stdio.h>              //  Standard I/O definitions
+                                //*******************************************
+#include <string.h>             //  Functions for managing strings
+#include <pthread.h>            //  POSIX threads
+                                //*******************************************
+
+/****************************************************************************
+ * Application APIs
+ ****************************************************************************/
+
+                                //*******************************************
+#include "global.h"             //  Global stuff for this application
+#include "libtools_api.h"       //  My Tools Library
+                                //*******************************************
+#include "walk_api.h"           //  API for all walk_*              PUBLIC
+#include "walk_lib.h"           //  API for all WALK__*             PRIVATE
+                                //*******************************************
+
+/****************************************************************************
+ * Private API Enumerations
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Private API Definitions
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Private API Structures
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Private API Storage Allocation
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Public API Functions
+ ****************************************************************************/
+
+/****************************************************************************/
+/**
+ *  Find every regular file in a directory tree.
+ *
+ *  @param  dir_name_p          Directory to walk
+ *  @param  thread_count        Number of threads (including this one)
+ *  @param  ordered             TRUE = one thread, every directory sorted
+ *  @param  found_p             Called for every regular file
+ *
+ *  @return file_count          Number of regular files found
+ *
+ *  @note
+ *      found_p( ) is called from all of the walker threads at the same time
+ *      and as soon as the file is read from its directory.  It owns the
+ *      file information it is given.
+ *      Returns when the whole tree has been scanned.
+ *      An ordered walk finds the files in the same order on every run,
+ *      which is what -ordered numbers them by.  It ignores thread_count.
+ *
+ ****************************************************************************/
+
+int
+walk_dir(
+    char                    *   dir_name_p,
+    int                         thread_count,
+    int                         ordered,
+    void                    ( * found_p )( struct file_info_t * )
+    )
+{
+    /**
+     *  @param  walk            The walk                                    */
+    struct  walk_t              walk;
+    /**
+     *  @param  thread_list     The other walker threads                    */
+    pthread_t                   thread_list[ WALK_THREADS_MAX ];
+    /**
+     *  @param  ndx             Thread number                               */
+    int                         ndx;
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+    //  Keep the thread count sane
+    if (    ( thread_count <  1    )
+         || ( ordered      == true ) )
+    {
+        thread_count = 1;
+    }
+    else if ( thread_count > WALK_THREADS_MAX )
+    {
+        thread_count = WALK_THREADS_MAX;
+    }
+
+    //  Start with an empty walk
+    memset( &walk, '\0', sizeof( walk ) );
+    walk.found_p = found_p;
+    walk.ordered = ordered;
+    pthread_mutex_init( &walk.walk_mutex, NULL );
+    pthread_cond_init( &walk.walk_cond, NULL );
+
+    //  The top directory is the first one to scan
+    WALK__push( &walk, dir_name_p );
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    //  Launch the other walker threads
+    for ( ndx = 1; ndx < thread_count; ndx += 1 )
+    {
+        pthread_create( &thread_list[ ndx ], NULL, WALK__thread, &walk );
+    }
+
+    //  This thread walks too
+    WALK__thread( &walk );
+
+    //  Wait for the others
+    for ( ndx = 1; ndx < thread_count; ndx += 1 )
+    {
+        pthread_join( thread_list[ ndx ], NULL );
+    }
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  Progress report.
+    log_write( MID_INFO, "walk",
+               "Found %d files in %d directories with %d threads.\n",
+               walk.file_count, walk.dir_count, thread_count );
+
+    //  Clean up
+    pthread_cond_destroy( &walk.walk_cond );
+    pthread_mutex_destroy( &walk.walk_mutex );
+
+    //  DONE!
+    return( walk.file_count );
+}
+
+/****************************************************************************/
+/**
+ *  White Box Testing for the 'walk' library.
+ *
+ *  @param  void                No parameters are passed in.
+ *
+ *  @return walk_rc             TRUE when all tests pass, else FALSE
+ *
+ *  @note
+ *
+ ****************************************************************************/
+
+int
+walk_wbt(
+    void
+    )
+{
+    /**
+     *  @param  walk_rc         Return code from this function              */
+    int                         walk_rc;
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+    //  Initialize variables
+    walk_rc = true;
+
+    /************************************************************************
+     *  Function Code
+     ************************************************************************/
+
+    //  Verify success to this point
+    if ( walk_rc == true ) walk_rc = WALK__TEST_ordered( );
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+    return ( walk_rc );
+}
+/****************************************************************************/
@@ -0,0 +1,535 @@
+/*******************************  COPYRIGHT  ********************************/
+/**
+ *  Author? "Gregory N. Leonhardt"
+ *  License? "CC BY-NC 2.0"
+ *           "https://creativecommons.org/licenses/by-nc/2.0/"
+ *
+ ****************************************************************************/
+
+/******************************** JAVADOC ***********************************/
+/**
+ *  This file contains private functions that makeup the internal
+ *  library components of the 'walk' library.
+ *
+ *  @note
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ *  Compiler directives
+ ****************************************************************************/
+
+
+/****************************************************************************
+ * System Function API
+ ****************************************************************************/
+
+                                //*******************************************
+#include <stdint.h>             //  Alternative storage types
+#include <stdbool.h>            //  TRUE, FALSE, etc.
+#include <stdio.h>              //  Standard I/O definitions
+                                //*******************************************
+#include <stdlib.h>             //  free( )
+#include <string.h>             //  Functions for managing strings
+#include <time.h>               //  localtime_r( ), strftime( )
+#include <dirent.h>             //  opendir( ), readdir( ), scandir( )
+#include <fcntl.h>              //  AT_SYMLINK_NOFOLLOW
+#include <sys/stat.h>           //  fstatat( )
+#include <pthread.h>            //  POSIX threads
+                                //*******************************************
+
+/****************************************************************************
+ * Application APIs
+ ****************************************************************************/
+
+                                //*******************************************
+#include "global.h"             //  Global stuff for this application
+#include "libtools_api.h"       //  My Tools Library
+                                //*******************************************
+#include "walk_api.h"           //  API for all walk_*              PUBLIC
+#include "walk_lib.h"           //  API for all WALK__*             PRIVATE
+                                //*******************************************
+
+/****************************************************************************
+ * Enumerations local to this file
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Definitions local to this file
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Structures local to this file
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Storage Allocation local to this file
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * LIB Functions
+ ****************************************************************************/
+
+/****************************************************************************/
+/**
+ *  Compare two directory entries by name.
+ *
+ *  @param  a_pp                First directory entry
+ *  @param  b_pp                Second directory entry
+ *
+ *  @return compare_rc          <0, 0 or >0 like strcmp( )
+ *
+ *  @note
+ *      Byte order, not the locale's collating order, so the same tree is
+ *      always read in the same order.
+ *
+ ****************************************************************************/
+
+int
+WALK__compare(
+    const   struct  dirent  **  a_pp,
+    const   struct  dirent  **  b_pp
+    )
+{
+    /**
+     *  @param  compare_rc      Return code                                 */
+    int                         compare_rc;
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    //  By name
+    compare_rc = strcmp( (*a_pp)->d_name, (*b_pp)->d_name );
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+    return( compare_rc );
+}
+
+/****************************************************************************/
+/**
+ *  Add a directory to the list of directories waiting to be scanned.
+ *
+ *  @param  walk_p              Pointer to the walk
+ *  @param  dir_name_p          Full directory path & name
+ *
+ *  @return void                No information is returned
+ *
+ *  @note
+ *      The list is a stack.  Scanning the newest directory first keeps the
+ *      list short on deep trees.
+ *
+ ****************************************************************************/
+
+void
+WALK__push(
+    struct  walk_t          *   walk_p,
+    char                    *   dir_name_p
+    )
+{
+    /**
+     *  @param  walk_dir_p      The new directory                           */
+    struct  walk_dir_t      *   walk_dir_p;
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+    //  Build the new directory
+    walk_dir_p = mem_malloc( sizeof( struct walk_dir_t ) );
+    strncpy( walk_dir_p->dir_name, dir_name_p,
+             sizeof( walk_dir_p->dir_name ) - 1 );
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    pthread_mutex_lock( &walk_p->walk_mutex );
+
+    //  Add it to the list
+    walk_dir_p->next_p = walk_p->pending_p;
+    walk_p->pending_p  = walk_dir_p;
+
+    //  Wake one idle thread
+    pthread_cond_signal( &walk_p->walk_cond );
+
+    pthread_mutex_unlock( &walk_p->walk_mutex );
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+}
+
+/****************************************************************************/
+/**
+ *  Build the file information for a regular file and pass it on.
+ *
+ *  @param  walk_p              Pointer to the walk
+ *  @param  dir_name_p          Full directory path & name
+ *  @param  file_name_p         File name
+ *  @param  stat_p              What fstatat( ) found out about the file
+ *
+ *  @return void                No information is returned
+ *
+ *  @note
+ *      The file information is owned by the caller's found function.
+ *
+ ****************************************************************************/
+
+void
+WALK__found(
+    struct  walk_t          *   walk_p,
+    char                    *   dir_name_p,
+    char                    *   file_name_p,
+    struct  stat            *   stat_p
+    )
+{
+    /**
+     *  @param  file_info_p     Pointer to a file information structure     */
+    struct  file_info_t     *   file_info_p;
+    /**
+     *  @param  mtime           Broken down modification time               */
+    struct  tm                  mtime;
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+    //  Allocate the file information
+    file_info_p = mem_malloc( sizeof( struct file_info_t ) );
+    memset( file_info_p, '\0', sizeof( struct file_info_t ) );
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    //  Directory and file name
+    strncpy( file_info_p->dir_name, dir_name_p,
+             sizeof( file_info_p->dir_name ) - 1 );
+    strncpy( file_info_p->file_name, file_name_p,
+             sizeof( file_info_p->file_name ) - 1 );
+
+    //  File size
+    snprintf( file_info_p->file_size, sizeof( file_info_p->file_size ),
+              "%lld", (long long)stat_p->st_size );
+
+    //  Modification date & time
+    localtime_r( &stat_p->st_mtime, &mtime );
+    strftime( file_info_p->date_time, sizeof( file_info_p->date_time ),
+              "%Y-%m-%d %H:%M:%S", &mtime );
+
+    //  Count it
+    __atomic_add_fetch( &walk_p->file_count, 1, __ATOMIC_RELAXED );
+
+    //  Pass it on
+    walk_p->found_p( file_info_p );
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+}
+
+/****************************************************************************/
+/**
+ *  Scan one directory.
+ *
+ *  @param  walk_p              Pointer to the walk
+ *  @param  walk_dir_p          The directory to scan
+ *
+ *  @return void                No information is returned
+ *
+ *  @note
+ *      Subdirectories are added to the pending list and regular files are
+ *      passed on as they are read.  A symbolic link to a file is followed,
+ *      a symbolic link to a directory is not (it could be a loop).
+ *      An ordered walk reads the whole directory first and sorts it by
+ *      name, so the files come out the same way whatever readdir( ) does.
+ *
+ ****************************************************************************/
+
+void
+WALK__scan(
+    struct  walk_t          *   walk_p,
+    struct  walk_dir_t      *   walk_dir_p
+    )
+{
+    /**
+     *  @param  dir_p           Open directory stream                       */
+    DIR                     *   dir_p;
+    /**
+     *  @param  entry_p         One directory entry                         */
+    struct  dirent          *   entry_p;
+    /**
+     *  @param  file_stat       File status                                 */
+    struct  stat                file_stat;
+    /**
+     *  @param  path            Full path & name of a subdirectory          */
+    char                        path[ FILENAME_MAX ];
+    /**
+     *  @param  entry_list_pp   Sorted directory entries (ordered walk)     */
+    struct  dirent          **  entry_list_pp;
+    /**
+     *  @param  entry_count     Number of sorted directory entries          */
+    int                         entry_count;
+    /**
+     *  @param  entry_ndx       Index into the sorted directory entries     */
+    int                         entry_ndx;
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+    //  Open the directory
+    dir_p = opendir( walk_dir_p->dir_name );
+
+    //  Did it open ?
+    if ( dir_p == NULL )
+    {
+        //  NO:     Log it and move on
+        log_write( MID_WARNING, "walk",
+                   "Unable to open directory: '%s'\n",
+                   walk_dir_p->dir_name );
+        return;
+    }
+
+    //  Is this an ordered walk ?
+    entry_list_pp = NULL;
+    entry_count   = 0;
+    if ( walk_p->ordered == true )
+    {
+        //  YES:    Read the whole directory sorted by name
+        entry_count = scandir( walk_dir_p->dir_name, &entry_list_pp,
+                               NULL, WALK__compare );
+
+        if ( entry_count < 0 )
+        {
+            log_write( MID_WARNING, "walk",
+                       "Unable to read directory: '%s'\n",
+                       walk_dir_p->dir_name );
+            entry_count = 0;
+        }
+    }
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    //  Read every entry
+    for( entry_ndx = 0;
+         ;
+         entry_ndx += 1 )
+    {
+        //  Is this an ordered walk ?
+        if ( walk_p->ordered == true )
+        {
+            //  YES:    Next one from the sorted list
+            entry_p = ( entry_ndx < entry_count ) ? entry_list_pp[ entry_ndx ]
+                                                  : NULL;
+        }
+        else
+        {
+            //  NO:     Next one from the directory
+            entry_p = readdir( dir_p );
+        }
+
+        //  Is that all of them ?
+        if ( entry_p == NULL )
+        {
+            //  YES:    Done
+            break;
+        }
+
+        //  Is this the current or the parent directory ?
+        if (    ( strcmp( entry_p->d_name, "."  ) == 0 )
+             || ( strcmp( entry_p->d_name, ".." ) == 0 ) )
+        {
+            //  YES:    Skip it
+            continue;
+        }
+
+        //  Is it a directory ?
+        if ( entry_p->d_type == DT_DIR )
+        {
+            //  YES:    No need to look any closer
+            file_stat.st_mode = S_IFDIR;
+        }
+        else
+        {
+            //  NO:     Get the file status (follow a symbolic link)
+            if ( fstatat( dirfd( dir_p ), entry_p->d_name, &file_stat,
+                          ( entry_p->d_type == DT_LNK )
+                                ? 0 : AT_SYMLINK_NOFOLLOW ) != 0 )
+            {
+                //  Gone already
+                continue;
+            }
+
+            //  Is it a symbolic link to a directory ?
+            if (    ( entry_p->d_type == DT_LNK )
+                 && ( S_ISDIR( file_stat.st_mode ) ) )
+            {
+                //  YES:    Don't follow it
+                continue;
+            }
+        }
+
+        //  Is it a directory ?
+        if ( S_ISDIR( file_stat.st_mode ) )
+        {
+            //  YES:    Build the full path
+            if ( snprintf( path, sizeof( path ), "%s/%s",
+                           walk_dir_p->dir_name, entry_p->d_name )
+                 >= (int)sizeof( path ) )
+            {
+                //  Too long
+                log_write( MID_WARNING, "walk",
+                           "Directory name is too long: '%s/%s'\n",
+                           walk_dir_p->dir_name, entry_p->d_name );
+                continue;
+            }
+
+            //  Scan it later
+            WALK__push( walk_p, path );
+        }
+
+        //  Is it a regular file ?
+        else if ( S_ISREG( file_stat.st_mode ) )
+        {
+            //  YES:    Pass it on
+            WALK__found( walk_p, walk_dir_p->dir_name,
+                         entry_p->d_name, &file_stat );
+        }
+    }
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  Free the sorted list
+    for( entry_ndx = 0;
+         entry_ndx < entry_count;
+         entry_ndx += 1 )
+    {
+        free( entry_list_pp[ entry_ndx ] );
+    }
+    free( entry_list_pp );
+
+    //  Close the directory
+    closedir( dir_p );
+
+    //  DONE!
+}
+
+/****************************************************************************/
+/**
+ *  Directory walker thread.
+ *
+ *  @param  void_p              Pointer to the walk
+ *
+ *  @return NULL                Always
+ *
+ *  @note
+ *      The walk is finished when there is nothing left to scan and no
+ *      thread is scanning (and might still find another directory).
+ *
+ ****************************************************************************/
+
+void    *
+WALK__thread(
+    void                    *   void_p
+    )
+{
+    /**
+     *  @param  walk_p          Pointer to the walk                         */
+    struct  walk_t          *   walk_p;
+    /**
+     *  @param  walk_dir_p      The directory to scan                       */
+    struct  walk_dir_t      *   walk_dir_p;
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+    //  Set the pointer
+    walk_p = void_p;
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    pthread_mutex_lock( &walk_p->walk_mutex );
+
+    do
+    {
+        //  Wait for a directory or for the end of the walk
+        while (    ( walk_p->pending_p  == NULL )
+                && ( walk_p->busy_count != 0    ) )
+        {
+            pthread_cond_wait( &walk_p->walk_cond, &walk_p->walk_mutex );
+        }
+
+        //  Take the next directory
+        walk_dir_p = walk_p->pending_p;
+
+        //  Is there one ?
+        if ( walk_dir_p != NULL )
+        {
+            //  YES:    Scan it without holding the lock
+            walk_p->pending_p   = walk_dir_p->next_p;
+            walk_p->busy_count += 1;
+            walk_p->dir_count  += 1;
+
+            pthread_mutex_unlock( &walk_p->walk_mutex );
+
+            WALK__scan( walk_p, walk_dir_p );
+            mem_free( walk_dir_p );
+
+            pthread_mutex_lock( &walk_p->walk_mutex );
+            walk_p->busy_count -= 1;
+
+            //  Was that the last one ?
+            if (    ( walk_p->pending_p  == NULL )
+                 && ( walk_p->busy_count == 0    ) )
+            {
+                //  YES:    Tell everyone
+                pthread_cond_broadcast( &walk_p->walk_cond );
+            }
+        }
+
+    }   while( walk_dir_p != NULL );
+
+    pthread_mutex_unlock( &walk_p->walk_mutex );
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+    return( NULL );
+}
+/****************************************************************************/
@@ -0,0 +1,164 @@
+/*******************************  COPYRIGHT  ********************************/
+/**
+ *  Author? "Gregory N. Leonhardt"
+ *  License? "CC BY-NC 2.0"
+ *           "https://creativecommons.org/licenses/by-nc/2.0/"
+ *
+ ****************************************************************************/
+
+#ifndef WALK_LIB_H
+#define WALK_LIB_H
+
+/******************************** JAVADOC ***********************************/
+/**
+ *  This file contains private definitions (etc.) that apply to internal
+ *  library components of the 'walk' library.
+ *
+ *  @note
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ *  Compiler directives
+ ****************************************************************************/
+
+#ifdef ALLOC_WALK
+   #define WALK_EXT
+#else
+   #define WALK_EXT         extern
+#endif
+
+/****************************************************************************
+ * System APIs
+ ****************************************************************************/
+
+                                //*******************************************
+#include <stdio.h>              //  FILENAME_MAX
+#include <pthread.h>            //  POSIX threads
+#include <dirent.h>             //  struct dirent
+#include <sys/stat.h>           //  struct stat
+                                //*******************************************
+
+/****************************************************************************
+ * Application APIs
+ ****************************************************************************/
+
+                                //*******************************************
+                                //*******************************************
+
+/****************************************************************************
+ * Library Private Definitions
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+#define WALK_THREADS_MAX        (   64 )
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Library Private Enumerations
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Library Private Structures
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+/**
+ *  @param  walk_dir_t          A directory that has not been scanned yet   */
+struct  walk_dir_t
+{
+    /**
+     *  @param  next_p          Next directory waiting to be scanned        */
+    struct  walk_dir_t      *   next_p;
+    /**
+     *  @param  dir_name        Full directory path & name                  */
+    char                        dir_name[ FILENAME_MAX ];
+};
+//----------------------------------------------------------------------------
+/**
+ *  @param  walk_t              One directory tree walk                     */
+struct  walk_t
+{
+    /**
+     *  @param  found_p         Called for every regular file               */
+    void                    ( * found_p )( struct file_info_t * );
+    /**
+     *  @param  ordered         TRUE = read each directory in name order    */
+    int                         ordered;
+    /**
+     *  @param  pending_p       Directories waiting to be scanned           */
+    struct  walk_dir_t      *   pending_p;
+    /**
+     *  @param  busy_count      Threads that are scanning a directory       */
+    int                         busy_count;
+    /**
+     *  @param  dir_count       Number of directories scanned               */
+    int                         dir_count;
+    /**
+     *  @param  file_count      Number of regular files found               */
+    int                         file_count;
+    /**
+     *  @param  walk_mutex      Protects all of the above                   */
+    pthread_mutex_t             walk_mutex;
+    /**
+     *  @param  walk_cond       Signaled when a directory is added or the
+     *                          walk is finished                            */
+    pthread_cond_t              walk_cond;
+};
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Library Private Storage Allocation
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+/****************************************************************************
+ * Library Private Prototypes
+ ****************************************************************************/
+
+//----------------------------------------------------------------------------
+int
+WALK__compare(
+    const   struct  dirent  **  a_pp,
+    const   struct  dirent  **  b_pp
+    );
+//----------------------------------------------------------------------------
+void
+WALK__push(
+    struct  walk_t          *   walk_p,
+    char                    *   dir_name_p
+    );
+//----------------------------------------------------------------------------
+void
+WALK__found(
+    struct  walk_t          *   walk_p,
+    char                    *   dir_name_p,
+    char                    *   file_name_p,
+    struct  stat            *   stat_p
+    );
+//----------------------------------------------------------------------------
+void
+WALK__scan(
+    struct  walk_t          *   walk_p,
+    struct  walk_dir_t      *   walk_dir_p
+    );
+//----------------------------------------------------------------------------
+void    *
+WALK__thread(
+    void                    *   void_p
+    );
+//----------------------------------------------------------------------------
+int
+WALK__TEST_ordered(
+    void
+    );
+//----------------------------------------------------------------------------
+
+/****************************************************************************/
+
+#endif                      //    WALK_LIB_H
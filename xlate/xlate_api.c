@@ -240,6 +240,14 @@ xlate_init(
         }
     }
 
+    //  The tables never change from here on.  Make read-only copies that
+    //  every decode thread can search at the same time.
+    unit_of_measurement_pp = XLATE__table_freeze( unit_of_measurement_p );
+    categories_pp          = XLATE__table_freeze( categories_p );
+    abbreviations_pp       = XLATE__table_freeze( abbreviations_p );
+    paragraph_starters_pp  = XLATE__table_freeze( paragraph_starters_p );
+    key_words_pp           = XLATE__table_freeze( key_words_p );
+
     /************************************************************************
      *  Function Exit
      ************************************************************************/
@@ -276,7 +284,7 @@ xlate_units(
      ************************************************************************/
 
     // Find the Search String in the Measurements table
-    found_string_p = XLATE__find_in_table( unit_of_measurement_p,
+    found_string_p = XLATE__find_in_table( unit_of_measurement_pp,
                                            search_string_p );
 
     //  Did we locate a translation for this string ?
@@ -329,7 +337,7 @@ xlate_chapter(
      ************************************************************************/
 
     //  Find the Search String in the Measurements table
-    found_string_p = XLATE__find_in_table( categories_p,
+    found_string_p = XLATE__find_in_table( categories_pp,
                                            search_string_p );
 
     //  Did we locate a translation for this string ?
@@ -378,7 +386,7 @@ xlate_paragraph_starters(
      ************************************************************************/
 
     // Find the Search String in the Measurements table
-    found_string_p = XLATE__find_in_table( paragraph_starters_p,
+    found_string_p = XLATE__find_in_table( paragraph_starters_pp,
                                            search_string_p );
 
     // Anything that ends with a Colon ( : ) is also the
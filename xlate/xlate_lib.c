@@ -256,12 +256,72 @@ XLATE__table_input(
     return ( xlate_rc );
 }
 
+/****************************************************************************/
+/**
+ *  Copy a translation list into a NULL terminated table.
+ *
+ *  @param  xlate_table_p       Pointer to the translation list
+ *
+ *  @return table_pp            Pointer to the table
+ *
+ *  @note
+ *      The table is never changed once it is built so it can be searched
+ *      by any number of threads without a lock.
+ *
+ ****************************************************************************/
+
+struct  table_data_t        **
+XLATE__table_freeze(
+    struct  list_base_t         *   xlate_table_p
+    )
+{
+    /**
+     *  @param  table_pp        Pointer to the table                        */
+    struct  table_data_t        **  table_pp;
+    /**
+     *  @param  table_data_p    Pointer to a table data entry               */
+    struct  table_data_t        *   table_data_p;
+    /**
+     *  @param  ndx             Table index                                 */
+    int                             ndx;
+
+    /************************************************************************
+     *  Function Initialization
+     ************************************************************************/
+
+    //  Allocate the table (plus the NULL terminator)
+    table_pp = mem_malloc(   ( list_query_count( xlate_table_p ) + 1 )
+                           * sizeof( struct table_data_t * ) );
+
+    /************************************************************************
+     *  Function Body
+     ************************************************************************/
+
+    //  Copy every entry in the list to the table
+    for( table_data_p = list_get_first( xlate_table_p ), ndx = 0;
+         table_data_p != NULL;
+         table_data_p = list_get_next( xlate_table_p, table_data_p ), ndx += 1 )
+    {
+        table_pp[ ndx ] = table_data_p;
+    }
+
+    //  End of table
+    table_pp[ ndx ] = NULL;
+
+    /************************************************************************
+     *  Function Exit
+     ************************************************************************/
+
+    //  DONE!
+    return( table_pp );
+}
+
 /****************************************************************************/
 /**
  *  Search through a translation table looking for a match to the
  *  SearchParameter.
  *
- *  @param  search_table_p      Pointer to the table being searched
+ *  @param  search_table_pp     Pointer to the table being searched
  *  @param  search_string_p     Pointer to the string we are looking for.
  *
  *  @return found_string_p      Upon successful search, a pointer to the
@@ -274,7 +334,7 @@ XLATE__table_input(
 
 char  *
 XLATE__find_in_table(
-    struct  list_base_t         *   search_table_p,
+    struct  table_data_t        **  search_table_pp,
     char                        *   search_string_p
     )
 {
@@ -296,9 +356,6 @@ XLATE__find_in_table(
     /**
      *  @param  table_data_p    Pointer to a table data entry               */
     struct  table_data_t        *   table_data_p;
-    /**
-     * @param list_lock_key     File list key                               */
-    int                             list_lock_key;
 
     /************************************************************************
      *  Function Initialization
@@ -327,7 +384,7 @@ XLATE__find_in_table(
 
     // Flush the local search string
     memset( search_string, ' ', sizeof ( search_string ) );
-    search_string[ sizeof ( search_string ) ] = '\0';
+    search_string[ sizeof ( search_string ) - 1 ] = '\0';
 
     //  If the search string length is greater then one, convert
     //  the search string to upper case.
@@ -360,13 +417,10 @@ XLATE__find_in_table(
     //  Get the revised character length for the search string
     search_string_l = strlen( search_string );
 
-    //  Lock the list for fast(er) access
-    list_lock_key = list_user_lock( search_table_p );
-
     //  Scan the translation table for a match to the UPPER search string.
-    for( table_data_p = list_fget_first( search_table_p, list_lock_key );
-         table_data_p != NULL;
-         table_data_p = list_fget_next( search_table_p, table_data_p, list_lock_key ) )
+    for( ndx = 0;
+         ( table_data_p = search_table_pp[ ndx ] ) != NULL;
+         ndx += 1 )
     {
         //  Compare the Search String against this table entry
         xlate_rc = strncmp( table_data_p->xlate_from_p,
@@ -388,9 +442,6 @@ XLATE__find_in_table(
      *  Function Exit
      ************************************************************************/
 
-    //  Unlock the list
-    list_user_unlock( search_table_p, list_lock_key );
-
     //  DONE!
     return( found_string_p );
 }
@@ -79,6 +79,18 @@ struct  list_base_t         *   paragraph_starters_p;
 XLATE_EXT
 struct  list_base_t         *   key_words_p;
 //----------------------------------------------------------------------------
+//  Read-only copies of the lists that are searched without any locking
+XLATE_EXT
+struct  table_data_t        **  unit_of_measurement_pp;
+XLATE_EXT
+struct  table_data_t        **  categories_pp;
+XLATE_EXT
+struct  table_data_t        **  abbreviations_pp;
+XLATE_EXT
+struct  table_data_t        **  paragraph_starters_pp;
+XLATE_EXT
+struct  table_data_t        **  key_words_pp;
+//----------------------------------------------------------------------------
 
 /****************************************************************************
  * Library Private Prototypes
@@ -91,9 +103,14 @@ XLATE__table_input(
     struct  list_base_t         *   xlate_table_p
     );
 //----------------------------------------------------------------------------
+struct  table_data_t        **
+XLATE__table_freeze(
+    struct  list_base_t         *   xlate_table_p
+    );
+//----------------------------------------------------------------------------
 char  *
 XLATE__find_in_table(
-    struct  list_base_t         *   search_table_p,
+    struct  table_data_t        **  search_table_pp,
     char                        *   search_string_p
     );
 //----------------------------------------------------------------------------